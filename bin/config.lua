@@ -3,3 +3,5 @@ window_height = 768;
 fullscreen = false;
 scale_factor = 1.0;
 print_to_log = false;
+benchmark_frame_count = 0;
+benchmark_vertex_count = 0;
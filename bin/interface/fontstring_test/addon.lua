@@ -45,3 +45,14 @@ FSTest.controls = "|cFF3FA7F3Controls|r\n\n"
     .."Also note that you can interact with the two frames (the color selector "
     .."and the file browser) : you can move them by dragging their title bar ("
     .."also called 'TitleRegion'), and you can resize them by dragging their edges."
+
+-- A coroutine waiting more than once: the second wait() creates its timer from inside the
+-- resumed coroutine, which must still be callable once that coroutine is suspended again.
+FSTest.coroutine_steps = 0;
+run_coroutine(function()
+    wait(0.1);
+    FSTest.coroutine_steps = FSTest.coroutine_steps + 1;
+    wait(0.1);
+    FSTest.coroutine_steps = FSTest.coroutine_steps + 1;
+    log("FSTest : coroutine resumed "..FSTest.coroutine_steps.." times");
+end);
@@ -34,7 +34,9 @@
 
 namespace lxgui::gui::gl {
 
-atlas_page::atlas_page(gui::renderer& rdr, material::filter filt) : gui::atlas_page(filt) {
+atlas_page::atlas_page(
+    gui::renderer& rdr, material::filter filt, material::pixel_format format) :
+    gui::atlas_page(filt), format_(format) {
     size_ = rdr.get_texture_atlas_page_size();
 
     GLint previous_id;
@@ -42,10 +44,8 @@ atlas_page::atlas_page(gui::renderer& rdr, material::filter filt) : gui::atlas_p
 
     glGenTextures(1, &texture_handle_);
 
-    GLsizei size_int = static_cast<GLsizei>(size_);
     glBindTexture(GL_TEXTURE_2D, texture_handle_);
-    glTexImage2D(
-        GL_TEXTURE_2D, 0, GL_RGBA8, size_int, size_int, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    material::allocate_texture(vector2ui(size_, size_), format_);
 
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
@@ -84,9 +84,10 @@ atlas_page::~atlas_page() {
 std::shared_ptr<gui::material>
 atlas_page::add_material_(const gui::material& mat, const bounds2f& location) {
     const gl::material& gl_mat = static_cast<const gl::material&>(mat);
-
-    GLint previous_id;
-    glGetIntegerv(GL_TEXTURE_BINDING_2D, &previous_id);
+    if (gl_mat.get_pixel_format() != format_) {
+        throw gui::exception(
+            "gui::gl::atlas_page", "Cannot add a material with a different pixel format.");
+    }
 
     GLuint fbo = 0;
     glGenFramebuffers(1, &fbo);
@@ -101,15 +102,19 @@ atlas_page::add_material_(const gui::material& mat, const bounds2f& location) {
     glBindFramebuffer(GL_FRAMEBUFFER, 0);
     glDeleteFramebuffers(1, &fbo);
 
-    glBindTexture(GL_TEXTURE_2D, texture_handle_);
-    glTexSubImage2D(
-        GL_TEXTURE_2D, 0, location.left, location.top, location.width(), location.height(), GL_RGBA,
-        GL_UNSIGNED_BYTE, pixel_data.data());
+    if (format_ == material::pixel_format::alpha) {
+        // Single-channel textures are read back as (r,0,0,1); keep the red channel only
+        std::vector<std::uint8_t> alpha_data(pixel_data.size());
+        for (std::size_t i = 0; i < pixel_data.size(); ++i)
+            alpha_data[i] = pixel_data[i].r;
 
-    glBindTexture(GL_TEXTURE_2D, previous_id);
+        material::update_texture_region(texture_handle_, location, format_, alpha_data.data());
+    } else {
+        material::update_texture_region(texture_handle_, location, format_, pixel_data.data());
+    }
 
     return std::make_shared<gl::material>(
-        texture_handle_, vector2ui(size_, size_), location, filter_);
+        texture_handle_, vector2ui(size_, size_), location, filter_, format_);
 }
 
 float atlas_page::get_width_() const {
@@ -120,10 +125,11 @@ float atlas_page::get_height_() const {
     return size_;
 }
 
-atlas::atlas(renderer& rdr, material::filter filt) : gui::atlas(rdr, filt) {}
+atlas::atlas(renderer& rdr, material::filter filt, material::pixel_format format) :
+    gui::atlas(rdr, filt), format_(format) {}
 
 std::unique_ptr<gui::atlas_page> atlas::create_page_() {
-    return std::make_unique<gl::atlas_page>(renderer_, filter_);
+    return std::make_unique<gl::atlas_page>(renderer_, filter_, format_);
 }
 
 } // namespace lxgui::gui::gl
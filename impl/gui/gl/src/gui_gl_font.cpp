@@ -75,8 +75,11 @@ font::font(
     std::size_t                          size,
     std::size_t                          outline,
     const std::vector<code_point_range>& code_points,
-    char32_t                             default_code_point) :
-    size_(size), default_code_point_(default_code_point) {
+    char32_t                             default_code_point,
+    std::size_t                          distance_field_spread) :
+    size_(size),
+    distance_field_spread_(distance_field_spread),
+    default_code_point_(default_code_point) {
     // NOTE: Code inspired from Ogre::Font, from the OGRE3D graphics engine
     // http://www.ogre3d.org
     // ... and SFML
@@ -87,10 +90,20 @@ font::font(
     //  - Character width is calculated as: max(x_bearing + width, advance),
     //    since advance sometimes doesn't cover the whole glyph
     //    (typical example is the 'w' character, in Consolas:9).
+    //
+    // For distance field fonts, each glyph is rasterized as usual, then converted to a
+    // signed distance field padded by the spread on each side.
+    //
+    // The FreeType face is only kept open after loading if the font has kerning, which is
+    // then read for each pair of characters the first time it is needed.
 
-    if (!utils::file_exists(font_file))
+    // The face reads from this buffer, which must outlive it
+    auto content = utils::read_file(font_file);
+    if (!content.has_value())
         throw gui::exception("gui::gl::font", "Cannot find file \"" + font_file + "\".");
 
+    content_ = std::move(*content);
+
     FT_Library ft      = get_freetype();
     FT_Stroker stroker = nullptr;
     FT_Glyph   glyph   = nullptr;
@@ -99,7 +112,9 @@ font::font(
         // Add some space between letters to prevent artifacts
         const std::size_t spacing = 1;
 
-        if (FT_New_Face(ft, font_file.c_str(), 0, &face_) != 0) {
+        if (FT_New_Memory_Face(
+                ft, reinterpret_cast<const FT_Byte*>(content_.data()),
+                static_cast<FT_Long>(content_.size()), 0, &face_) != 0) {
             throw gui::exception(
                 "gui::gl::font", "Error loading font: \"" + font_file + "\": cannot load face.");
         }
@@ -162,8 +177,8 @@ font::font(
             }
         }
 
-        max_height = max_height + 2 * outline;
-        max_width  = max_width + 2 * outline;
+        max_height = max_height + 2 * outline + 2 * distance_field_spread;
+        max_width  = max_width + 2 * outline + 2 * distance_field_spread;
 
         // Calculate the size of the texture
         std::size_t tex_size = (max_width + spacing) * (max_height + spacing) * num_char;
@@ -189,14 +204,11 @@ font::font(
         if (final_width * final_height / 2 >= tex_size)
             final_height = final_height / 2;
 
-        std::vector<color32> data(final_width * final_height);
-        std::fill(data.begin(), data.end(), color32{0, 0, 0, 0});
+        // Glyph coverage, one byte per pixel
+        std::vector<std::uint8_t> data(final_width * final_height, 0u);
 
         std::size_t x = 0, y = 0;
 
-        if (FT_HAS_KERNING(face_))
-            kerning_ = true;
-
         float y_offset = 0.0f;
         if (FT_IS_SCALABLE(face_)) {
             FT_Fixed scale = face_->size->metrics.y_scale;
@@ -241,37 +253,53 @@ font::font(
 
                 const FT_Bitmap& bitmap = bitmap_glyph->bitmap;
 
+                // Some characters do not have a bitmap, like white spaces.
+                // This is legal, and we should just have blank geometry for them.
+                const std::uint8_t* buffer       = bitmap.buffer;
+                std::size_t         glyph_width  = bitmap.width;
+                std::size_t         glyph_height = bitmap.rows;
+                std::size_t         padding      = 0u;
+
+                std::vector<std::uint8_t> distance_field;
+                if (distance_field_spread > 0u && buffer && glyph_width > 0u && glyph_height > 0u) {
+                    distance_field = gui::make_distance_field(
+                        buffer, bitmap.width, bitmap.rows, static_cast<std::size_t>(bitmap.pitch),
+                        distance_field_spread);
+
+                    buffer  = distance_field.data();
+                    padding = distance_field_spread;
+                    glyph_width += 2 * padding;
+                    glyph_height += 2 * padding;
+                }
+
                 // If at end of row, jump to next line
-                if (x + bitmap.width > final_width - 1) {
+                if (x + glyph_width > final_width - 1) {
                     y += max_height + spacing;
                     x = 0;
                 }
 
-                // Some characters do not have a bitmap, like white spaces.
-                // This is legal, and we should just have blank geometry for them.
-                const color32::chanel* buffer = bitmap.buffer;
                 if (buffer) {
-                    for (std::size_t j = 0; j < bitmap.rows; ++j) {
+                    for (std::size_t j = 0; j < glyph_height; ++j) {
                         std::size_t row_offset = (y + j) * final_width + x;
-                        for (std::size_t i = 0; i < bitmap.width; ++i, ++buffer)
-                            data[i + row_offset] = color32{255, 255, 255, *buffer};
+                        for (std::size_t i = 0; i < glyph_width; ++i, ++buffer)
+                            data[i + row_offset] = *buffer;
                     }
                 }
 
                 ci.uvs.left   = x / float(final_width);
                 ci.uvs.top    = y / float(final_height);
-                ci.uvs.right  = (x + bitmap.width) / float(final_width);
-                ci.uvs.bottom = (y + bitmap.rows) / float(final_height);
+                ci.uvs.right  = (x + glyph_width) / float(final_width);
+                ci.uvs.bottom = (y + glyph_height) / float(final_height);
 
-                ci.rect.left   = bitmap_glyph->left;
-                ci.rect.right  = ci.rect.left + bitmap.width;
-                ci.rect.top    = y_offset - bitmap_glyph->top;
-                ci.rect.bottom = ci.rect.top + bitmap.rows;
+                ci.rect.left   = bitmap_glyph->left - static_cast<float>(padding);
+                ci.rect.right  = ci.rect.left + glyph_width;
+                ci.rect.top    = y_offset - bitmap_glyph->top - static_cast<float>(padding);
+                ci.rect.bottom = ci.rect.top + glyph_height;
 
                 ci.advance = ft_round<16>(bitmap_glyph->root.advance.x);
 
                 // Advance a column
-                x += bitmap.width + spacing;
+                x += glyph_width + spacing;
 
                 FT_Done_Glyph(glyph);
                 glyph = nullptr;
@@ -281,11 +309,46 @@ font::font(
         }
 
         FT_Stroker_Done(stroker);
+        stroker = nullptr;
 
-        gl::material::premultiply_alpha(data);
+        // Distance fields must be interpolated to render smooth edges at any size
+        const material::filter filt =
+            distance_field_spread > 0u ? material::filter::linear : material::filter::none;
 
-        texture_ = std::make_shared<gl::material>(vector2ui(final_width, final_height));
+#if defined(LXGUI_OPENGL3)
+        // Glyphs are white, so a single channel is enough: the shader expands it
+        texture_ = std::make_shared<gl::material>(
+            vector2ui(final_width, final_height), material::wrap::repeat, filt,
+            material::pixel_format::alpha);
         texture_->update_texture(data.data());
+#else
+        std::vector<color32> rgba_data(data.size());
+        for (std::size_t i = 0; i < data.size(); ++i)
+            rgba_data[i] = color32{255, 255, 255, data[i]};
+
+        gl::material::premultiply_alpha(rgba_data);
+
+        texture_ = std::make_shared<gl::material>(
+            vector2ui(final_width, final_height), material::wrap::repeat, filt);
+        texture_->update_texture(rgba_data.data());
+#endif
+
+        if (FT_HAS_KERNING(face_)) {
+            kerning_ = kerning_table([face = face_](char32_t c1, char32_t c2) -> float {
+                const FT_UInt prev = FT_Get_Char_Index(face, c1);
+                const FT_UInt next = FT_Get_Char_Index(face, c2);
+
+                FT_Vector kerning;
+                if (FT_Get_Kerning(face, prev, next, FT_KERNING_UNFITTED, &kerning) != 0)
+                    return 0.0f;
+
+                return ft_round<6>(kerning.x);
+            });
+        } else {
+            FT_Done_Face(face_);
+            face_    = nullptr;
+            content_ = utils::file_content{};
+        }
     } catch (...) {
         if (glyph)
             FT_Done_Glyph(glyph);
@@ -357,16 +420,11 @@ float font::get_character_height(char32_t c) const {
 }
 
 float font::get_character_kerning(char32_t c1, char32_t c2) const {
-    if (kerning_) {
-        FT_Vector kerning;
-        FT_UInt   prev = FT_Get_Char_Index(face_, c1);
-        FT_UInt   next = FT_Get_Char_Index(face_, c2);
-        if (FT_Get_Kerning(face_, prev, next, FT_KERNING_UNFITTED, &kerning) != 0)
-            return ft_round<6>(kerning.x);
-        else
-            return 0.0f;
-    } else
-        return 0.0f;
+    return kerning_.get(c1, c2);
+}
+
+float font::get_distance_field_spread() const {
+    return static_cast<float>(distance_field_spread_);
 }
 
 std::weak_ptr<gui::material> font::get_texture() const {
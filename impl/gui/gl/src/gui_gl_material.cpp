@@ -27,6 +27,9 @@
 #if !defined(GL_CLAMP_TO_EDGE)
 #    define GL_CLAMP_TO_EDGE 0x812F
 #endif
+#if !defined(GL_R8)
+#    define GL_R8 0x8229
+#endif
 
 #include <cmath>
 
@@ -39,8 +42,35 @@ std::size_t next_pot(std::size_t size) {
     return std::pow(2.0f, std::ceil(std::log2(static_cast<float>(size))));
 }
 
-material::material(const vector2ui& dimensions, wrap wrp, filter filt) :
-    gui::material(false), wrap_(wrp), filter_(filt), is_owner_(true) {
+namespace {
+
+GLenum get_internal_format(material::pixel_format format) {
+    switch (format) {
+    case material::pixel_format::alpha:
+#if defined(LXGUI_OPENGL3)
+        // Expanded to (a,a,a,a) by the shader
+        return GL_R8;
+#else
+        // Sampled as (a,a,a,a) by the fixed pipeline
+        return GL_INTENSITY8;
+#endif
+    case material::pixel_format::rgba:
+    default: return GL_RGBA8;
+    }
+}
+
+GLenum get_upload_format(material::pixel_format format) {
+    switch (format) {
+    case material::pixel_format::alpha: return GL_RED;
+    case material::pixel_format::rgba:
+    default: return GL_RGBA;
+    }
+}
+
+} // namespace
+
+material::material(const vector2ui& dimensions, wrap wrp, filter filt, pixel_format format) :
+    gui::material(false), wrap_(wrp), filter_(filt), format_(format), is_owner_(true) {
     if (only_power_of_two)
         canvas_dimensions_ = vector2ui(next_pot(dimensions.x), next_pot(dimensions.y));
     else
@@ -59,9 +89,7 @@ material::material(const vector2ui& dimensions, wrap wrp, filter filt) :
     glGenTextures(1, &texture_handle_);
 
     glBindTexture(GL_TEXTURE_2D, texture_handle_);
-    glTexImage2D(
-        GL_TEXTURE_2D, 0, GL_RGBA8, canvas_dimensions_.x, canvas_dimensions_.y, 0, GL_RGBA,
-        GL_UNSIGNED_BYTE, nullptr);
+    allocate_texture(canvas_dimensions_, format_);
 
     switch (wrp) {
     case wrap::clamp:
@@ -96,10 +124,12 @@ material::material(
     std::uint32_t    texture_handle,
     const vector2ui& canvas_dimensions,
     const bounds2f   rect,
-    filter           filt) :
+    filter           filt,
+    pixel_format     format) :
     gui::material(true),
     canvas_dimensions_(canvas_dimensions),
     filter_(filt),
+    format_(format),
     texture_handle_(texture_handle),
     rect_(rect),
     is_owner_(false) {}
@@ -163,6 +193,10 @@ material::filter material::get_filter() const {
     return filter_;
 }
 
+material::pixel_format material::get_pixel_format() const {
+    return format_;
+}
+
 void material::bind() const {
     glBindTexture(GL_TEXTURE_2D, texture_handle_);
 }
@@ -209,9 +243,7 @@ bool material::set_dimensions(const vector2ui& dimensions) {
         glGetIntegerv(GL_TEXTURE_BINDING_2D, &previous_id);
 
         glBindTexture(GL_TEXTURE_2D, texture_handle_);
-        glTexImage2D(
-            GL_TEXTURE_2D, 0, GL_RGBA8, canvas_dimensions.x, canvas_dimensions.y, 0, GL_RGBA,
-            GL_UNSIGNED_BYTE, nullptr);
+        allocate_texture(canvas_dimensions, format_);
 
         switch (wrap_) {
         case wrap::clamp:
@@ -247,17 +279,48 @@ bool material::set_dimensions(const vector2ui& dimensions) {
 }
 
 void material::update_texture(const color32* data) {
+    if (format_ != pixel_format::rgba) {
+        throw gui::exception(
+            "gui::gl::material", "Cannot upload RGBA pixels to a single-channel texture.");
+    }
+
+    update_texture_region(texture_handle_, rect_, format_, data);
+}
+
+void material::update_texture(const std::uint8_t* data) {
+    if (format_ != pixel_format::alpha) {
+        throw gui::exception(
+            "gui::gl::material", "Cannot upload single-channel pixels to an RGBA texture.");
+    }
+
+    update_texture_region(texture_handle_, rect_, format_, data);
+}
+
+void material::update_texture_region(
+    std::uint32_t texture_handle, const bounds2f& rect, pixel_format format, const void* data) {
     GLint previous_id;
     glGetIntegerv(GL_TEXTURE_BINDING_2D, &previous_id);
 
-    glBindTexture(GL_TEXTURE_2D, texture_handle_);
+    // Rows of single-channel pixels are not aligned on 4 bytes
+    GLint previous_alignment;
+    glGetIntegerv(GL_UNPACK_ALIGNMENT, &previous_alignment);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    glBindTexture(GL_TEXTURE_2D, texture_handle);
     glTexSubImage2D(
-        GL_TEXTURE_2D, 0, rect_.left, rect_.top, rect_.width(), rect_.height(), GL_RGBA,
-        GL_UNSIGNED_BYTE, data);
+        GL_TEXTURE_2D, 0, rect.left, rect.top, rect.width(), rect.height(),
+        get_upload_format(format), GL_UNSIGNED_BYTE, data);
 
+    glPixelStorei(GL_UNPACK_ALIGNMENT, previous_alignment);
     glBindTexture(GL_TEXTURE_2D, previous_id);
 }
 
+void material::allocate_texture(const vector2ui& dimensions, pixel_format format) {
+    glTexImage2D(
+        GL_TEXTURE_2D, 0, static_cast<GLint>(get_internal_format(format)), dimensions.x,
+        dimensions.y, 0, get_upload_format(format), GL_UNSIGNED_BYTE, nullptr);
+}
+
 std::uint32_t material::get_handle() const {
     return texture_handle_;
 }
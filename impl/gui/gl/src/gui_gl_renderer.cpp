@@ -135,10 +135,40 @@ void renderer::set_view_(const matrix4f& view_matrix) {
 #endif
 }
 
-matrix4f renderer::get_view() const {
+matrix4f renderer::get_view_() const {
     return current_view_matrix_;
 }
 
+void renderer::set_distance_field_threshold_(
+    const std::optional<float>& threshold [[maybe_unused]]) {
+#if defined(LXGUI_OPENGL3)
+    // The threshold is sent to the shader when rendering
+    current_distance_field_threshold_ = threshold;
+#endif
+}
+
+bool renderer::is_scissor_supported() const {
+    return true;
+}
+
+void renderer::set_scissor_(const std::optional<bounds2f>& rect) {
+    if (!rect.has_value()) {
+        glDisable(GL_SCISSOR_TEST);
+        return;
+    }
+
+    // OpenGL counts rows from the bottom. Render targets are not flipped (see set_view_), so
+    // their first row is the top of the view; the main screen is flipped.
+    float bottom = rect->top;
+    if (!current_target_)
+        bottom = static_cast<float>(window_dimensions_.y) - rect->bottom;
+
+    glEnable(GL_SCISSOR_TEST);
+    glScissor(
+        static_cast<GLint>(rect->left), static_cast<GLint>(bottom),
+        static_cast<GLsizei>(rect->width()), static_cast<GLsizei>(rect->height()));
+}
+
 void renderer::render_quads_(
     const gui::material* mat, const std::vector<std::array<vertex, 4>>& quad_list) {
 
@@ -189,14 +219,15 @@ void renderer::render_quads_(
     cache->update(quad_list[0].data(), quad_list.size() * 4);
 
     // Render
-    render_cache_(mat, *cache, matrix4f::identity);
+    render_cache_(mat, *cache, matrix4f::identity, color::white);
 #endif
 }
 
 void renderer::render_cache_(
     const gui::material*     mat [[maybe_unused]],
     const gui::vertex_cache& cache [[maybe_unused]],
-    const matrix4f&          model_transform [[maybe_unused]]) {
+    const matrix4f&          model_transform [[maybe_unused]],
+    const color&             tint [[maybe_unused]]) {
 #if !defined(LXGUI_OPENGL3)
     throw gui::exception("gl::renderer", "Legacy OpenGL does not support vertex caches.");
 #else
@@ -206,7 +237,13 @@ void renderer::render_cache_(
     // Setup uniforms
     int type = 0;
     if (gl_mat) {
-        type = 0;
+        if (current_distance_field_threshold_.has_value())
+            type = 2;
+        else if (gl_mat->get_pixel_format() == gl::material::pixel_format::alpha)
+            type = 3;
+        else
+            type = 0;
+
         if (previous_texture_ != gl_mat->get_handle()) {
             gl_mat->bind();
             previous_texture_ = gl_mat->get_handle();
@@ -216,7 +253,11 @@ void renderer::render_cache_(
     }
 
     glUniform1i(shader_cache_->type_location, type);
+    if (type == 2) {
+        glUniform1f(shader_cache_->threshold_location, current_distance_field_threshold_.value());
+    }
     glUniformMatrix4fv(shader_cache_->model_location, 1, GL_FALSE, model_transform.data);
+    glUniform4f(shader_cache_->tint_location, tint.r, tint.g, tint.b, tint.a);
 
     // Render
     gl_cache.render();
@@ -232,8 +273,10 @@ renderer::create_material_(const std::string& file_name, material::filter filt)
     return create_material_png_(file_name, filt);
 }
 
-std::shared_ptr<gui::atlas> renderer::create_atlas_(material::filter filt) {
-    return std::make_shared<gl::atlas>(*this, filt);
+std::shared_ptr<gui::atlas> renderer::create_atlas_(material::filter filt, bool single_channel) {
+    return std::make_shared<gl::atlas>(
+        *this, filt,
+        single_channel ? gl::material::pixel_format::alpha : gl::material::pixel_format::rgba);
 }
 
 std::size_t renderer::get_texture_max_size() const {
@@ -275,6 +318,16 @@ std::shared_ptr<gui::font> renderer::create_font_(
     return std::make_shared<gl::font>(font_file, size, outline, code_points, default_code_point);
 }
 
+std::shared_ptr<gui::font> renderer::create_distance_field_font_(
+    const std::string&                   font_file,
+    std::size_t                          size,
+    std::size_t                          spread,
+    const std::vector<code_point_range>& code_points,
+    char32_t                             default_code_point) {
+    return std::make_shared<gl::font>(
+        font_file, size, 0u, code_points, default_code_point, spread);
+}
+
 bool renderer::is_texture_atlas_supported() const {
     return true;
 }
@@ -283,6 +336,15 @@ bool renderer::is_texture_vertex_color_supported() const {
     return true;
 }
 
+bool renderer::is_single_channel_font_supported() const {
+#if defined(LXGUI_OPENGL3)
+    return true;
+#else
+    // Atlases cannot read back from the single-channel textures of legacy OpenGL
+    return false;
+#endif
+}
+
 bool renderer::is_vertex_cache_supported() const {
 #if !defined(LXGUI_OPENGL3)
     return false;
@@ -291,12 +353,28 @@ bool renderer::is_vertex_cache_supported() const {
 #endif
 }
 
+bool renderer::is_packed_vertex_supported() const {
+#if !defined(LXGUI_OPENGL3)
+    return false;
+#else
+    return true;
+#endif
+}
+
+bool renderer::is_distance_field_supported() const {
+#if !defined(LXGUI_OPENGL3)
+    return false;
+#else
+    return true;
+#endif
+}
+
 std::shared_ptr<gui::vertex_cache> renderer::create_vertex_cache(gui::vertex_cache::type type
                                                                  [[maybe_unused]]) {
 #if !defined(LXGUI_OPENGL3)
     throw gui::exception("gl::renderer", "Legacy OpenGL does not support vertex caches.");
 #else
-    return std::make_shared<gl::vertex_cache>(type);
+    return std::make_shared<gl::vertex_cache>(type, is_packed_vertex_enabled());
 #endif
 }
 
@@ -419,12 +497,13 @@ void renderer::compile_programs_() {
                                "layout(location = 2) in vec2 a_texCoord;                  \n"
                                "uniform mat4 m_proj;                                      \n"
                                "uniform mat4 m_model;                                     \n"
+                               "uniform vec4 c_tint;                                      \n"
                                "out vec4 v_color;                                         \n"
                                "out vec2 v_texCoord;                                      \n"
                                "void main()                                               \n"
                                "{                                                         \n"
                                "    gl_Position = m_proj*m_model*vec4(a_position.xy,0,1); \n"
-                               "    v_color = a_color;                                    \n"
+                               "    v_color = a_color*c_tint;                             \n"
                                "    v_color.rgb *= v_color.a;                             \n"
                                "    v_texCoord = a_texCoord;                              \n"
                                "}                                                         \n";
@@ -435,11 +514,19 @@ void renderer::compile_programs_() {
                                  "in vec2 v_texCoord;                                       \n"
                                  "layout(location = 0) out vec4 o_color;                    \n"
                                  "uniform mediump int i_type;                               \n"
+                                 "uniform float f_threshold;                                \n"
                                  "uniform sampler2D s_texture;                              \n"
                                  "void main()                                               \n"
                                  "{                                                         \n"
                                  "    if (i_type == 0)                                      \n"
                                  "        o_color = texture(s_texture, v_texCoord)*v_color; \n"
+                                 "    else if (i_type == 2) {                               \n"
+                                 "        float d = texture(s_texture, v_texCoord).r;       \n"
+                                 "        float w = 0.7*fwidth(d);                          \n"
+                                 "        float t = f_threshold;                            \n"
+                                 "        o_color = smoothstep(t - w, t + w, d)*v_color;    \n"
+                                 "    } else if (i_type == 3)                               \n"
+                                 "        o_color = texture(s_texture,v_texCoord).r*v_color;\n"
                                  "    else                                                  \n"
                                  "        o_color = v_color;                                \n"
                                  "}                                                         \n";
@@ -453,10 +540,13 @@ void renderer::compile_programs_() {
             throw;
         }
 
-        shader_cache_->sampler_location = glGetUniformLocation(shader_cache_->program, "s_texture");
-        shader_cache_->proj_location    = glGetUniformLocation(shader_cache_->program, "m_proj");
-        shader_cache_->model_location   = glGetUniformLocation(shader_cache_->program, "m_model");
-        shader_cache_->type_location    = glGetUniformLocation(shader_cache_->program, "i_type");
+        const std::uint32_t program       = shader_cache_->program;
+        shader_cache_->sampler_location   = glGetUniformLocation(program, "s_texture");
+        shader_cache_->proj_location      = glGetUniformLocation(program, "m_proj");
+        shader_cache_->model_location     = glGetUniformLocation(program, "m_model");
+        shader_cache_->type_location      = glGetUniformLocation(program, "i_type");
+        shader_cache_->tint_location      = glGetUniformLocation(program, "c_tint");
+        shader_cache_->threshold_location = glGetUniformLocation(program, "f_threshold");
 
         static_shader_cache = shader_cache_;
         shader_cached       = true;
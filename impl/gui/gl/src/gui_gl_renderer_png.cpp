@@ -2,11 +2,14 @@
 #include "lxgui/gui_out.hpp"
 #include "lxgui/impl/gui_gl_material.hpp"
 #include "lxgui/impl/gui_gl_renderer.hpp"
+#include "lxgui/utils_file_system.hpp"
 
-#include <fstream>
+#include <algorithm>
+#include <cstring>
 #include <iostream>
 #include <memory>
 #include <png.h>
+#include <string_view>
 
 namespace {
 [[noreturn]] void raise_error(png_struct* /*png*/, char const* message) {
@@ -14,8 +17,12 @@ namespace {
 }
 
 void read_data(png_structp read_struct, png_bytep data, png_size_t length) {
-    png_voidp p = png_get_io_ptr(read_struct);
-    static_cast<std::ifstream*>(p)->read(reinterpret_cast<char*>(data), length);
+    auto* input = static_cast<std::string_view*>(png_get_io_ptr(read_struct));
+    if (input->size() < length)
+        png_error(read_struct, "unexpected end of file");
+
+    std::memcpy(data, input->data(), length);
+    input->remove_prefix(length);
 }
 } // namespace
 
@@ -23,15 +30,19 @@ namespace lxgui::gui::gl {
 
 std::shared_ptr<gui::material>
 renderer::create_material_png_(const std::string& file_name, material::filter filt) const {
-    std::ifstream file(file_name, std::ios::binary);
-    if (!file.is_open()) {
+    const auto content = utils::read_file(file_name);
+    if (!content.has_value()) {
         throw gui::exception("gui::gl::manager", "Cannot find file '" + file_name + "'.");
     }
 
+    // Decode straight from the file content (possibly mapped from an archive)
+    std::string_view input = content->get_view();
+
     const std::size_t pngsigsize = 8;
     png_byte          signature[pngsigsize];
-    file.read(reinterpret_cast<char*>(signature), pngsigsize);
-    if (!file.good() || png_sig_cmp(signature, 0, pngsigsize) != 0) {
+    std::memset(signature, 0, pngsigsize);
+    std::memcpy(signature, input.data(), std::min(input.size(), pngsigsize));
+    if (input.size() < pngsigsize || png_sig_cmp(signature, 0, pngsigsize) != 0) {
         throw gui::exception(
             "gui::gl::manager", file_name + "' is not a valid PNG image: '" +
                                     std::string(std::begin(signature), std::end(signature)) + "'.");
@@ -49,7 +60,8 @@ renderer::create_material_png_(const std::string& file_name, material::filter fi
         if (!info_struct)
             throw gui::exception("gui::gl::manager", "'png_create_info_struct' failed.");
 
-        png_set_read_fn(read_struct, static_cast<png_voidp>(&file), read_data);
+        input.remove_prefix(pngsigsize);
+        png_set_read_fn(read_struct, static_cast<png_voidp>(&input), read_data);
 
         png_set_sig_bytes(read_struct, pngsigsize);
         png_read_info(read_struct, info_struct);
@@ -24,10 +24,12 @@
 #endif
 
 #include <array>
+#include <cstddef>
+#include <vector>
 
 namespace lxgui::gui::gl {
 
-vertex_cache::vertex_cache(type t) : gui::vertex_cache(t) {
+vertex_cache::vertex_cache(type t, bool packed) : gui::vertex_cache(t), packed_enabled_(packed) {
     glGenVertexArrays(1, &vertex_array_);
 
     std::array<std::uint32_t, 2> buffers;
@@ -39,18 +41,43 @@ vertex_cache::vertex_cache(type t) : gui::vertex_cache(t) {
 
     glBindBuffer(GL_ARRAY_BUFFER, vertex_buffer_);
     glEnableVertexAttribArray(0);
-    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(vertex), 0);
     glEnableVertexAttribArray(1);
-    glVertexAttribPointer(
-        1, 4, GL_FLOAT, GL_FALSE, sizeof(vertex),
-        reinterpret_cast<const void*>(sizeof(vector2f) * 2));
     glEnableVertexAttribArray(2);
-    glVertexAttribPointer(
-        2, 2, GL_FLOAT, GL_FALSE, sizeof(vertex), reinterpret_cast<const void*>(sizeof(vector2f)));
 
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, index_buffer_);
 
     glBindVertexArray(0);
+
+    set_vertex_layout_(false);
+}
+
+void vertex_cache::set_vertex_layout_(bool packed) {
+    glBindVertexArray(vertex_array_);
+    glBindBuffer(GL_ARRAY_BUFFER, vertex_buffer_);
+
+    if (packed) {
+        glVertexAttribPointer(
+            0, 2, GL_FLOAT, GL_FALSE, sizeof(packed_vertex),
+            reinterpret_cast<const void*>(offsetof(packed_vertex, pos)));
+        glVertexAttribPointer(
+            1, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(packed_vertex),
+            reinterpret_cast<const void*>(offsetof(packed_vertex, col)));
+        glVertexAttribPointer(
+            2, 2, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(packed_vertex),
+            reinterpret_cast<const void*>(offsetof(packed_vertex, uvs)));
+    } else {
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(vertex), 0);
+        glVertexAttribPointer(
+            1, 4, GL_FLOAT, GL_FALSE, sizeof(vertex),
+            reinterpret_cast<const void*>(sizeof(vector2f) * 2));
+        glVertexAttribPointer(
+            2, 2, GL_FLOAT, GL_FALSE, sizeof(vertex),
+            reinterpret_cast<const void*>(sizeof(vector2f)));
+    }
+
+    glBindVertexArray(0);
+
+    packed_layout_ = packed;
 }
 
 vertex_cache::~vertex_cache() {
@@ -60,16 +87,35 @@ vertex_cache::~vertex_cache() {
     glDeleteBuffers(buffers.size(), buffers.data());
 }
 
-void vertex_cache::update_data(const vertex* vertex_data, std::size_t num_vertex) {
+void vertex_cache::upload_data_(const void* data, std::size_t num_bytes) {
     glBindBuffer(GL_ARRAY_BUFFER, vertex_buffer_);
 
-    if (num_vertex > current_capacity_vertex_) {
-        glBufferData(GL_ARRAY_BUFFER, sizeof(vertex) * num_vertex, vertex_data, GL_DYNAMIC_DRAW);
-        current_capacity_vertex_ = num_vertex;
+    if (num_bytes > current_capacity_data_) {
+        glBufferData(GL_ARRAY_BUFFER, num_bytes, data, GL_DYNAMIC_DRAW);
+        current_capacity_data_ = num_bytes;
     } else {
-        glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(vertex) * num_vertex, vertex_data);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, num_bytes, data);
+    }
+}
+
+void vertex_cache::update_data(const vertex* vertex_data, std::size_t num_vertex) {
+    bool packed = false;
+    if (packed_enabled_) {
+        static thread_local std::vector<packed_vertex> packed_data;
+        if (packed_data.size() < num_vertex)
+            packed_data.resize(num_vertex);
+
+        packed = pack_vertices(vertex_data, num_vertex, packed_data.data());
+        if (packed)
+            upload_data_(packed_data.data(), sizeof(packed_vertex) * num_vertex);
     }
 
+    if (!packed)
+        upload_data_(vertex_data, sizeof(vertex) * num_vertex);
+
+    if (packed != packed_layout_)
+        set_vertex_layout_(packed);
+
     current_size_vertex_ = num_vertex;
 }
 
@@ -156,6 +202,10 @@ void vertex_cache::update(const vertex* vertex_data, std::size_t num_vertex) {
     }
 }
 
+bool vertex_cache::is_packed() const {
+    return packed_layout_;
+}
+
 void vertex_cache::render() const {
     glBindVertexArray(vertex_array_);
     glDrawElements(GL_TRIANGLES, current_size_index_, GL_UNSIGNED_INT, 0);
@@ -3,13 +3,39 @@
 #include "lxgui/gui_exception.hpp"
 #include "lxgui/gui_out.hpp"
 #include "lxgui/impl/gui_sdl_material.hpp"
+#include "lxgui/utils_file_system.hpp"
 #include "lxgui/utils_string.hpp"
 
 #include <SDL.h>
 #include <SDL_ttf.h>
+#include <limits>
+
+#if defined(SDL_TTF_VERSION_ATLEAST)
+#    if SDL_TTF_VERSION_ATLEAST(2, 0, 14)
+#        define LXGUI_SDL_TTF_HAS_KERNING
+#    endif
+#endif
 
 namespace lxgui::gui::sdl {
 
+namespace {
+
+#if defined(LXGUI_SDL_TTF_HAS_KERNING)
+float get_font_kerning(TTF_Font* fnt, char32_t c1, char32_t c2) {
+#    if SDL_TTF_VERSION_ATLEAST(2, 0, 18)
+    return static_cast<float>(TTF_GetFontKerningSizeGlyphs32(fnt, c1, c2));
+#    else
+    if (c1 > std::numeric_limits<Uint16>::max() || c2 > std::numeric_limits<Uint16>::max())
+        return 0.0f;
+
+    return static_cast<float>(TTF_GetFontKerningSizeGlyphs(
+        fnt, static_cast<Uint16>(c1), static_cast<Uint16>(c2)));
+#    endif
+}
+#endif
+
+} // namespace
+
 font::font(
     SDL_Renderer*                        renderer,
     const std::string&                   font_file,
@@ -24,7 +50,15 @@ font::font(
             "gui::sdl::font", "Could not initialise SDL_ttf: " + std::string(TTF_GetError()));
     }
 
-    TTF_Font* fnt = TTF_OpenFont(font_file.c_str(), size_);
+    // The font reads from this buffer, which must outlive it
+    auto content = utils::read_file(font_file);
+    if (!content.has_value())
+        throw gui::exception("gui::sdl::font", "Cannot find file '" + font_file + "'.");
+
+    content_ = std::move(*content);
+
+    SDL_RWops* input = SDL_RWFromConstMem(content_.data(), static_cast<int>(content_.size()));
+    TTF_Font*  fnt   = TTF_OpenFontRW(input, 1, size_);
     if (!fnt) {
         throw gui::exception(
             "gui::sdl::font", "Could not load font file '" + font_file + "' at size " +
@@ -184,7 +218,20 @@ font::font(
         range_list_.push_back(std::move(info));
     }
 
-    TTF_CloseFont(fnt);
+#if defined(LXGUI_SDL_TTF_HAS_KERNING)
+    // The font is only kept open if it has kerning, which is then read for each pair of
+    // characters the first time it is needed
+    if (TTF_GetFontKerning(fnt) != 0) {
+        font_    = fnt;
+        kerning_ = kerning_table(
+            [fnt](char32_t c1, char32_t c2) { return get_font_kerning(fnt, c1, c2); });
+    }
+#endif
+
+    if (!font_) {
+        TTF_CloseFont(fnt);
+        content_ = utils::file_content{};
+    }
 
     // Pre-multiply alpha
     if (pre_multiplied_alpha_supported) {
@@ -203,6 +250,11 @@ font::font(
     texture_->unlock_pointer();
 }
 
+font::~font() {
+    if (font_)
+        TTF_CloseFont(font_);
+}
+
 std::size_t font::get_size() const {
     return size_;
 }
@@ -255,8 +307,12 @@ float font::get_character_height(char32_t c) const {
     return info->rect.height();
 }
 
-float font::get_character_kerning(char32_t, char32_t) const {
-    // Note: SDL_ttf does not expose kerning
+float font::get_character_kerning(char32_t c1, char32_t c2) const {
+    // Note: the table is empty for SDL_ttf versions older than 2.0.14, which do not expose kerning
+    return kerning_.get(c1, c2);
+}
+
+float font::get_distance_field_spread() const {
     return 0.0f;
 }
 
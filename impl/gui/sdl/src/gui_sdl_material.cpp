@@ -3,6 +3,7 @@
 #include "lxgui/gui_exception.hpp"
 #include "lxgui/gui_out.hpp"
 #include "lxgui/impl/gui_sdl_renderer.hpp"
+#include "lxgui/utils_file_system.hpp"
 #include "lxgui/utils_string.hpp"
 
 #include <SDL.h>
@@ -79,7 +80,12 @@ material::material(
     filter             filt) :
     gui::material(false), renderer_(renderer), is_owner_(true) {
     // Load file
-    SDL_Surface* surface = IMG_Load(file_name.c_str());
+    const auto content = utils::read_file(file_name);
+    if (!content.has_value())
+        throw gui::exception("gui::sdl::material", "Could not open image file " + file_name + ".");
+
+    SDL_RWops*   input   = SDL_RWFromConstMem(content->data(), static_cast<int>(content->size()));
+    SDL_Surface* surface = IMG_Load_RW(input, 1);
     if (surface == nullptr) {
         throw gui::exception("gui::sdl::material", "Could not load image file " + file_name + ".");
     }
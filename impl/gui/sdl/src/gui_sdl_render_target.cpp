@@ -28,9 +28,19 @@ void render_target::end() {
 }
 
 void render_target::clear(const color& c) {
-    SDL_SetRenderDrawColor(texture_->get_renderer(), c.r * 255, c.g * 255, c.b * 255, c.a * 255);
-
-    SDL_RenderClear(texture_->get_renderer());
+    SDL_Renderer* rdr = texture_->get_renderer();
+    SDL_SetRenderDrawColor(rdr, c.r * 255, c.g * 255, c.b * 255, c.a * 255);
+
+    if (SDL_RenderIsClipEnabled(rdr) == SDL_TRUE) {
+        // SDL_RenderClear() ignores the clip rectangle; fill it without blending instead
+        SDL_BlendMode old_blend_mode = SDL_BLENDMODE_NONE;
+        SDL_GetRenderDrawBlendMode(rdr, &old_blend_mode);
+        SDL_SetRenderDrawBlendMode(rdr, SDL_BLENDMODE_NONE);
+        SDL_RenderFillRect(rdr, nullptr);
+        SDL_SetRenderDrawBlendMode(rdr, old_blend_mode);
+    } else {
+        SDL_RenderClear(rdr);
+    }
 }
 
 bounds2f render_target::get_rect() const {
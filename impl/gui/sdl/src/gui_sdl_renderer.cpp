@@ -8,13 +8,22 @@
 #include "lxgui/impl/gui_sdl_font.hpp"
 #include "lxgui/impl/gui_sdl_material.hpp"
 #include "lxgui/impl/gui_sdl_render_target.hpp"
+#include "lxgui/impl/gui_sdl_vertex_cache.hpp"
 #include "lxgui/utils_string.hpp"
 
 #include <SDL.h>
 #include <SDL_image.h>
 
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+#    define LXGUI_SDL_HAS_GEOMETRY
+#endif
+
 namespace lxgui::gui::sdl {
 
+#if defined(LXGUI_SDL_HAS_GEOMETRY)
+static_assert(sizeof(color32) == sizeof(SDL_Color), "color32 must match SDL_Color");
+#endif
+
 renderer::renderer(SDL_Renderer* rdr, bool initialise_sdl_image) : renderer_(rdr) {
     int window_width, window_height;
     SDL_GetRendererOutputSize(renderer_, &window_width, &window_height);
@@ -50,6 +59,15 @@ renderer::renderer(SDL_Renderer* rdr, bool initialise_sdl_image) : renderer_(rdr
              tex, (SDL_BlendMode)material::get_premultiplied_alpha_blend_mode()) == 0);
 
     SDL_DestroyTexture(tex);
+
+#if defined(LXGUI_SDL_HAS_GEOMETRY)
+    // Check that the SDL library we link to at runtime also supports geometry
+    SDL_version linked_version;
+    SDL_GetVersion(&linked_version);
+    geometry_supported_ =
+        SDL_VERSIONNUM(linked_version.major, linked_version.minor, linked_version.patch) >=
+        SDL_VERSIONNUM(2, 0, 18);
+#endif
 }
 
 std::string renderer::get_name() const {
@@ -86,10 +104,30 @@ void renderer::set_view_(const matrix4f& view_matrix) {
     view_matrix_     = view_matrix * matrix4f::invert(target_view_matrix_);
 }
 
-matrix4f renderer::get_view() const {
+matrix4f renderer::get_view_() const {
     return raw_view_matrix_;
 }
 
+bool renderer::is_scissor_supported() const {
+    return true;
+}
+
+void renderer::set_scissor_(const std::optional<bounds2f>& rect) {
+    if (!rect.has_value()) {
+        SDL_RenderSetClipRect(renderer_, nullptr);
+        return;
+    }
+
+    SDL_Rect clip;
+    clip.x = static_cast<int>(rect->left);
+    clip.y = static_cast<int>(rect->top);
+    clip.w = static_cast<int>(rect->width());
+    clip.h = static_cast<int>(rect->height());
+    SDL_RenderSetClipRect(renderer_, &clip);
+}
+
+void renderer::set_distance_field_threshold_(const std::optional<float>& /*threshold*/) {}
+
 color premultiply_alpha(const color& c, bool pre_multiplied_alpha_supported) {
     if (pre_multiplied_alpha_supported)
         return color(c.r * c.a, c.g * c.a, c.b * c.a, c.a);
@@ -434,18 +472,198 @@ void renderer::render_quad_(const sdl::material* mat, const std::array<vertex, 4
     }
 }
 
+namespace {
+
+bool needs_repeat_wrap(const sdl::material* mat, const std::array<vertex, 4>& vertex_list) {
+    if (!mat || mat->get_wrap() != material::wrap::repeat)
+        return false;
+
+    constexpr float epsilon = 1e-4f;
+    for (const auto& v : vertex_list) {
+        if (v.uvs.x < -epsilon || v.uvs.x > 1.0f + epsilon || v.uvs.y < -epsilon ||
+            v.uvs.y > 1.0f + epsilon) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+} // namespace
+
+void renderer::set_blend_mode_(const sdl::material* mat) {
+    const SDL_BlendMode blend_mode =
+        pre_multiplied_alpha_supported_
+            ? static_cast<SDL_BlendMode>(material::get_premultiplied_alpha_blend_mode())
+            : SDL_BLENDMODE_BLEND;
+
+    if (mat) {
+        SDL_Texture* tex = mat->get_texture();
+        if (SDL_SetTextureBlendMode(tex, blend_mode) != 0) {
+            throw gui::exception("gui::sdl::renderer", "Could not set texture blend mode.");
+        }
+
+        // Colors are given for each vertex; reset any modulation left by render_quad_()
+        SDL_SetTextureColorMod(tex, 255, 255, 255);
+        SDL_SetTextureAlphaMod(tex, 255);
+    } else {
+        SDL_SetRenderDrawBlendMode(renderer_, blend_mode);
+    }
+}
+
+const int* renderer::get_quad_index_list_(std::size_t num_quads) {
+    static constexpr std::array<int, 6> quad_ids = {{0, 1, 2, 2, 3, 0}};
+
+    const std::size_t old_num_quads = quad_index_list_.size() / 6u;
+    if (num_quads > old_num_quads) {
+        quad_index_list_.resize(num_quads * 6u);
+        for (std::size_t k = old_num_quads; k < num_quads; ++k) {
+            for (std::size_t i = 0; i < quad_ids.size(); ++i)
+                quad_index_list_[k * 6u + i] = static_cast<int>(k * 4u) + quad_ids[i];
+        }
+    }
+
+    return quad_index_list_.data();
+}
+
+void renderer::render_geometry_(
+    const sdl::material*   mat,
+    const float*           position_data,
+    std::size_t            position_stride,
+    const geometry_vertex* vertex_data,
+    std::size_t            num_vertex,
+    bool                   quads) {
+#if defined(LXGUI_SDL_HAS_GEOMETRY)
+    if (num_vertex == 0u)
+        return;
+
+    set_blend_mode_(mat);
+
+    const std::size_t num_quads   = num_vertex / 4u;
+    const int*        index_data  = quads ? get_quad_index_list_(num_quads) : nullptr;
+    const std::size_t num_indices = quads ? num_quads * 6u : 0u;
+
+    const int vertex_stride = static_cast<int>(sizeof(geometry_vertex));
+
+    if (SDL_RenderGeometryRaw(
+            renderer_, mat ? mat->get_texture() : nullptr, position_data,
+            static_cast<int>(position_stride),
+            reinterpret_cast<const SDL_Color*>(&vertex_data->col), vertex_stride,
+            &vertex_data->uvs.x, vertex_stride, static_cast<int>(num_vertex), index_data,
+            static_cast<int>(num_indices), static_cast<int>(sizeof(int))) != 0) {
+        throw gui::exception(
+            "gui::sdl::renderer", "Could not render geometry: " + std::string(SDL_GetError()));
+    }
+#else
+    throw gui::exception(
+        "gui::sdl::renderer", "SDL_RenderGeometry requires SDL 2.0.18 or later.");
+#endif
+}
+
+void renderer::render_quads_geometry_(
+    const sdl::material* mat, const std::vector<std::array<vertex, 4>>& quad_list) {
+
+    geometry_vertex_list_.clear();
+    geometry_vertex_list_.reserve(quad_list.size() * 4u);
+
+    auto flush = [&]() {
+        if (geometry_vertex_list_.empty())
+            return;
+
+        render_geometry_(
+            mat, &geometry_vertex_list_[0].pos.x, sizeof(geometry_vertex),
+            geometry_vertex_list_.data(), geometry_vertex_list_.size(), true);
+
+        geometry_vertex_list_.clear();
+    };
+
+    for (const auto& vertex_list : quad_list) {
+        if (needs_repeat_wrap(mat, vertex_list)) {
+            // SDL_RenderGeometry clamps texture coordinates, so quads which rely on
+            // repeat wrapping must still go through the slower path, in order.
+            flush();
+            render_quad_(mat, vertex_list);
+            continue;
+        }
+
+        for (const auto& v : vertex_list) {
+            geometry_vertex_list_.push_back(
+                vertex_cache::to_sdl(v, pre_multiplied_alpha_supported_));
+            geometry_vertex_list_.back().pos = v.pos * view_matrix_;
+        }
+    }
+
+    flush();
+}
+
 void renderer::render_quads_(
     const gui::material* mat, const std::vector<std::array<vertex, 4>>& quad_list) {
 
     const sdl::material* sdl_mat = static_cast<const sdl::material*>(mat);
 
+    if (geometry_supported_) {
+        render_quads_geometry_(sdl_mat, quad_list);
+        return;
+    }
+
     for (std::size_t k = 0; k < quad_list.size(); ++k) {
         render_quad_(sdl_mat, quad_list[k]);
     }
 }
 
-void renderer::render_cache_(const gui::material*, const gui::vertex_cache&, const matrix4f&) {
-    throw gui::exception("gui::sdl::renderer", "SDL does not support vertex caches.");
+void renderer::render_cache_(
+    const gui::material*     mat,
+    const gui::vertex_cache& cache,
+    const matrix4f&          model_transform,
+    const color&             tint) {
+    if (!geometry_supported_)
+        throw gui::exception("gui::sdl::renderer", "SDL does not support vertex caches.");
+
+    const sdl::material*     sdl_mat   = static_cast<const sdl::material*>(mat);
+    const sdl::vertex_cache& sdl_cache = static_cast<const sdl::vertex_cache&>(cache);
+
+    const auto& vertex_list = sdl_cache.get_vertex_list();
+    if (vertex_list.empty())
+        return;
+
+    const matrix4f transform = model_transform * view_matrix_;
+    const bool     is_quads  = sdl_cache.get_type() == vertex_cache::type::quads;
+
+    if (tint != color::white) {
+        // SDL has no per-draw color modulation for geometry, so the tint is applied here
+        // on a copy of the vertices. Cached colors are already pre-multiplied by alpha
+        // when supported, hence the tint must be pre-multiplied too.
+        const float rgb_factor = pre_multiplied_alpha_supported_ ? tint.a : 1.0f;
+        const float r          = tint.r * rgb_factor;
+        const float g          = tint.g * rgb_factor;
+        const float b          = tint.b * rgb_factor;
+
+        geometry_vertex_list_.resize(vertex_list.size());
+        for (std::size_t i = 0; i < vertex_list.size(); ++i) {
+            const auto& in  = vertex_list[i];
+            auto&       out = geometry_vertex_list_[i];
+            out.pos         = in.pos * transform;
+            out.uvs         = in.uvs;
+            out.col.r       = static_cast<color32::chanel>(in.col.r * r);
+            out.col.g       = static_cast<color32::chanel>(in.col.g * g);
+            out.col.b       = static_cast<color32::chanel>(in.col.b * b);
+            out.col.a       = static_cast<color32::chanel>(in.col.a * tint.a);
+        }
+
+        render_geometry_(
+            sdl_mat, &geometry_vertex_list_[0].pos.x, sizeof(geometry_vertex),
+            geometry_vertex_list_.data(), geometry_vertex_list_.size(), is_quads);
+        return;
+    }
+
+    // Only positions need transforming; colors and UVs are used straight from the cache
+    geometry_position_list_.resize(vertex_list.size());
+    for (std::size_t i = 0; i < vertex_list.size(); ++i)
+        geometry_position_list_[i] = vertex_list[i].pos * transform;
+
+    render_geometry_(
+        sdl_mat, &geometry_position_list_[0].x, sizeof(vector2f), vertex_list.data(),
+        vertex_list.size(), is_quads);
 }
 
 SDL_Renderer* renderer::get_sdl_renderer() const {
@@ -458,7 +676,8 @@ renderer::create_material_(const std::string& file_name, material::filter filt)
         renderer_, file_name, pre_multiplied_alpha_supported_, material::wrap::repeat, filt);
 }
 
-std::shared_ptr<gui::atlas> renderer::create_atlas_(material::filter filt) {
+std::shared_ptr<gui::atlas>
+renderer::create_atlas_(material::filter filt, bool single_channel [[maybe_unused]]) {
     return std::make_shared<sdl::atlas>(*this, filt);
 }
 
@@ -471,13 +690,29 @@ bool renderer::is_texture_atlas_supported() const {
 }
 
 bool renderer::is_texture_vertex_color_supported() const {
+    return geometry_supported_;
+}
+
+bool renderer::is_single_channel_font_supported() const {
     return false;
 }
 
 bool renderer::is_vertex_cache_supported() const {
+    return geometry_supported_;
+}
+
+bool renderer::is_packed_vertex_supported() const {
     return false;
 }
 
+bool renderer::is_distance_field_supported() const {
+    return false;
+}
+
+bool renderer::is_geometry_supported() const {
+    return geometry_supported_;
+}
+
 std::shared_ptr<gui::material> renderer::create_material(
     const vector2ui& dimensions, const color32* pixel_data, material::filter filt) {
     std::shared_ptr<sdl::material> tex =
@@ -524,8 +759,20 @@ std::shared_ptr<gui::font> renderer::create_font_(
         pre_multiplied_alpha_supported_);
 }
 
-std::shared_ptr<gui::vertex_cache> renderer::create_vertex_cache(gui::vertex_cache::type) {
-    throw gui::exception("gui::sdl::renderer", "SDL does not support vertex caches.");
+std::shared_ptr<gui::font> renderer::create_distance_field_font_(
+    const std::string& /*font_file*/,
+    std::size_t /*size*/,
+    std::size_t /*spread*/,
+    const std::vector<code_point_range>& /*code_points*/,
+    char32_t /*default_code_point*/) {
+    throw gui::exception("gui::sdl::renderer", "SDL does not support distance field fonts.");
+}
+
+std::shared_ptr<gui::vertex_cache> renderer::create_vertex_cache(gui::vertex_cache::type t) {
+    if (!geometry_supported_)
+        throw gui::exception("gui::sdl::renderer", "SDL does not support vertex caches.");
+
+    return std::make_shared<sdl::vertex_cache>(t, pre_multiplied_alpha_supported_);
 }
 
 void renderer::notify_window_resized(const vector2ui& new_dimensions) {
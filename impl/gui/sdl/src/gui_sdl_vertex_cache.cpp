@@ -0,0 +1,38 @@
+#include "lxgui/impl/gui_sdl_vertex_cache.hpp"
+
+namespace lxgui::gui::sdl {
+
+vertex_cache::vertex_cache(type t, bool pre_multiplied_alpha_supported) :
+    gui::vertex_cache(t), pre_multiplied_alpha_supported_(pre_multiplied_alpha_supported) {}
+
+geometry_vertex vertex_cache::to_sdl(const vertex& v, bool pre_multiplied_alpha_supported) {
+    const float a = v.col.a;
+    const float f = pre_multiplied_alpha_supported ? a * 255.0f : 255.0f;
+
+    geometry_vertex sv;
+    sv.pos   = v.pos;
+    sv.col.r = static_cast<color32::chanel>(v.col.r * f);
+    sv.col.g = static_cast<color32::chanel>(v.col.g * f);
+    sv.col.b = static_cast<color32::chanel>(v.col.b * f);
+    sv.col.a = static_cast<color32::chanel>(a * 255.0f);
+    sv.uvs   = v.uvs;
+    return sv;
+}
+
+void vertex_cache::update(const vertex* vertex_data, std::size_t num_vertex) {
+    vertex_list_.resize(num_vertex);
+    for (std::size_t i = 0; i < num_vertex; ++i)
+        vertex_list_[i] = to_sdl(vertex_data[i], pre_multiplied_alpha_supported_);
+
+    num_vertex_ = num_vertex;
+}
+
+vertex_cache::type vertex_cache::get_type() const {
+    return type_;
+}
+
+const std::vector<geometry_vertex>& vertex_cache::get_vertex_list() const {
+    return vertex_list_;
+}
+
+} // namespace lxgui::gui::sdl
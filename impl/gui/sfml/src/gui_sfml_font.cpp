@@ -3,6 +3,7 @@
 #include "lxgui/gui_exception.hpp"
 #include "lxgui/gui_out.hpp"
 #include "lxgui/impl/gui_sfml_material.hpp"
+#include "lxgui/utils_file_system.hpp"
 #include "lxgui/utils_string.hpp"
 
 namespace lxgui::gui::sfml {
@@ -17,7 +18,12 @@ font::font(
     outline_(outline),
     default_code_point_(default_code_point),
     code_points_(code_points) {
-    if (!font_.loadFromFile(font_file)) {
+    if (auto content = utils::read_file(font_file))
+        content_ = std::move(content.value());
+    else
+        throw gui::exception("gui::sfml::font", "Cannot find file '" + font_file + "'.");
+
+    if (!font_.loadFromMemory(content_.data(), content_.size())) {
         throw gui::exception("gui::sfml::font", "Could not load font file '" + font_file + "'.");
     }
 
@@ -32,6 +38,11 @@ font::font(
     sf::Image data = font_.getTexture(size_).copyToImage();
     sfml::material::premultiply_alpha(data);
     texture_ = std::make_shared<sfml::material>(data);
+
+    // Kerning is read for each pair of characters the first time it is needed, so text layout
+    // does not query FreeType through SFML every time
+    kerning_ = kerning_table(
+        [this](char32_t c1, char32_t c2) { return font_.getKerning(c1, c2, size_); });
 }
 
 std::size_t font::get_size() const {
@@ -124,7 +135,11 @@ float font::get_character_kerning(char32_t c1, char32_t c2) const {
     if (c1 == 0 || c2 == 0)
         return 0.0f;
 
-    return font_.getKerning(c1, c2, size_);
+    return kerning_.get(c1, c2);
+}
+
+float font::get_distance_field_spread() const {
+    return 0.0f;
 }
 
 std::weak_ptr<gui::material> font::get_texture() const {
@@ -3,6 +3,7 @@
 #include "lxgui/gui_exception.hpp"
 #include "lxgui/gui_out.hpp"
 #include "lxgui/impl/gui_sfml_renderer.hpp"
+#include "lxgui/utils_file_system.hpp"
 #include "lxgui/utils_string.hpp"
 
 namespace lxgui::gui::sfml {
@@ -62,8 +63,12 @@ material::material(const sf::Image& data, wrap wrp, filter filt) : gui::material
 
 material::material(const std::string& file_name, wrap wrp, filter filt) : gui::material(false) {
     is_render_target_ = false;
+    const auto content = utils::read_file(file_name);
+    if (!content.has_value())
+        throw utils::exception("gui::sfml::material", "cannot open '" + file_name + "'.");
+
     sf::Image data;
-    if (!data.loadFromFile(file_name))
+    if (!data.loadFromMemory(content->data(), content->size()))
         throw utils::exception("gui::sfml::material", "loading failed: '" + file_name + "'.");
 
     premultiply_alpha(data);
@@ -65,7 +65,7 @@ void renderer::set_view_(const matrix4f& view_matrix) {
     current_sfml_target_->setView(view);
 }
 
-matrix4f renderer::get_view() const {
+matrix4f renderer::get_view_() const {
     matrix4f current_view_matrix =
         matrix4f(current_sfml_target_->getView().getTransform().getMatrix());
 
@@ -78,6 +78,14 @@ matrix4f renderer::get_view() const {
     return current_view_matrix;
 }
 
+bool renderer::is_scissor_supported() const {
+    return false;
+}
+
+void renderer::set_scissor_(const std::optional<bounds2f>& /*rect*/) {}
+
+void renderer::set_distance_field_threshold_(const std::optional<float>& /*threshold*/) {}
+
 void renderer::render_quads_(
     const gui::material* mat, const std::vector<std::array<vertex, 4>>& quad_list) {
     static const std::array<std::size_t, 6> ids          = {{0, 1, 2, 2, 3, 0}};
@@ -128,7 +136,8 @@ sf::Transform to_sfml(const matrix4f& matrix) {
 void renderer::render_cache_(
     const gui::material*     mat [[maybe_unused]],
     const gui::vertex_cache& cache [[maybe_unused]],
-    const matrix4f&          model_transform [[maybe_unused]]) {
+    const matrix4f&          model_transform [[maybe_unused]],
+    const color&             tint [[maybe_unused]]) {
 #if defined(SFML_HAS_NORMALISED_COORDINATES_VBO)
     const sfml::material*     sf_mat   = static_cast<const sfml::material*>(mat);
     const sfml::vertex_cache& sf_cache = static_cast<const sfml::vertex_cache&>(cache);
@@ -136,6 +145,7 @@ void renderer::render_cache_(
     // Note: the following will not work correctly, as vertex_cache has texture coordinates
     // normalized, but sf::RenderTarget::draw assumes coordinates in pixels.
     // Requires https://github.com/SFML/SFML/pull/1807
+    // The tint is not applied either, as this would require a custom shader.
     sf::RenderStates state;
     // Premultiplied alpha
     state.blendMode = sf::BlendMode(sf::BlendMode::One, sf::BlendMode::OneMinusSrcAlpha);
@@ -153,7 +163,8 @@ renderer::create_material_(const std::string& file_name, material::filter filt)
     return std::make_shared<sfml::material>(file_name, material::wrap::repeat, filt);
 }
 
-std::shared_ptr<gui::atlas> renderer::create_atlas_(material::filter filt) {
+std::shared_ptr<gui::atlas>
+renderer::create_atlas_(material::filter filt, bool single_channel [[maybe_unused]]) {
     return std::make_shared<sfml::atlas>(*this, filt);
 }
 
@@ -169,6 +180,10 @@ bool renderer::is_texture_vertex_color_supported() const {
     return true;
 }
 
+bool renderer::is_single_channel_font_supported() const {
+    return false;
+}
+
 std::shared_ptr<gui::material> renderer::create_material(
     const vector2ui& dimensions, const color32* pixel_data, material::filter filt) {
     std::shared_ptr<sfml::material> tex =
@@ -204,6 +219,15 @@ std::shared_ptr<gui::font> renderer::create_font_(
     return std::make_shared<sfml::font>(font_file, size, outline, code_points, default_code_point);
 }
 
+std::shared_ptr<gui::font> renderer::create_distance_field_font_(
+    const std::string& /*font_file*/,
+    std::size_t /*size*/,
+    std::size_t /*spread*/,
+    const std::vector<code_point_range>& /*code_points*/,
+    char32_t /*default_code_point*/) {
+    throw gui::exception("gui::sfml::renderer", "SFML does not support distance field fonts.");
+}
+
 bool renderer::is_vertex_cache_supported() const {
 #if defined(SFML_HAS_NORMALISED_COORDINATES_VBO)
     // Requires https://github.com/SFML/SFML/pull/1807
@@ -213,6 +237,14 @@ bool renderer::is_vertex_cache_supported() const {
 #endif
 }
 
+bool renderer::is_packed_vertex_supported() const {
+    return false;
+}
+
+bool renderer::is_distance_field_supported() const {
+    return false;
+}
+
 std::shared_ptr<gui::vertex_cache> renderer::create_vertex_cache(gui::vertex_cache::type type
                                                                  [[maybe_unused]]) {
 #if defined(SFML_HAS_NORMALISED_COORDINATES_VBO)
@@ -1,6 +1,7 @@
 #include "lxgui/impl/input_sdl_source.hpp"
 
 #include "lxgui/gui_exception.hpp"
+#include "lxgui/utils_file_system.hpp"
 #include "lxgui/utils_string.hpp"
 
 #include <SDL_clipboard.h>
@@ -47,7 +48,15 @@ void source::set_mouse_cursor(const std::string& file_name, const gui::vector2i&
     auto iter = cursor_map_.find(file_name);
     if (iter == cursor_map_.end()) {
         // Load file
-        SDL_Surface* surface = IMG_Load(file_name.c_str());
+        const auto content = utils::read_file(file_name);
+        if (!content.has_value()) {
+            throw gui::exception(
+                "input::sdl::source", "Could not open image file " + file_name + ".");
+        }
+
+        SDL_RWops* input =
+            SDL_RWFromConstMem(content->data(), static_cast<int>(content->size()));
+        SDL_Surface* surface = IMG_Load_RW(input, 1);
         if (surface == nullptr) {
             throw gui::exception(
                 "input::sdl::source", "Could not load image file " + file_name + ".");
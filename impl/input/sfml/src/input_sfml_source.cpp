@@ -1,6 +1,7 @@
 #include "lxgui/impl/input_sfml_source.hpp"
 
 #include "lxgui/gui_exception.hpp"
+#include "lxgui/utils_file_system.hpp"
 #include "lxgui/utils_string.hpp"
 
 #include <SFML/Graphics/Image.hpp>
@@ -30,8 +31,9 @@ void source::set_clipboard_content(const utils::ustring& content) {
 void source::set_mouse_cursor(const std::string& file_name, const gui::vector2i& hot_spot) {
     auto iter = cursor_map_.find(file_name);
     if (iter == cursor_map_.end()) {
-        sf::Image image;
-        if (!image.loadFromFile(file_name)) {
+        const auto content = utils::read_file(file_name);
+        sf::Image  image;
+        if (!content.has_value() || !image.loadFromMemory(content->data(), content->size())) {
             throw gui::exception(
                 "input::sfml::source", "Could not load cursor file '" + file_name + "'.");
         }
@@ -2,10 +2,16 @@
 #define LXGUI_GUI_ADDON_REGISTRY_HPP
 
 #include "lxgui/gui_addon.hpp"
+#include "lxgui/gui_saved_variables.hpp"
 #include "lxgui/lxgui.hpp"
+#include "lxgui/utils_observer.hpp"
 
+#include <iosfwd>
+#include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 /** \cond INCLUDE_INTERNALS_IN_DOC
@@ -22,6 +28,7 @@ namespace lxgui::gui {
 
 class localizer;
 class event_emitter;
+class frame;
 class root;
 class virtual_root;
 
@@ -39,6 +46,9 @@ public:
     addon_registry(
         sol::state& lua, localizer& loc, event_emitter& emitter, root& r, virtual_root& vr);
 
+    /// Destructor.
+    ~addon_registry();
+
     addon_registry(const addon_registry&) = delete;
     addon_registry(addon_registry&&)      = delete;
     addon_registry& operator=(const addon_registry&) = delete;
@@ -50,6 +60,9 @@ public:
      * \note The directory must contain a file named addon.txt, and
      * listing all enabled (and possibly disabled) addons.
      * Each addon is then a sub-directory.
+     * \note The TOC files and layout files of all the enabled addons are first parsed in
+     * parallel (see utils::parallel_for()). Frames are then created, and Lua scripts executed,
+     * on the calling thread and in the same order as if the files were parsed sequentially.
      */
     void load_addon_directory(const std::string& directory);
 
@@ -69,16 +82,71 @@ public:
      */
     void set_current_addon(const addon* a);
 
-    /// Save Lua variables registred for saving for all addons.
+    /**
+     * \brief Sets the file format used to save the variables of addons.
+     * \param format The new format
+     * \note When loading an addon, the saved variables file in this format is used if it
+     * exists. Otherwise, the file in the other format is used, if it exists.
+     */
+    void set_saved_variables_format(saved_variables_format format);
+
+    /**
+     * \brief Returns the file format used to save the variables of addons.
+     * \return The file format used to save the variables of addons
+     */
+    saved_variables_format get_saved_variables_format() const;
+
+    /// Save Lua variables registred for saving for all addons (immediately).
     void save_variables() const;
 
+    /**
+     * \brief Save Lua variables registred for saving for all addons.
+     * \param writer The writer to use to write the files
+     * \note The variables are serialized on the calling thread, then the files are handed to
+     * the writer, which may write them in the background.
+     */
+    void save_variables(saved_variables_writer& writer) const;
+
+    /**
+     * \brief Loads again addon files which have been modified, without closing the UI.
+     * \param file_list The modified files (see utils::file_watcher)
+     * \return 'true' if all files could be reloaded, 'false' if the UI must be reloaded instead
+     * \note Lua scripts are executed again. For layout files, the frames created by the file (and
+     * its included files) are destroyed, then the file is parsed and its frames created again.
+     * Frames created by Lua code are not affected. Files which are not used by any addon are
+     * ignored, except new or modified TOC files, addon lists, translations, textures, and fonts,
+     * as well as layout files defining virtual frames: these require a full reload, and nothing
+     * is reloaded.
+     */
+    bool reload_files(const std::vector<std::string>& file_list);
+
 private:
-    void load_addon_toc_(const std::string& addon_name, const std::string& addon_directory);
+    struct parsed_layout_file;
+
+    struct loaded_file {
+        const addon*                            add_on             = nullptr;
+        bool                                    is_script          = false;
+        bool                                    has_virtual_frames = false;
+        std::vector<utils::observer_ptr<frame>> frame_list;
+        std::vector<std::string>                include_list;
+    };
+
+    static std::optional<addon> parse_addon_toc_(
+        const std::string& addon_name, const std::string& addon_directory, std::ostream& log);
+
     void load_addon_files_(const addon& a);
 
-    void save_variables_(const addon& a) const noexcept;
+    void run_script_(const std::string& file_name);
+
+    void load_saved_variables_(const addon& a);
+
+    std::optional<saved_variables_writer::file> save_variables_(const addon& a) const noexcept;
 
+    void parse_layout_files_(std::vector<std::pair<std::string, std::string>> file_list);
     void parse_layout_file_(const std::string& file_name, const addon& a);
+    void unload_layout_file_(const std::string& file_name);
+
+    bool has_virtual_frames_(const std::string& file_name) const;
 
     template<typename T>
     using string_map = std::unordered_map<std::string, T>;
@@ -89,8 +157,12 @@ private:
     root&          root_;
     virtual_root&  virtual_root_;
 
-    const addon*                  current_addon_ = nullptr;
+    const addon*                  current_addon_          = nullptr;
+    saved_variables_format        saved_variables_format_ = saved_variables_format::lua;
     string_map<string_map<addon>> addon_list_;
+
+    string_map<std::unique_ptr<parsed_layout_file>> parsed_layout_file_list_;
+    string_map<loaded_file>                         loaded_file_list_;
 };
 
 } // namespace lxgui::gui
@@ -0,0 +1,286 @@
+#ifndef LXGUI_GUI_ANIMATION_HPP
+#define LXGUI_GUI_ANIMATION_HPP
+
+#include "lxgui/gui_color.hpp"
+#include "lxgui/gui_matrix4.hpp"
+#include "lxgui/gui_vector2.hpp"
+#include "lxgui/lxgui.hpp"
+#include "lxgui/utils_observer.hpp"
+#include "lxgui/utils_signal.hpp"
+
+#include <optional>
+#include <string>
+#include <vector>
+
+/** \cond INCLUDE_INTERNALS_IN_DOC
+ */
+namespace sol {
+
+class state;
+
+}
+/** \endcond
+ */
+
+namespace lxgui::gui {
+
+class region;
+class root;
+
+/// Curve used to interpolate an animation between its start and end values.
+enum class easing {
+    linear,
+    in_quad,
+    out_quad,
+    in_out_quad,
+    in_cubic,
+    out_cubic,
+    in_out_cubic,
+    in_sine,
+    out_sine,
+    in_out_sine
+};
+
+/**
+ * \brief Applies an easing curve to a linear progress value.
+ * \param curve The easing curve
+ * \param t The linear progress, between 0 and 1
+ * \return The eased progress, between 0 and 1
+ */
+float apply_easing(easing curve, float t) noexcept;
+
+/// Property of a region modified by an animation.
+enum class animation_type {
+    /// Multiplies the alpha of the region
+    alpha,
+    /// Moves the region, at render time
+    translation,
+    /// Scales the region around its center, at render time
+    scale,
+    /// Changes the color of the region (texture vertex color, or font_string text color)
+    color
+};
+
+/// What an animation group does when it reaches its end.
+enum class animation_loop {
+    /// Stop at the end
+    none,
+    /// Start again from the beginning
+    repeat,
+    /// Play backwards, then forward again, etc.
+    bounce
+};
+
+/// A single track of an animation group.
+struct animation {
+    animation_type type        = animation_type::alpha;
+    easing         curve       = easing::linear;
+    float          start_delay = 0.0f;
+    float          duration    = 0.0f;
+
+    float    from_alpha = 1.0f;
+    float    to_alpha   = 1.0f;
+    vector2f offset     = vector2f::zero;
+    vector2f from_scale = vector2f::unit;
+    vector2f to_scale   = vector2f::unit;
+    color    from_color = color::white;
+    color    to_color   = color::white;
+
+    /**
+     * \brief Returns the time at which this animation ends, relative to the group start.
+     * \return The time at which this animation ends
+     */
+    float get_end_time() const noexcept;
+
+    /**
+     * \brief Returns the eased progress of this animation at a given time.
+     * \param time The time since the start of the group
+     * \return The eased progress, between 0 (before start) and 1 (after end)
+     */
+    float get_progress(float time) const noexcept;
+};
+
+/**
+ * \brief A set of animations played together on a region.
+ * \details Animation groups are owned by a region, and created with
+ * region::create_animation_group(). They can contain any number of alpha, translation,
+ * scale, and color animations, which all start when the group is played, after their own
+ * start delay. Groups that are playing are updated by the root in a single loop, at the
+ * start of root::update().
+ *
+ * Translation and scale animations are applied at render time, as a transformation of
+ * the region and its children. They do not modify the anchors or borders of the region,
+ * hence do not trigger any layout update. As a consequence, they also do not affect mouse
+ * input: the region still reacts to the mouse at its original position.
+ *
+ * The state of the region before the animation started is remembered, and restored when
+ * the group is stopped with stop(). A group that reaches its end without looping keeps
+ * its final state.
+ *
+ * Several groups of the same region can play at once. Their alpha factors are multiplied,
+ * and their transformations are combined in the order the groups were created. Colors
+ * cannot be combined: the last created group with a color animation sets the color.
+ */
+class animation_group : public utils::enable_observer_from_this<animation_group> {
+    friend root;
+    friend region;
+
+public:
+    /**
+     * \brief Constructor.
+     * \param block The observer control block
+     * \param owner The region to animate
+     * \param name The name of this group
+     */
+    animation_group(utils::control_block& block, region& owner, std::string name);
+
+    // Non-copiable, non-movable
+    animation_group(const animation_group&) = delete;
+    animation_group(animation_group&&)      = delete;
+    animation_group& operator=(const animation_group&) = delete;
+    animation_group& operator=(animation_group&&) = delete;
+
+    /**
+     * \brief Returns the name of this group.
+     * \return The name of this group
+     */
+    const std::string& get_name() const;
+
+    /**
+     * \brief Returns the region animated by this group.
+     * \return The region animated by this group
+     */
+    region& get_owner() {
+        return owner_;
+    }
+
+    /**
+     * \brief Returns the region animated by this group.
+     * \return The region animated by this group
+     */
+    const region& get_owner() const {
+        return owner_;
+    }
+
+    /**
+     * \brief Adds a new animation to this group.
+     * \param anim The animation to add
+     */
+    void add_animation(const animation& anim);
+
+    /**
+     * \brief Returns the list of animations in this group.
+     * \return The list of animations in this group
+     */
+    const std::vector<animation>& get_animations() const;
+
+    /// Removes all the animations from this group (stops the group if playing).
+    void clear_animations();
+
+    /**
+     * \brief Sets what this group does when it reaches its end.
+     * \param looping The looping mode
+     */
+    void set_looping(animation_loop looping);
+
+    /**
+     * \brief Returns what this group does when it reaches its end.
+     * \return The looping mode
+     */
+    animation_loop get_looping() const;
+
+    /**
+     * \brief Makes this group start playing when its region is loaded.
+     * \param auto_play 'true' to play automatically
+     */
+    void set_auto_play(bool auto_play);
+
+    /**
+     * \brief Checks if this group starts playing when its region is loaded.
+     * \return 'true' if this group plays automatically
+     */
+    bool is_auto_play() const;
+
+    /**
+     * \brief Returns the duration of one iteration of this group.
+     * \return The duration of one iteration of this group
+     */
+    float get_duration() const;
+
+    /**
+     * \brief Starts playing this group, or resumes it if it was paused.
+     * \note If the group is already playing, it is restarted from the beginning.
+     */
+    void play();
+
+    /// Pauses this group, keeping the current state of the region.
+    void pause();
+
+    /// Stops this group, and restores the state of the region before it was played.
+    void stop();
+
+    /**
+     * \brief Checks if this group is playing (or paused).
+     * \return 'true' if this group is playing (or paused)
+     */
+    bool is_playing() const;
+
+    /**
+     * \brief Checks if this group is paused.
+     * \return 'true' if this group is paused
+     */
+    bool is_paused() const;
+
+    /**
+     * \brief Advances this group in time, and applies the animations to the region.
+     * \param delta Time spent since last update
+     * \note This is called automatically by the root on each update.
+     */
+    void update(float delta);
+
+    /**
+     * \brief Copies the animations and settings of another group (inheritance).
+     * \param other The group to copy
+     */
+    void copy_from(const animation_group& other);
+
+    /// Fires when this group reaches its end (only when not looping).
+    utils::signal<void()> on_finished;
+
+    /// Registers this class to the provided Lua state
+    static void register_on_lua(sol::state& lua);
+
+    static constexpr const char* class_name = "AnimationGroup";
+
+private:
+    void apply_(float time);
+    void restore_();
+    void finish_();
+
+    region&     owner_;
+    std::string name_;
+
+    std::vector<animation> animation_list_;
+    animation_loop         looping_   = animation_loop::none;
+    bool                   auto_play_ = false;
+    float                  duration_  = 0.0f;
+
+    bool has_alpha_     = false;
+    bool has_color_     = false;
+    bool has_transform_ = false;
+
+    float elapsed_       = 0.0f;
+    bool  is_playing_    = false;
+    bool  is_paused_     = false;
+    bool  is_registered_ = false;
+    bool  is_applied_    = false;
+
+    // Current state of the animations, combined with other groups by the region
+    float                alpha_     = 1.0f;
+    std::optional<color> color_;
+    matrix4f             transform_ = matrix4f::identity;
+};
+
+} // namespace lxgui::gui
+
+#endif
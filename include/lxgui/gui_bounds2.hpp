@@ -4,6 +4,8 @@
 #include "lxgui/gui_vector2.hpp"
 #include "lxgui/lxgui.hpp"
 
+#include <algorithm>
+
 namespace lxgui::gui {
 
 /**
@@ -74,6 +76,12 @@ struct bounds2 {
                range_overlaps(top, bottom, quad.top, quad.bottom);
     }
 
+    bounds2<T> merge(const bounds2<T>& quad) const noexcept {
+        return bounds2<T>(
+            std::min(left, quad.left), std::max(right, quad.right), std::min(top, quad.top),
+            std::max(bottom, quad.bottom));
+    }
+
     bool operator==(const bounds2<T>& quad) const {
         return left == quad.left && right == quad.right && top == quad.top && bottom == quad.bottom;
     }
@@ -471,6 +471,8 @@ protected:
     void parse_attributes_(const layout_node& node) override;
     void parse_all_nodes_before_children_(const layout_node& node) override;
 
+    void recycle_(const frame& default_frame) override;
+
     bool is_button_clicks_enabled_(input::mouse_button button_id) const;
 
     virtual void click_(
@@ -113,6 +113,8 @@ public:
 protected:
     void parse_all_nodes_before_children_(const layout_node& node) override;
 
+    void recycle_(const frame& default_frame) override;
+
     const std::vector<std::string>& get_type_list_() const override;
 
     bool is_checked_ = false;
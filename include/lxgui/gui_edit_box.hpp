@@ -358,6 +358,8 @@ protected:
 
     void update_(float delta) override;
 
+    void recycle_(const frame& default_frame) override;
+
     const std::vector<std::string>& get_type_list_() const override;
 
     void create_font_string_();
@@ -366,8 +368,11 @@ protected:
 
     bool check_text_();
     void update_displayed_text_();
+    void replace_displayed_text_(std::size_t pos, std::size_t count, const utils::ustring& content);
     void update_font_string_();
     void update_carret_position_();
+    void get_multi_line_carret_position_(
+        std::size_t index, float& x_offset, std::size_t& line) const;
 
     bool        add_char_(char32_t c);
     bool        remove_char_();
@@ -380,6 +385,7 @@ protected:
 
     utils::ustring           unicode_text_;
     utils::ustring           displayed_text_;
+    std::vector<std::size_t> line_break_list_;
     utils::ustring::iterator iter_carret_pos_;
 
     std::size_t display_pos_        = 0;
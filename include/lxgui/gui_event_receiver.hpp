@@ -43,6 +43,9 @@ public:
      */
     void unregister_event(const std::string& event_name);
 
+    /// Disables reaction to all events.
+    void unregister_all_events();
+
 private:
     struct event_connection {
         std::string              name;
@@ -7,6 +7,7 @@
 #include <functional>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 /** \cond INCLUDE_INTERNALS_IN_DOC
  */
@@ -27,6 +28,7 @@ class layered_region;
 class frame;
 class registry;
 class frame_renderer;
+class frame_pool;
 class manager;
 
 /**
@@ -37,6 +39,8 @@ class manager;
  * frame::create_region().
  */
 class factory {
+    friend frame_pool;
+
 private:
     template<typename T>
     static utils::owner_ptr<region>
@@ -57,6 +61,31 @@ private:
     }
 
 public:
+    /// Counts objects of a given kind created and destroyed by this factory.
+    struct allocation_counter {
+        std::size_t created   = 0u;
+        std::size_t destroyed = 0u;
+        std::size_t peak      = 0u;
+
+        /**
+         * \brief Returns the number of objects currently alive.
+         * \return The number of objects currently alive
+         */
+        std::size_t get_live_count() const {
+            return created - destroyed;
+        }
+    };
+
+    /// Allocation statistics, used to measure object creation churn (e.g., during load/unload).
+    struct allocation_stats {
+        /// All objects (regions, frames, and layered regions)
+        allocation_counter regions;
+        /// Frames only
+        allocation_counter frames;
+        /// Layered regions only
+        allocation_counter layered_regions;
+    };
+
     /**
      * \brief Constructor.
      * \param mgr The GUI manager
@@ -163,11 +192,56 @@ public:
      */
     void register_on_lua(sol::state& lua);
 
+    /**
+     * \brief Returns the allocation statistics of this factory.
+     * \return The allocation statistics of this factory
+     * \note Objects are counted when created, including virtual objects, and when destroyed,
+     * including objects that failed to initialize. The smaller allocations attached to them
+     * (list nodes, layers, anchors, signal slots) are served by memory pools, and counted by
+     * utils::get_memory_pool_stats().
+     */
+    const allocation_stats& get_allocation_stats() const;
+
+    /**
+     * \brief Resets the allocation statistics of this factory.
+     * \note Objects which are still alive remain counted as created, and the peak is set
+     * to the current number of live objects. This can be used to measure the allocations
+     * done during a specific operation (e.g., reloading the UI).
+     */
+    void reset_allocation_stats();
+
+    /**
+     * \brief Tells this factory that a region has been destroyed.
+     * \param obj The region being destroyed
+     * \note This is called automatically by the region destructor.
+     */
+    void notify_region_destroyed(const region& obj);
+
+    /**
+     * \brief Tells this factory that a frame has been destroyed.
+     * \param obj The frame being destroyed
+     * \note This is called automatically by the frame destructor.
+     */
+    void notify_frame_destroyed(const frame& obj);
+
+    /**
+     * \brief Tells this factory that a layered region has been destroyed.
+     * \param obj The layered region being destroyed
+     * \note This is called automatically by the layered_region destructor.
+     */
+    void notify_layered_region_destroyed(const layered_region& obj);
+
 private:
+    static void notify_created_(allocation_counter& counter);
+
     bool finalize_object_(registry& reg, region& object, const region_core_attributes& attr);
 
     void apply_inheritance_(region& object, const region_core_attributes& attr);
 
+    utils::observer_ptr<const frame> get_flattened_template_(
+        const std::string& object_type,
+        const std::vector<utils::observer_ptr<const region>>& base_list);
+
     manager& manager_;
 
     template<typename T>
@@ -184,6 +258,10 @@ private:
         custom_region_list_;
 
     string_map<std::function<void(sol::state&)>> custom_lua_regs_;
+
+    allocation_stats allocation_stats_;
+
+    std::size_t num_flattened_templates_ = 0u;
 };
 
 } // namespace lxgui::gui
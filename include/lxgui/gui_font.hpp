@@ -8,7 +8,11 @@
 #include "lxgui/utils.hpp"
 
 #include <array>
+#include <cstdint>
+#include <functional>
 #include <memory>
+#include <unordered_map>
+#include <vector>
 
 namespace lxgui::gui {
 
@@ -27,6 +31,18 @@ public:
     /// Destructor.
     virtual ~font() = default;
 
+    /// Non-copiable
+    font(const font&) = delete;
+
+    /// Non-movable
+    font(font&&) = delete;
+
+    /// Non-copiable
+    font& operator=(const font&) = delete;
+
+    /// Non-movable
+    font& operator=(font&&) = delete;
+
     /**
      * \brief Get the size of the font in pixels.
      * \return The size of the font in pixels
@@ -75,6 +91,17 @@ public:
      */
     virtual float get_character_kerning(char32_t c1, char32_t c2) const = 0;
 
+    /**
+     * \brief Returns the spread of the distance field, for distance field fonts.
+     * \return The largest distance (in pixels of the font texture) stored in the distance
+     * field, or zero if this font is not a distance field font
+     * \note Distance field fonts store, for each pixel of the font texture, the distance to
+     * the edge of the glyph rather than the glyph coverage. They are created once at a
+     * reference size (see get_size()), and can be rendered at any size, with or without
+     * outline, with renderer::set_distance_field_threshold().
+     */
+    virtual float get_distance_field_spread() const = 0;
+
     /**
      * \brief Returns the underlying material to use for rendering.
      * \return The underlying material to use for rendering
@@ -88,6 +115,68 @@ public:
     virtual void update_texture(std::shared_ptr<material> mat) = 0;
 };
 
+/**
+ * \brief Kerning amounts between pairs of characters of a font
+ * \details Text layout looks up the kerning of the same few pairs of characters over and over.
+ * This table asks the font for the kerning of a pair the first time it is looked up, and caches
+ * the result, so that each pair only reaches the font backend once. Since pairs are computed
+ * on demand, loading a font does not depend on the number of characters it holds.
+ * \note The cache is filled by get(), which is const: like the font itself, a table must not
+ * be used from several threads at once.
+ */
+class kerning_table {
+public:
+    /// Function returning the kerning amount between two characters, read from the font.
+    using function_type = std::function<float(char32_t, char32_t)>;
+
+    /// Creates an empty table, for fonts without kerning.
+    kerning_table() = default;
+
+    /**
+     * \brief Creates a table reading kerning from a font.
+     * \param function The function returning the kerning amount between two characters
+     */
+    explicit kerning_table(function_type function);
+
+    /**
+     * \brief Returns the kerning amount between two characters.
+     * \param c1 The first unicode character
+     * \param c2 The second unicode character
+     * \return The kerning amount between the two characters, or zero if none
+     */
+    float get(char32_t c1, char32_t c2) const;
+
+    /**
+     * \brief Returns the number of pairs of characters cached in this table.
+     * \return The number of pairs of characters cached in this table
+     */
+    std::size_t get_pair_count() const noexcept;
+
+private:
+    function_type                                    function_;
+    mutable std::unordered_map<std::uint64_t, float> cache_;
+};
+
+/**
+ * \brief Computes the signed distance field of a glyph.
+ * \param coverage The glyph coverage (one byte per pixel, 255 inside the glyph)
+ * \param width The width of the glyph, in pixels
+ * \param height The height of the glyph, in pixels
+ * \param pitch The number of bytes between two rows of the coverage data
+ * \param spread The largest distance to store, in pixels
+ * \return The distance field, of dimensions (width + 2*spread) x (height + 2*spread)
+ * \note The returned distance field has a value of 128 on the edge of the glyph, 255 for
+ * pixels inside the glyph at a distance of 'spread' or more from the edge, and 0 for pixels
+ * outside the glyph at a distance of 'spread' or more from the edge. Distances are computed
+ * in linear time, with the 8-point sequential Euclidean distance transform.
+ */
+std::vector<std::uint8_t> make_distance_field(
+    const std::uint8_t* coverage,
+    std::size_t         width,
+    std::size_t         height,
+    std::size_t         pitch,
+    std::size_t         spread);
+
 } // namespace lxgui::gui
 
 #endif
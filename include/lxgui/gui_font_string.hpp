@@ -399,6 +399,15 @@ public:
      */
     void set_text(const utils::ustring& content);
 
+    /**
+     * \brief Replaces part of the rendered text.
+     * \param pos The position of the first character to replace
+     * \param count The number of characters to replace
+     * \param content The text to insert in their place
+     * \note See text::replace_text for more information.
+     */
+    void replace_text(std::size_t pos, std::size_t count, const utils::ustring& content);
+
     /// Tells this region that the global interface scaling factor has changed.
     void notify_scaling_factor_updated() override;
 
@@ -436,6 +445,9 @@ private:
 
     void update_borders_() override;
 
+    std::optional<color> get_animation_color_() const override;
+    void                 set_animation_color_(const color& c) override;
+
     std::unique_ptr<text> text_;
 
     utils::ustring content_;
@@ -3,6 +3,7 @@
 
 #include "lxgui/gui_backdrop.hpp"
 #include "lxgui/gui_event_receiver.hpp"
+#include "lxgui/gui_frame_cache_renderer.hpp"
 #include "lxgui/gui_frame_core_attributes.hpp"
 #include "lxgui/gui_layered_region.hpp"
 #include "lxgui/gui_region.hpp"
@@ -11,6 +12,7 @@
 #include "lxgui/lxgui.hpp"
 #include "lxgui/utils.hpp"
 #include "lxgui/utils_meta.hpp"
+#include "lxgui/utils_pool_allocator.hpp"
 #include "lxgui/utils_signal.hpp"
 #include "lxgui/utils_view.hpp"
 
@@ -27,12 +29,17 @@
 namespace lxgui::gui {
 
 class frame_renderer;
+class frame_pool;
 class frame;
+class renderer;
 
 /// Contains gui::layered_region
 struct layer_container {
     bool                                             is_disabled = false;
-    std::vector<utils::observer_ptr<layered_region>> region_list;
+    std::vector<
+        utils::observer_ptr<layered_region>,
+        utils::pool_allocator<utils::observer_ptr<layered_region>>>
+        region_list;
 };
 
 /// Holds file/line information for a script.
@@ -131,6 +138,10 @@ using script_list_view = script_signal::slot_list_view;
  *
  * Hard-coded events available to all frames:
  *
+ * - `OnAnimationFinished`: Triggered when an animation group of the frame, or of
+ * one of its layered regions, reaches its end without looping. This event provides
+ * two arguments to the registered callback: the name of the animation group, and
+ * the name of the animated region.
  * - `OnChar`: Triggered whenever a character is typed and the frame has focus
  * (see @ref frame::set_focus).
  * - `OnDoubleClick`: Triggered when the frame is double-clicked.
@@ -253,6 +264,10 @@ using script_list_view = script_signal::slot_list_view;
  * child frames, and all the layered regions of the virtual frame.
  */
 class frame : public region {
+    friend frame_renderer;
+    friend frame_cache_renderer;
+    friend frame_pool;
+
 public:
     using base = region;
 
@@ -264,8 +279,10 @@ public:
      *  - iterators can be invalidated on removal
      *  - most common use is iteration, not addition or removal
      *  - ordering of elements is irrelevant
+     * The list nodes are allocated from the memory pools (see utils::pool_allocator).
      */
-    using child_list      = std::list<utils::owner_ptr<frame>>;
+    using child_list =
+        std::list<utils::owner_ptr<frame>, utils::pool_allocator<utils::owner_ptr<frame>>>;
     using child_list_view = utils::view::
         adaptor<child_list, utils::view::smart_ptr_dereferencer, utils::view::non_null_filter>;
     using const_child_list_view = utils::view::adaptor<
@@ -281,8 +298,11 @@ public:
      *  - iterators can be invalidated on removal
      *  - most common use is iteration, not addition or removal
      *  - ordering of elements is irrelevant
+     * The list nodes are allocated from the memory pools (see utils::pool_allocator).
      */
-    using region_list      = std::list<utils::owner_ptr<layered_region>>;
+    using region_list = std::list<
+        utils::owner_ptr<layered_region>,
+        utils::pool_allocator<utils::owner_ptr<layered_region>>>;
     using region_list_view = utils::view::
         adaptor<region_list, utils::view::smart_ptr_dereferencer, utils::view::non_null_filter>;
     using const_region_list_view = utils::view::adaptor<
@@ -534,6 +554,15 @@ public:
      */
     void enable_key_capture(input::key key_id);
 
+    /**
+     * \brief Marks this frame as able to receive keyboard input from a specific key chord.
+     * \param chord The key chord to capture
+     * \note See @ref enable_key_capture(const std::string&) for more information.
+     * \see disable_key_capture()
+     * \see is_key_capture_enabled()
+     */
+    void enable_key_capture(input::key_chord chord);
+
     /**
      * \brief Marks this frame as unable to receive keyboard input from a specific key.
      * \param key_name The key for which to disable capture
@@ -557,6 +586,14 @@ public:
      */
     void disable_key_capture(input::key key_id);
 
+    /**
+     * \brief Marks this frame as unable to receive keyboard input from a specific key chord.
+     * \param chord The key chord for which to disable capture
+     * \see enable_key_capture()
+     * \see is_key_capture_enabled()
+     */
+    void disable_key_capture(input::key_chord chord);
+
     /**
      * \brief Marks this frame as unable to receive keyboard input from any key.
      * \see enable_key_capture()
@@ -1071,6 +1108,14 @@ public:
      */
     bool is_key_capture_enabled(const std::string& key_name) const;
 
+    /**
+     * \brief Checks if this frame can receive keyboard input from a specific key chord.
+     * \param chord The key chord to check
+     * \return 'true' if this frame can receive keyboard input from this key chord
+     * \see enable_key_capture()
+     */
+    bool is_key_capture_enabled(input::key_chord chord) const;
+
     /**
      * \brief Checks if this frame can receive any keyboard input.
      * \return 'true' if this frame can receive any keyboard input
@@ -1587,6 +1632,29 @@ public:
      */
     bool is_auto_focus_enabled() const;
 
+    /**
+     * \brief Enables caching the rendering of this frame and all its children.
+     * \param enable 'true' to enable, 'false' to disable
+     * \details When enabled, the children of this frame are rendered by a
+     * #frame_cache_renderer. Once the frame and its children have not changed for a few
+     * updates, they are rendered into a render target, and then drawn as a single quad until
+     * something changes again. This is useful for complex frames which rarely change (e.g.,
+     * a talent tree).
+     * \note The children of this frame are rendered just after this frame, regardless of
+     * their strata and level compared to frames outside of this frame. Content drawn outside
+     * of the borders of the frames and layered regions is clipped while cached.
+     * \note For children to receive input, the predicate given to find_topmost_frame()
+     * must check the input flags of the frames.
+     */
+    void enable_render_cache(bool enable);
+
+    /**
+     * \brief Checks if render caching is enabled.
+     * \return 'true' if render caching is enabled
+     * \see enable_render_cache()
+     */
+    bool is_render_cache_enabled() const;
+
     /**
      * \brief Asks for focus for this frame.
      * \param focus 'true' to ask for focus, 'false' to release it
@@ -1653,6 +1721,14 @@ public:
      */
     void notify_renderer_need_redraw() override;
 
+    /**
+     * \brief Notifies the renderer of this frame that an area needs to be redrawn.
+     * \param rect The area to redraw
+     * \note Called by layered regions of this frame when they change. Unlike
+     * notify_renderer_need_redraw(), this allows the renderer to only redraw the provided area.
+     */
+    void notify_renderer_need_redraw(const bounds2f& rect);
+
     /**
      * \brief Changes this region's absolute dimensions (in pixels).
      * \param dimensions The new dimensions
@@ -1769,6 +1845,27 @@ protected:
 
     void update_borders_() override;
 
+    void notify_alpha_changed_() override;
+
+    void notify_animation_transform_changed_() override;
+
+    void update_render_transform_();
+
+    void notify_frame_data_changed_();
+
+    virtual bool has_custom_hit_test_() const;
+
+    void render_content_() const;
+
+    utils::observer_ptr<const frame_renderer> get_child_frame_renderer_() const;
+
+    /**
+     * \brief Resets this frame to the state of a default frame, before it is pooled.
+     * \param default_frame A frame of the same type, with no template
+     * \note Derived classes must reset the state which is not reset by copy_from().
+     */
+    virtual void recycle_(const frame& default_frame);
+
     /**
      * \brief Changes this region's parent.
      * \param parent The new parent
@@ -1805,11 +1902,18 @@ protected:
 
     std::array<layer_container, num_layers> layer_list_;
 
-    std::unordered_map<std::string, script_signal> signal_list_;
+    std::unordered_map<
+        std::string,
+        script_signal,
+        std::hash<std::string>,
+        std::equal_to<std::string>,
+        utils::pool_allocator<std::pair<const std::string, script_signal>>>
+        signal_list_;
     event_receiver                                 event_receiver_;
 
     std::set<std::string> reg_drag_list_;
-    std::set<std::string> reg_key_list_;
+    // Sorted, for binary search
+    std::vector<input::key_chord> reg_key_list_;
 
     int                   level_ = 0;
     std::optional<strata> strata_;
@@ -1819,6 +1923,14 @@ protected:
     utils::observer_ptr<frame_renderer> frame_renderer_           = nullptr;
     utils::observer_ptr<frame_renderer> effective_frame_renderer_ = nullptr;
 
+    renderer& renderer_;
+
+    // Animation transformation of this frame and its parents, relative to the frame renderer
+    std::optional<matrix4f> render_transform_;
+
+    bool                                   is_render_cache_enabled_ = false;
+    utils::owner_ptr<frame_cache_renderer> render_cache_;
+
     std::unique_ptr<backdrop> backdrop_;
 
     bool is_mouse_click_enabled_ = false;
@@ -1849,6 +1961,8 @@ protected:
 
     bool is_focused_    = false;
     bool is_auto_focus_ = false;
+
+    std::size_t renderer_index_ = 0u;
 };
 
 } // namespace lxgui::gui
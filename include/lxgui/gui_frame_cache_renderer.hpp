@@ -0,0 +1,89 @@
+#ifndef LXGUI_GUI_FRAME_CACHE_RENDERER_HPP
+#define LXGUI_GUI_FRAME_CACHE_RENDERER_HPP
+
+#include "lxgui/gui_bounds2.hpp"
+#include "lxgui/gui_frame_renderer.hpp"
+#include "lxgui/gui_quad.hpp"
+#include "lxgui/lxgui.hpp"
+
+#include <memory>
+
+namespace lxgui::gui {
+
+class frame;
+class render_target;
+
+/**
+ * \brief Renders the children of a frame, and caches the whole frame into a render target.
+ * \details This renderer is created by frame::enable_render_cache(). It takes care of
+ * rendering all the children of its frame (and their own children, etc.), in the same way
+ * as a #scroll_frame renders its scroll child. When the content of the frame has not changed
+ * for a few updates, the frame and all its children are rendered once into a render target,
+ * and the frame is then drawn as a single quad until something changes again. While the
+ * content keeps changing, the frames are rendered directly, so that frequently changing
+ * content does not pay the cost of redrawing the render target on each update.
+ */
+class frame_cache_renderer : public frame_renderer {
+public:
+    /// Number of updates without changes after which the content is cached.
+    static constexpr std::size_t static_update_threshold = 8u;
+
+    /**
+     * \brief Constructor.
+     * \param owner The frame to cache
+     */
+    explicit frame_cache_renderer(frame& owner);
+
+    /// Tells this renderer that one of its region requires redraw.
+    void notify_strata_needs_redraw(strata strata_id) override;
+
+    /**
+     * \brief Tells this renderer that an area of a strata requires redraw.
+     * \param strata_id The strata to redraw
+     * \param rect The area to redraw
+     */
+    void notify_strata_rect_needs_redraw(strata strata_id, const bounds2f& rect) override;
+
+    /**
+     * \brief Returns the width and height of of this renderer's main render target (e.g., screen).
+     * \return The render target dimensions
+     */
+    vector2f get_target_dimensions() const override;
+
+    /// Tells this renderer that the content of the frame has changed.
+    void notify_content_changed();
+
+    /**
+     * \brief Updates the cache, rendering the frame into the render target if needed.
+     * \note This must be called on each update of the frame.
+     */
+    void update();
+
+    /**
+     * \brief Checks if the cached render target is up to date.
+     * \return 'true' if the frame can be rendered with render_cache()
+     */
+    bool is_cached() const;
+
+    /// Renders the cached render target on the current render target.
+    void render_cache() const;
+
+    /// Renders all the children of the frame on the current render target.
+    void render_frames() const;
+
+private:
+    bounds2f compute_bounds_() const;
+    void     render_target_();
+
+    frame& owner_;
+
+    std::shared_ptr<render_target> target_;
+    quad                           target_quad_;
+    bool                           is_cached_           = false;
+    bool                           is_target_supported_ = true;
+    std::size_t                    num_static_updates_  = 0u;
+};
+
+} // namespace lxgui::gui
+
+#endif
@@ -4,6 +4,7 @@
 #include "lxgui/gui_frame_core_attributes.hpp"
 #include "lxgui/lxgui.hpp"
 #include "lxgui/utils_observer.hpp"
+#include "lxgui/utils_pool_allocator.hpp"
 #include "lxgui/utils_view.hpp"
 
 #include <list>
@@ -33,8 +34,10 @@ public:
      *  - iterators can be invalidated on removal
      *  - most common use is iteration, not addition or removal
      *  - ordering of elements is irrelevant
+     * The list nodes are allocated from the memory pools (see utils::pool_allocator).
      */
-    using root_frame_list = std::list<utils::owner_ptr<frame>>;
+    using root_frame_list =
+        std::list<utils::owner_ptr<frame>, utils::pool_allocator<utils::owner_ptr<frame>>>;
 
     using root_frame_list_view = utils::view::
         adaptor<root_frame_list, utils::view::smart_ptr_dereferencer, utils::view::non_null_filter>;
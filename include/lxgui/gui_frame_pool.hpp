@@ -0,0 +1,117 @@
+#ifndef LXGUI_GUI_FRAME_POOL_HPP
+#define LXGUI_GUI_FRAME_POOL_HPP
+
+#include "lxgui/gui_frame_core_attributes.hpp"
+#include "lxgui/lxgui.hpp"
+#include "lxgui/utils_observer.hpp"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace lxgui::gui {
+
+class frame;
+class manager;
+
+/**
+ * \brief Recycles frames which are frequently created and destroyed.
+ * \details Creating a frame from templates is costly: the frame must be constructed,
+ * registered, bound to Lua, and all the templates must be copied into it. For frames that
+ * are short lived and created often (tooltips, floating combat text, etc.), this class
+ * allows keeping released frames in a pool, and re-using them later.
+ *
+ * Frames obtained with acquire_frame() can be given back to the pool with release_frame().
+ * This destroys their children, regions, scripts, and Lua members, unregisters all their
+ * events, and resets all their properties and state (e.g., the text of an edit box, or the
+ * checked state of a check button) to the default values of their type. The frame itself
+ * (and its name and Lua glue) is kept in the pool, ready to be re-used by the next call to
+ * acquire_frame() with the same frame type and inheritance list, which will then only need
+ * to copy the templates.
+ *
+ * \note A re-used frame keeps the name it was given when it was first created, which may
+ * differ from the name requested in acquire_frame().
+ */
+class frame_pool {
+public:
+    /**
+     * \brief Constructor.
+     * \param mgr The GUI manager
+     */
+    explicit frame_pool(manager& mgr);
+
+    /// Destructor.
+    ~frame_pool();
+
+    // Non-copiable, non-movable
+    frame_pool(const frame_pool&) = delete;
+    frame_pool(frame_pool&&)      = delete;
+    frame_pool& operator=(const frame_pool&) = delete;
+    frame_pool& operator=(frame_pool&&) = delete;
+
+    /**
+     * \brief Returns a frame from the pool, or creates a new one if none is available.
+     * \param attr The core attributes of the frame (is_virtual will be ignored)
+     * \return The frame, or nullptr if it could not be created
+     * \note As with root::create_root_frame() and frame::create_child(), you still need to
+     * call notify_loaded() when you are done with any extra initialization you require on
+     * this frame. If you do not, the frame's OnLoad callback will not fire.
+     */
+    utils::observer_ptr<frame> acquire_frame(frame_core_attributes attr);
+
+    /**
+     * \brief Gives a frame back to the pool.
+     * \param obj The frame to release
+     * \note The frame is hidden and removed from its parent. If the frame was not obtained
+     * from acquire_frame(), it is simply destroyed.
+     */
+    void release_frame(frame& obj);
+
+    /**
+     * \brief Returns the number of frames currently waiting in the pool.
+     * \return The number of frames currently waiting in the pool
+     */
+    std::size_t get_num_pooled_frames() const;
+
+    /**
+     * \brief Returns the number of calls to acquire_frame() which re-used a pooled frame.
+     * \return The number of calls to acquire_frame() which re-used a pooled frame
+     */
+    std::size_t get_num_reused_frames() const;
+
+    /**
+     * \brief Returns the number of calls to acquire_frame() which created a new frame.
+     * \return The number of calls to acquire_frame() which created a new frame
+     */
+    std::size_t get_num_created_frames() const;
+
+    /// Destroys all the frames waiting in the pool.
+    void clear();
+
+private:
+    struct acquired_frame {
+        utils::observer_ptr<frame> obj;
+        std::string                key;
+    };
+
+    static std::string get_key_(const frame_core_attributes& attr);
+
+    utils::observer_ptr<const frame> get_default_frame_(const std::string& type);
+
+    void remove_expired_frames_();
+
+    manager& manager_;
+
+    std::unordered_map<const frame*, acquired_frame>                      acquired_list_;
+    std::unordered_map<std::string, std::vector<utils::owner_ptr<frame>>> pooled_list_;
+    std::unordered_map<std::string, utils::observer_ptr<const frame>>     default_list_;
+
+    std::size_t num_pooled_   = 0u;
+    std::size_t num_reused_   = 0u;
+    std::size_t num_created_  = 0u;
+    std::size_t next_cleanup_ = 64u;
+};
+
+} // namespace lxgui::gui
+
+#endif
@@ -1,14 +1,19 @@
 #ifndef LXGUI_GUI_FRAME_RENDERER_HPP
 #define LXGUI_GUI_FRAME_RENDERER_HPP
 
+#include "lxgui/gui_bounds2.hpp"
 #include "lxgui/gui_strata.hpp"
+#include "lxgui/gui_vector2.hpp"
 #include "lxgui/lxgui.hpp"
 #include "lxgui/utils.hpp"
 #include "lxgui/utils_observer.hpp"
 #include "lxgui/utils_sorted_vector.hpp"
 
+#include <cstdint>
 #include <functional>
 #include <magic_enum/magic_enum.hpp>
+#include <optional>
+#include <vector>
 
 namespace lxgui::gui {
 
@@ -19,6 +24,17 @@ class color;
 /// Abstract class for layering and rendering frames.
 class frame_renderer {
 public:
+    /// Bit flags describing the state of a frame, in the packed frame data.
+    enum frame_flag : std::uint8_t {
+        flag_visible         = 1u << 0u,
+        flag_valid           = 1u << 1u,
+        flag_mouse_click     = 1u << 2u,
+        flag_mouse_move      = 1u << 3u,
+        flag_mouse_wheel     = 1u << 4u,
+        flag_keyboard        = 1u << 5u,
+        flag_custom_hit_test = 1u << 6u
+    };
+
     /// Default constructor
     frame_renderer();
 
@@ -34,6 +50,15 @@ public:
     /// Tells this renderer that one of its region requires redraw.
     virtual void notify_strata_needs_redraw(strata strata_id);
 
+    /**
+     * \brief Tells this renderer that an area of a strata requires redraw.
+     * \param strata_id The strata to redraw
+     * \param rect The area to redraw
+     * \note By default, this redraws the whole strata. Renderers which can redraw only a part
+     * of a strata can override this function.
+     */
+    virtual void notify_strata_rect_needs_redraw(strata strata_id, const bounds2f& rect);
+
     /**
      * \brief Tells this renderer that it should (or not) render another frame.
      * \param obj The frame to render
@@ -59,6 +84,15 @@ public:
     virtual void
     notify_level_changed(const utils::observer_ptr<frame>& obj, int old_level, int new_level);
 
+    /**
+     * \brief Tells this renderer that the state of a frame has changed.
+     * \param obj The frame which has changed
+     * \note This updates the packed data stored for this frame (visibility, alpha, hit
+     * rectangle, input flags), which is used to quickly skip frames when rendering or
+     * looking for the frame under the mouse.
+     */
+    void notify_frame_data_changed(const frame& obj);
+
     /**
      * \brief Returns the width and height of of this renderer's main render target (e.g., screen).
      * \return The render target dimensions
@@ -84,6 +118,38 @@ public:
             const_cast<const frame_renderer*>(this)->find_topmost_frame(predicate));
     }
 
+    /**
+     * \brief Find the top-most frame at a given position and matching the provided predicate
+     * \param position The position to test (e.g., the mouse position)
+     * \param flags Flags (see frame_flag) that a frame must have to be selected
+     * \param predicate A function returning 'true' if the frame can be selected
+     * \return The topmost frame, or nullptr if none
+     * \details This is equivalent to the overload without position and flags, except that
+     * the frames are first filtered using the packed frame data (hit rectangle and flags).
+     * The predicate is only called for frames which pass this filter, and must still check
+     * that the frame contains the position (e.g., with frame::is_in_region()).
+     */
+    utils::observer_ptr<const frame> find_topmost_frame(
+        const vector2f&                           position,
+        std::uint8_t                              flags,
+        const std::function<bool(const frame&)>& predicate) const;
+
+    /**
+     * \brief Find the top-most frame at a given position and matching the provided predicate
+     * \param position The position to test (e.g., the mouse position)
+     * \param flags Flags (see frame_flag) that a frame must have to be selected
+     * \param predicate A function returning 'true' if the frame can be selected
+     * \return The topmost frame, or nullptr if none
+     */
+    utils::observer_ptr<frame> find_topmost_frame(
+        const vector2f&                           position,
+        std::uint8_t                              flags,
+        const std::function<bool(const frame&)>& predicate) {
+        return utils::const_pointer_cast<frame>(
+            const_cast<const frame_renderer*>(this)->find_topmost_frame(
+                position, flags, predicate));
+    }
+
     /**
      * \brief Returns the highest level on the provided strata.
      * \param strata_id The strata to inspect
@@ -96,7 +162,9 @@ protected:
     bool has_strata_list_changed_() const;
     void reset_strata_list_changed_flag_();
 
-    void render_strata_(const strata_data& strata_obj) const;
+    std::size_t render_strata_(const strata_data& strata_obj) const;
+    std::size_t render_strata_(
+        const strata_data& strata_obj, const std::optional<bounds2f>& clip_rect) const;
 
     struct frame_comparator {
         bool operator()(const frame* f1, const frame* f2) const;
@@ -107,11 +175,23 @@ protected:
 
     std::pair<std::size_t, std::size_t> get_strata_range_(strata strata_id) const;
 
+    void notify_frame_list_sorted_();
+    void update_frame_list_data_() const;
+    void update_frame_data_(std::size_t index) const;
+
     static constexpr std::size_t num_strata = magic_enum::enum_count<strata>();
 
     std::array<strata_data, num_strata> strata_list_;
     frame_list_type                     sorted_frame_list_;
     bool                                frame_list_updated_ = false;
+
+    // Packed frame data, in the same order as sorted_frame_list_. When frames are added,
+    // removed, or sorted, it is rebuilt once by update_frame_list_data_(), before the next
+    // rendering or hit test.
+    mutable std::vector<bounds2f>     frame_hit_rect_list_;
+    mutable std::vector<float>        frame_alpha_list_;
+    mutable std::vector<std::uint8_t> frame_flag_list_;
+    mutable bool                      frame_data_dirty_ = false;
 };
 
 } // namespace lxgui::gui
@@ -6,8 +6,10 @@
 #include "lxgui/utils_signal.hpp"
 
 #include <lxgui/extern_sol2_protected_function.hpp>
+#include <map>
+#include <optional>
 #include <string>
-#include <vector>
+#include <unordered_map>
 
 namespace lxgui::gui {
 
@@ -81,6 +83,15 @@ public:
         bool             ctrl_is_pressed,
         bool             alt_is_pressed);
 
+    /**
+     * \brief Binds an action to a key chord.
+     * \param name The action to bind
+     * \param chord The key chord to bind it to
+     * \note A key chord can only be bound to one action at a time. If another action was
+     * bound to this chord, it is unbound.
+     */
+    void set_key_binding(std::string_view name, input::key_chord chord);
+
     /**
      * \brief Unbinds an action.
      * \param name The action to unbind
@@ -99,22 +110,25 @@ public:
     bool on_key_down(
         input::key key_id, bool shift_is_pressed, bool ctrl_is_pressed, bool alt_is_pressed);
 
+    /**
+     * \brief Called when a key is pressed.
+     * \param chord The key chord that is pressed
+     * \return 'true' if a key binding was found matching this key chord, 'false' otherwise.
+     */
+    bool on_key_down(input::key_chord chord);
+
 private:
     struct key_binding {
-        std::string name;
-
-        input::key key_id           = input::key::k_unassigned;
-        bool       shift_is_pressed = false;
-        bool       ctrl_is_pressed  = false;
-        bool       alt_is_pressed   = false;
+        std::string                     name;
+        std::optional<input::key_chord> chord;
 
         signal_type signal;
     };
 
-    key_binding* find_binding_(
-        input::key key_id, bool shift_is_pressed, bool ctrl_is_pressed, bool alt_is_pressed);
+    key_binding* find_binding_(std::string_view name);
 
-    std::vector<key_binding> key_bindings_;
+    std::map<std::string, key_binding, std::less<>>   key_bindings_;
+    std::unordered_map<input::key_chord, key_binding*> chord_bindings_;
 };
 
 } // namespace lxgui::gui
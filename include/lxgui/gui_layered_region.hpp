@@ -5,6 +5,8 @@
 #include "lxgui/lxgui.hpp"
 #include "lxgui/utils.hpp"
 
+#include <optional>
+
 namespace lxgui::gui {
 
 /// ID of a layer for rendering inside a frame.
@@ -30,6 +32,9 @@ public:
     explicit layered_region(
         utils::control_block& block, manager& mgr, const region_core_attributes& attr);
 
+    /// Destructor.
+    ~layered_region() override;
+
     /**
      * \brief Prints all relevant information about this region in a string.
      * \param tab The offset to give to all lines
@@ -69,7 +74,8 @@ public:
 
     /**
      * \brief Notifies the renderer of this region that it needs to be redrawn.
-     * \note Automatically called by any shape changing function.
+     * \note Automatically called by any shape changing function. Only the area covered by
+     * this region, before and after the change, is reported to the renderer.
      */
     void notify_renderer_need_redraw() override;
 
@@ -91,6 +97,8 @@ protected:
 
     layer layer_        = layer::artwork;
     int   region_level_ = 0;
+
+    std::optional<bounds2f> last_drawn_borders_;
 };
 
 } // namespace lxgui::gui
@@ -8,13 +8,110 @@
 #include "lxgui/utils_string.hpp"
 #include "lxgui/utils_view.hpp"
 
+#include <deque>
+#include <functional>
+#include <limits>
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 namespace lxgui::gui {
 
+/**
+ * \brief Content of a layout file, shared by all the nodes parsed from it
+ * \details This holds the raw content of the file, which parsers can parse in place so
+ * that node names and values are simple views into the file content. Strings which do
+ * not exist as such in the file (e.g., normalized names) are kept in a separate storage.
+ * Line numbers are only computed from byte offsets when a location is requested.
+ */
+class file_line_mappings {
+public:
+    /**
+     * \brief Reads a file.
+     * \param file_name The path to the file
+     * \note Use is_open() to check if the file could be read.
+     */
+    explicit file_line_mappings(std::string file_name);
+
+    // Non-copiable, non-movable (nodes hold pointers to this object and its content)
+    file_line_mappings(const file_line_mappings&) = delete;
+    file_line_mappings(file_line_mappings&&)      = delete;
+    file_line_mappings& operator=(const file_line_mappings&) = delete;
+    file_line_mappings& operator=(file_line_mappings&&) = delete;
+
+    /**
+     * \brief Checks if the file could be read.
+     * \return 'true' if the file could be read, 'false' otherwise
+     */
+    bool is_open() const noexcept;
+
+    /**
+     * \brief Returns the name of the file.
+     * \return The name of the file
+     */
+    const std::string& get_file_name() const noexcept;
+
+    /**
+     * \brief Returns the content of the file, for parsing in place.
+     * \return The content of the file
+     * \note The content starts with a new line character, such that offsets
+     * match line numbers. It must not be resized.
+     */
+    std::string& get_content() noexcept;
+
+    /**
+     * \brief Checks if a string is located inside the file content.
+     * \param str The string to check
+     * \return 'true' if the string is located inside the file content, 'false' otherwise
+     */
+    bool contains(std::string_view str) const noexcept;
+
+    /**
+     * \brief Returns the byte offset of a string located inside the file content.
+     * \param str The string to locate
+     * \return The byte offset of the string, or unknown_offset if not inside the file content
+     */
+    std::size_t get_offset(const char* str) const noexcept;
+
+    /**
+     * \brief Returns the line number and character offset of a byte offset in the file.
+     * \param offset The byte offset in the file content
+     * \return The line number and character offset (line number is zero if unknown)
+     */
+    std::pair<std::size_t, std::size_t> get_line_info(std::size_t offset) const noexcept;
+
+    /**
+     * \brief Returns the location of a byte offset as {file}:{line}.
+     * \param offset The byte offset in the file content
+     * \return The location of the byte offset as {file}:{line}
+     * \note The location string of each offset is built on first call, and kept in this
+     * object, so that nodes do not need to store it. Like the nodes, this is not thread-safe.
+     */
+    std::string_view get_location(std::size_t offset) const;
+
+    /**
+     * \brief Stores a string which will live as long as this object.
+     * \param str The string to store
+     * \return A view to the stored string
+     */
+    std::string_view store(std::string str);
+
+    /// Byte offset to use when the location is unknown
+    static constexpr std::size_t unknown_offset = std::numeric_limits<std::size_t>::max();
+
+private:
+    bool                     is_open_ = false;
+    std::string              file_name_;
+    std::string              file_content_;
+    std::vector<std::size_t> line_offsets_;
+    std::deque<std::string>  storage_;
+
+    mutable std::unordered_map<std::size_t, std::string> location_list_;
+};
+
 /**
  * \brief An attribute in a layout file
  * \details This is a format-agnostic representation of a GUI layout, as read
@@ -32,52 +129,57 @@ public:
     /**
      * \brief Returns this node's location in the file as {file}:{line}.
      * \return This node's location in the file as {file}:{line}
+     * \note For nodes read from a file, the location is computed on first call.
      */
-    std::string_view get_location() const noexcept {
-        return location_;
+    std::string_view get_location() const {
+        if (detached_ && !detached_->location.empty())
+            return detached_->location;
+        if (file_)
+            return file_->get_location(offset_);
+
+        return {};
     }
 
     /**
      * \brief Returns this node's value location in the file as {file}:{line}.
      * \return This node's value location in the file as {file}:{line}
+     * \note For nodes read from a file, the location is computed on first call.
      */
-    std::string_view get_value_location() const noexcept {
-        return value_location_;
+    std::string_view get_value_location() const {
+        if (detached_ && !detached_->value_location.empty())
+            return detached_->value_location;
+        if (file_)
+            return file_->get_location(value_offset_);
+
+        return {};
     }
 
     /**
      * \brief Returns the file in which this node is located.
      * \return The file in which this node is located
      */
-    std::string_view get_filename() const noexcept {
-        auto pos = location_.find(':');
-        return std::string_view(location_.c_str(), pos == location_.npos ? location_.size() : pos);
+    std::string_view get_filename() const {
+        if (file_)
+            return file_->get_file_name();
+
+        const std::string_view location = get_location();
+        return location.substr(0, location.find(':'));
     }
 
     /**
      * \brief Returns the line number on which this node is located.
      * \return The line number on which this node is located
      */
-    std::size_t get_line_number() const noexcept {
-        std::size_t line = std::numeric_limits<std::size_t>::max();
-        auto        pos  = location_.find(':');
-        if (pos != location_.npos && pos < location_.size() - 1) {
-            line = utils::from_string<std::size_t>(location_.substr(pos + 1)).value_or(line);
-        }
-        return line;
+    std::size_t get_line_number() const {
+        return get_line_number_(get_location(), offset_);
     }
 
     /**
      * \brief Returns the line number on which this node's value is located.
      * \return The line number on which this node's value is located
      */
-    std::size_t get_value_line_number() const noexcept {
-        std::size_t line = std::numeric_limits<std::size_t>::max();
-        auto        pos  = value_location_.find(':');
-        if (pos != value_location_.npos && pos < value_location_.size() - 1) {
-            line = utils::from_string<std::size_t>(value_location_.substr(pos + 1)).value_or(line);
-        }
-        return line;
+    std::size_t get_value_line_number() const {
+        return get_line_number_(get_value_location(), value_offset_);
     }
 
     /**
@@ -156,32 +258,81 @@ public:
      * \brief Set this node's location.
      * \param location The new location
      */
-    void set_location(std::string location) noexcept {
-        location_ = std::move(location);
+    void set_location(std::string location) {
+        detach_().location = std::move(location);
+        file_              = nullptr;
+    }
+
+    /**
+     * \brief Set this node's location from a position in a file.
+     * \param file The file containing this node (must outlive this node)
+     * \param offset The byte offset of this node in the file content
+     * \note The location string is only built if get_location() is called.
+     */
+    void set_location(const file_line_mappings& file, std::size_t offset) {
+        if (detached_ && !detached_->location.empty())
+            detach_().location.clear();
+
+        file_   = &file;
+        offset_ = offset;
     }
 
     /**
      * \brief Set this node's value location.
      * \param location The new value location
      */
-    void set_value_location(std::string location) noexcept {
-        value_location_ = std::move(location);
+    void set_value_location(std::string location) {
+        detach_().value_location = std::move(location);
+    }
+
+    /**
+     * \brief Set this node's value location from a position in a file.
+     * \param file The file containing this node (must outlive this node)
+     * \param offset The byte offset of this node's value in the file content
+     * \note The location string is only built if get_value_location() is called.
+     */
+    void set_value_location(const file_line_mappings& file, std::size_t offset) {
+        if (detached_ && !detached_->value_location.empty())
+            detach_().value_location.clear();
+
+        file_         = &file;
+        value_offset_ = offset;
     }
 
     /**
      * \brief Set this node's name.
      * \param name The new name
      */
-    void set_name(std::string name) noexcept {
-        name_ = std::move(name);
+    void set_name(std::string name) {
+        auto& data = detach_();
+        data.name  = std::move(name);
+        name_      = data.name;
+    }
+
+    /**
+     * \brief Set this node's name without copying it.
+     * \param name The new name (must outlive this node, e.g., in the file content)
+     */
+    void set_name_view(std::string_view name) noexcept {
+        name_ = name;
     }
 
     /**
      * \brief Set this node's value.
      * \param value The new value
      */
-    void set_value(std::string value) noexcept {
-        value_ = std::move(value);
+    void set_value(std::string value) {
+        auto& data = detach_();
+        data.value = std::move(value);
+        value_     = data.value;
+    }
+
+    /**
+     * \brief Set this node's value without copying it.
+     * \param value The new value (must outlive this node, e.g., in the file content)
+     */
+    void set_value_view(std::string_view value) noexcept {
+        value_ = value;
     }
 
     /// Flag this node as "not accessed" for later warnings.
@@ -211,10 +362,51 @@ public:
     }
 
 protected:
-    std::string name_;
-    std::string value_;
-    std::string location_;
-    std::string value_location_;
+    /// Strings of a node built or modified by code, which are not in a file.
+    struct detached_data {
+        std::string name;
+        std::string value;
+        std::string location;
+        std::string value_location;
+    };
+
+    detached_data& detach_() {
+        // Copies of this node share the previous data, which must not be modified
+        auto data = detached_ ? std::make_shared<detached_data>(*detached_)
+                              : std::make_shared<detached_data>();
+
+        if (detached_ && name_.data() == detached_->name.data())
+            name_ = data->name;
+        if (detached_ && value_.data() == detached_->value.data())
+            value_ = data->value;
+
+        detached_ = data;
+        return *data;
+    }
+
+    std::size_t get_line_number_(std::string_view location, std::size_t offset) const {
+        if (file_) {
+            std::size_t line = file_->get_line_info(offset).first;
+            return line == 0u ? std::numeric_limits<std::size_t>::max() : line;
+        }
+
+        std::size_t line = std::numeric_limits<std::size_t>::max();
+        auto        pos  = location.find(':');
+        if (pos != location.npos && pos < location.size() - 1) {
+            line = utils::from_string<std::size_t>(location.substr(pos + 1)).value_or(line);
+        }
+        return line;
+    }
+
+    std::string_view name_;
+    std::string_view value_;
+
+    const file_line_mappings* file_         = nullptr;
+    std::size_t               offset_       = file_line_mappings::unknown_offset;
+    std::size_t               value_offset_ = file_line_mappings::unknown_offset;
+
+    // Only allocated for nodes built or modified by code
+    std::shared_ptr<const detached_data> detached_;
 
     mutable bool accessed_      = false;
     mutable bool access_bypass_ = false;
@@ -481,27 +673,50 @@ public:
         return value;
     }
 
+    /**
+     * \brief Pre-allocates memory for children and attributes.
+     * \param num_children The expected number of children
+     * \param num_attributes The expected number of attributes
+     */
+    void reserve(std::size_t num_children, std::size_t num_attributes) {
+        child_list_.reserve(num_children);
+        attr_list_.reserve(num_attributes);
+    }
+
+    /**
+     * \brief Keeps the file this node was read from alive, for as long as this node lives.
+     * \param file The file this node was read from
+     * \note Names, values, and locations of nodes read from a file refer to the file content.
+     * This should be called on the root node of a file. Copies of child nodes must not outlive
+     * the root node.
+     */
+    void set_file_owner(std::shared_ptr<const file_line_mappings> file) noexcept {
+        file_owner_ = std::move(file);
+    }
+
 private:
     child_list     child_list_;
     attribute_list attr_list_;
+
+    std::shared_ptr<const file_line_mappings> file_owner_;
 };
 
 template<>
 inline std::optional<std::string> layout_attribute::try_get_value<std::string>() const noexcept {
     accessed_ = true;
-    return value_;
+    return std::string(value_);
 }
 
 template<>
 inline std::string layout_attribute::get_value<std::string>() const {
     accessed_ = true;
-    return value_;
+    return std::string(value_);
 }
 
 template<>
 inline std::string layout_attribute::get_value_or<std::string>(std::string) const noexcept {
     accessed_ = true;
-    return value_;
+    return std::string(value_);
 }
 
 } // namespace lxgui::gui
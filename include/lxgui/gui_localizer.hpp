@@ -2,6 +2,7 @@
 #define LXGUI_GUI_LOCALIZER_HPP
 
 #include "lxgui/gui_code_point_range.hpp"
+#include "lxgui/gui_translation_table.hpp"
 #include "lxgui/lxgui.hpp"
 
 #include <locale>
@@ -166,9 +167,31 @@ public:
      * 5000 and the locale is enUS, this will result in "5,000 HP". If the value is a Lua function,
      * it must take the same number of input values in all languages, and must return a translated
      * string. See localize() for more information on translation arguments.
+     * Alternatively, the file can be a binary translation table with extension ".lxt" (see
+     * compile_translation_file()). Such files are loaded without running Lua, and only
+     * contain string translations.
+     * Translation strings are parsed once when loaded, so that only the replacement fields
+     * (the parts of the string within braces) need to be formatted by localize().
+     * If several loaded files translate the same key, the file loaded last is used.
      */
     void load_translation_file(const std::string& file_name);
 
+    /**
+     * \brief Converts a Lua translation file into a binary translation table.
+     * \param lua_file_name The path to the Lua translation file to read
+     * \param table_file_name The path to the binary translation table to write
+     * \details The Lua file must follow the format described in load_translation_file().
+     * Translations given as Lua functions cannot be stored in a binary table, and are skipped
+     * with a warning. The binary table can later be loaded with load_translation_file(); it
+     * does not require running Lua, and is faster to load and query for large translation sets.
+     * To be picked up automatically by load_translations(), the table file must be named
+     * "{language}{REGION}.lxt".
+     * \throw gui::exception if the Lua file could not be read, or the table could not be
+     * written.
+     */
+    void compile_translation_file(
+        const std::string& lua_file_name, const std::string& table_file_name) const;
+
     /**
      * \brief Removes all previously loaded translations.
      * \note After calling this function, it is highly recommended to always include at least
@@ -225,20 +248,20 @@ public:
         if (!is_key_valid_(key))
             return std::string{key};
 
-        auto iter = find_key_(key);
-        if (iter == map_.end())
+        const mapped_item* item_ptr = find_key_(key);
+        if (!item_ptr)
             return std::string{key};
 
         return std::visit(
             [&](const auto& item) {
                 constexpr bool is_string =
-                    std::is_same_v<std::decay_t<decltype(item)>, std::string>;
+                    std::is_same_v<std::decay_t<decltype(item)>, format_template>;
                 if constexpr (is_string) {
                     if constexpr (sizeof...(Args) == 0) {
-                        return item;
+                        // Without arguments, the string is returned as is, not formatted
+                        return item.source;
                     } else {
-                        return fmt::format(
-                            locale_, fmt::runtime(item), std::forward<Args>(args)...);
+                        return format_template_(item, fmt::make_format_args(args...));
                     }
                 } else {
                     auto result = item(std::forward<Args>(args)...);
@@ -252,7 +275,7 @@ public:
                         return std::string{key};
                 }
             },
-            iter->second);
+            *item_ptr);
     }
 
     /**
@@ -264,9 +287,37 @@ public:
     void register_on_lua(sol::state& lua);
 
 private:
+    /// Translation string, parsed into literal text and replacement fields.
+    struct format_template {
+        /// Literal text, or a replacement field formatting argument 'index' alone.
+        struct segment {
+            std::string text;
+            std::size_t index    = 0u;
+            bool        is_field = false;
+        };
+
+        std::string          source;
+        std::vector<segment> segments;
+        std::size_t          literal_size = 0u;
+        bool                 is_compiled  = false;
+    };
+
     using hash_type   = std::size_t;
-    using mapped_item = std::variant<std::string, sol::protected_function>;
-    using map_type    = std::unordered_map<hash_type, mapped_item>;
+    using mapped_item = std::variant<format_template, sol::protected_function>;
+
+    /// Translations of all files are looked up in load order: the last loaded file wins.
+    struct loaded_item {
+        mapped_item item;
+        std::size_t load_index = 0u;
+    };
+
+    using map_type = std::unordered_map<hash_type, loaded_item>;
+
+    struct loaded_table {
+        translation_table        table;
+        std::vector<mapped_item> items;
+        std::size_t              load_index = 0u;
+    };
 
     std::locale                   locale_;
     std::vector<std::string>      languages_;
@@ -274,10 +325,17 @@ private:
     char32_t                      default_code_point_ = U'\u25a1'; // '□'
     sol::state                    lua_;
     map_type                      map_;
+    std::vector<loaded_table>     tables_;
+    std::size_t                   load_count_ = 0u;
+
+    bool               is_key_valid_(std::string_view key) const;
+    const mapped_item* find_key_(std::string_view key) const;
+    void               reset_language_fallback_();
+    void               load_translation_table_(const std::string& file_name);
 
-    bool                     is_key_valid_(std::string_view key) const;
-    map_type::const_iterator find_key_(std::string_view key) const;
-    void                     reset_language_fallback_();
+    static format_template compile_format_(std::string_view message);
+    std::string format_template_(const format_template& tpl, fmt::format_args args) const;
+    std::string format_template_(const format_template& tpl, sol::variadic_args args) const;
 };
 
 } // namespace lxgui::gui
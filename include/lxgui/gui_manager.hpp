@@ -1,6 +1,7 @@
 #ifndef LXGUI_GUI_MANAGER_HPP
 #define LXGUI_GUI_MANAGER_HPP
 
+#include "lxgui/gui_saved_variables.hpp"
 #include "lxgui/input_keys.hpp"
 #include "lxgui/lxgui.hpp"
 #include "lxgui/utils_observer.hpp"
@@ -30,6 +31,12 @@ class world_dispatcher;
 
 } // namespace lxgui::input
 
+namespace lxgui::utils {
+
+class file_watcher;
+
+} // namespace lxgui::utils
+
 namespace lxgui::gui {
 
 class renderer;
@@ -39,6 +46,8 @@ class root;
 class virtual_root;
 class addon_registry;
 class event_emitter;
+class render_snapshot_buffer;
+class timer_scheduler;
 
 /// Manages the user interface
 class manager : utils::enable_observer_from_this<manager> {
@@ -146,6 +155,71 @@ public:
      */
     void clear_localization_directory_list();
 
+    /**
+     * \brief Sets the file format used to save the variables of addons.
+     * \param format The new format
+     * \note The default is saved_variables_format::lua. If the UI is already loaded, this
+     * change will only take effect after the UI is reloaded, see reload_ui().
+     */
+    void set_saved_variables_format(saved_variables_format format);
+
+    /**
+     * \brief Returns the file format used to save the variables of addons.
+     * \return The file format used to save the variables of addons
+     */
+    saved_variables_format get_saved_variables_format() const;
+
+    /**
+     * \brief Reloads addon files automatically when they are modified on disk.
+     * \param enabled 'true' to enable hot reload, 'false' to disable it
+     * \note When enabled, the addon and localization directories are watched for changes (see
+     * utils::file_watcher), which are checked at the start of update_ui(). Modified Lua scripts
+     * are executed again, and modified layout files re-create their frames, without closing the
+     * UI (see addon_registry::reload_files()). Other changes (TOC files, translations, textures,
+     * fonts, virtual frames) trigger a full reload, as with reload_ui(); textures and fonts which
+     * have not been modified are then kept alive by the renderer (see
+     * renderer::set_resource_retention_enabled()), and do not need to be loaded again.
+     * \note This is meant for development, and is disabled by default. If the UI is already
+     * loaded, enabling hot reload will only take effect after the UI is reloaded, see
+     * reload_ui().
+     */
+    void set_hot_reload_enabled(bool enabled);
+
+    /**
+     * \brief Checks if addon files are reloaded automatically when they are modified on disk.
+     * \return 'true' if hot reload is enabled, 'false' otherwise
+     */
+    bool is_hot_reload_enabled() const;
+
+    /**
+     * \brief Allows rendering the UI on a separate thread, while the next update is computed.
+     * \param enabled 'true' to render from snapshots, 'false' to render directly
+     * \note By default, render_ui() renders the regions directly, and must be called on the same
+     * thread as update_ui(). When this option is enabled, update_ui() instead records all the
+     * rendering operations (including those into render targets, such as the strata caches)
+     * into a render snapshot (see gui::render_snapshot), and render_ui() submits the last
+     * recorded snapshot to the renderer. Two snapshots are used in turn, so render_ui() can be
+     * called from a render thread while update_ui() runs Lua and layout code on another
+     * thread (this requires LXGUI_ENABLE_MULTITHREADING); update_ui() only waits for
+     * render_ui() if it is still submitting the previous snapshot.
+     * \note Vertex caches are not used while recording: the quads of each region are copied
+     * into the snapshot instead. Materials, fonts, and render targets (strata caches, frame
+     * caches, scroll frames) are however still created, resized, and destroyed on the thread
+     * calling update_ui(). With the OpenGL backend, this thread must therefore have its own
+     * OpenGL context made current, sharing its objects with the context of the render thread
+     * (e.g., created with SDL_GL_SHARE_WITH_CURRENT_CONTEXT, or an sf::Context). All other
+     * functions of the manager must be called on the thread calling update_ui(). This
+     * option must not be changed while render_ui() is running.
+     */
+    void set_threaded_rendering_enabled(bool enabled);
+
+    /**
+     * \brief Checks if the UI is rendered from snapshots, possibly on a separate thread.
+     * \return 'true' if the UI is rendered from snapshots, 'false' otherwise
+     * \note See set_threaded_rendering_enabled().
+     */
+    bool is_threaded_rendering_enabled() const;
+
     /**
      * \brief Triggers on each fresh Lua state (e.g., on startup or after a UI re-load).
      * \note This signal is useful if you need to create additionnal
@@ -180,7 +254,11 @@ public:
 
     /**
      * \brief Closes the UI (immediately).
-     * \note All regions will be deleted, and the Lua state will be closed.
+     * \note All regions will be deleted, all timers will be cancelled (see
+     * get_timer_scheduler()), and the Lua state will be closed. Saved variables
+     * are serialized immediately, but their files may be written in the background (see
+     * saved_variables_writer); they are always written before the UI is loaded again, or
+     * before the manager is destroyed.
      * \warning Do not call this function while the manager is running update_ui()
      * (i.e., do not call this directly from a frame's callback, C++ or Lua).
      */
@@ -210,7 +288,9 @@ public:
 
     /**
      * \brief Renders the UI into the current render target.
-     * \note This should be called after @ref update_ui().
+     * \note This should be called after @ref update_ui(). If threaded rendering is enabled,
+     * this renders the last snapshot recorded by update_ui(), and can be called from another
+     * thread (see set_threaded_rendering_enabled()).
      */
     void render_ui() const;
 
@@ -312,6 +392,23 @@ public:
         return *event_emitter_;
     }
 
+    /**
+     * \brief Returns the timer scheduler, to call functions after a delay or at intervals.
+     * \return The timer scheduler
+     * \note Timers are updated at the start of update_ui(). Closing the UI cancels all timers.
+     */
+    timer_scheduler& get_timer_scheduler() {
+        return *timer_scheduler_;
+    }
+
+    /**
+     * \brief Returns the timer scheduler, to call functions after a delay or at intervals.
+     * \return The timer scheduler
+     */
+    const timer_scheduler& get_timer_scheduler() const {
+        return *timer_scheduler_;
+    }
+
     /**
      * \brief Returns the object used for localizing strings.
      * \return The current localizer
@@ -411,12 +508,21 @@ private:
      */
     void read_files_();
 
+    /**
+     * \brief Reloads the files modified since the last call, if hot reload is enabled.
+     * \note See set_hot_reload_enabled().
+     */
+    void update_hot_reload_();
+
     // Persistent state
     float                    scaling_factor_      = 1.0f;
     float                    base_scaling_factor_ = 1.0f;
     bool                     enable_caching_      = false;
     std::vector<std::string> localization_directory_list_;
     std::vector<std::string> gui_directory_list_;
+    saved_variables_format   saved_variables_format_ = saved_variables_format::lua;
+    saved_variables_writer   saved_variables_writer_;
+    bool                     hot_reload_enabled_ = false;
 
     // Implementations
     std::unique_ptr<input::source> input_source_;
@@ -427,6 +533,7 @@ private:
     std::unique_ptr<input::dispatcher>       input_dispatcher_;
     std::unique_ptr<input::world_dispatcher> world_input_dispatcher_;
     std::unique_ptr<event_emitter>           event_emitter_;
+    std::unique_ptr<timer_scheduler>         timer_scheduler_;
 
     // UI state
     std::unique_ptr<factory>        factory_;
@@ -436,6 +543,13 @@ private:
     utils::owner_ptr<virtual_root>  virtual_root_;
     std::unique_ptr<addon_registry> addon_registry_;
 
+    // Hot reload
+    std::unique_ptr<utils::file_watcher> file_watcher_;
+    std::vector<std::string>             modified_file_list_;
+
+    // Threaded rendering
+    std::unique_ptr<render_snapshot_buffer> snapshot_buffer_;
+
     bool is_loaded_          = false;
     bool reload_ui_flag_     = false;
     bool close_ui_flag_      = false;
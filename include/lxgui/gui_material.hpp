@@ -6,14 +6,17 @@
 #include "lxgui/lxgui.hpp"
 #include "lxgui/utils.hpp"
 
+#include <memory>
+
 namespace lxgui::gui {
 
 /**
  * \brief A class that holds rendering data
  * \details This is an abstract class that must be implemented
- * and created by the corresponding gui::renderer.
+ * and created by the corresponding gui::renderer. Materials are created in a
+ * std::shared_ptr, so render snapshots can keep them alive (see gui::render_snapshot).
  */
-class material {
+class material : public std::enable_shared_from_this<material> {
 public:
     enum class wrap { repeat, clamp };
 
@@ -2,15 +2,18 @@
 #define LXGUI_GUI_REGION_HPP
 
 #include "lxgui/gui_anchor.hpp"
+#include "lxgui/gui_animation.hpp"
 #include "lxgui/gui_bounds2.hpp"
 #include "lxgui/gui_color.hpp"
 #include "lxgui/gui_exception.hpp"
+#include "lxgui/gui_matrix4.hpp"
 #include "lxgui/gui_region_core_attributes.hpp"
 #include "lxgui/gui_vector2.hpp"
 #include "lxgui/lxgui.hpp"
 #include "lxgui/utils.hpp"
 #include "lxgui/utils_maths.hpp"
 #include "lxgui/utils_observer.hpp"
+#include "lxgui/utils_pool_allocator.hpp"
 
 #include <array>
 #include <lxgui/extern_sol2_object.hpp>
@@ -161,8 +164,13 @@ class frame_renderer;
 class region : public utils::enable_observer_from_this<region> {
     friend factory;
     friend frame;
+    friend animation_group;
 
 public:
+    /// Type of the list of objects anchored to a region (allocated from the memory pools).
+    using anchored_object_list = std::
+        vector<utils::observer_ptr<region>, utils::pool_allocator<utils::observer_ptr<region>>>;
+
     /// Contructor.
     explicit region(utils::control_block& block, manager& mgr, const region_core_attributes& attr);
 
@@ -627,7 +635,7 @@ public:
      * \brief Returns the list of all objects that are anchored to this one.
      * \return The list of all objects that are anchored to this one
      */
-    const std::vector<utils::observer_ptr<region>>& get_anchored_objects() const;
+    const anchored_object_list& get_anchored_objects() const;
 
     /**
      * \brief Notifies this region that it has been fully loaded.
@@ -659,6 +667,38 @@ public:
      */
     virtual void notify_invisible();
 
+    /**
+     * \brief Creates a new animation group for this region.
+     * \param name The name of the group
+     * \return The new group, or the existing group if one already exists with this name
+     * \note See animation_group for more information.
+     */
+    utils::observer_ptr<animation_group> create_animation_group(const std::string& name);
+
+    /**
+     * \brief Returns one of this region's animation groups.
+     * \param name The name of the group
+     * \return The group, or nullptr if no group exists with this name
+     */
+    utils::observer_ptr<animation_group> get_animation_group(const std::string& name);
+
+    /**
+     * \brief Returns one of this region's animation groups.
+     * \param name The name of the group
+     * \return The group, or nullptr if no group exists with this name
+     */
+    utils::observer_ptr<const animation_group> get_animation_group(const std::string& name) const;
+
+    /// Stops all the animation groups of this region.
+    void stop_animations();
+
+    /**
+     * \brief Returns the render-time transformation applied by animations, if any.
+     * \return The transformation, or std::nullopt if none
+     * \note This transformation does not include the parent's transformation.
+     */
+    const std::optional<matrix4f>& get_animation_transform() const;
+
     /**
      * \brief Sets the addon this frame belongs to.
      * \param a The addon this frame belongs to
@@ -754,6 +794,18 @@ protected:
 
     virtual void update_borders_();
 
+    virtual void notify_alpha_changed_();
+
+    // Animations
+    virtual void parse_animations_node_(const layout_node& node);
+
+    virtual std::optional<color> get_animation_color_() const;
+    virtual void                 set_animation_color_(const color& c);
+
+    void         set_animation_transform_(const std::optional<matrix4f>& transform);
+    virtual void notify_animation_transform_changed_();
+    void         apply_animation_groups_();
+
     sol::state&       get_lua_();
     const sol::state& get_lua_() const;
 
@@ -821,7 +873,12 @@ protected:
 
     vector2f dimensions_;
 
-    std::vector<utils::observer_ptr<region>> anchored_object_list_;
+    anchored_object_list anchored_object_list_;
+
+    std::vector<utils::owner_ptr<animation_group>> animation_group_list_;
+    std::optional<matrix4f>                        animation_transform_;
+    std::optional<float>                           animation_base_alpha_;
+    std::optional<color>                           animation_base_color_;
 };
 
 /**
@@ -0,0 +1,169 @@
+#ifndef LXGUI_GUI_RENDER_SNAPSHOT_HPP
+#define LXGUI_GUI_RENDER_SNAPSHOT_HPP
+
+#include "lxgui/gui_bounds2.hpp"
+#include "lxgui/gui_color.hpp"
+#include "lxgui/gui_matrix4.hpp"
+#include "lxgui/gui_vertex.hpp"
+#include "lxgui/lxgui.hpp"
+#include "lxgui/utils.hpp"
+
+#include <array>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#if defined(LXGUI_ENABLE_MULTITHREADING)
+#    include <condition_variable>
+#    include <mutex>
+#endif
+
+namespace lxgui::gui {
+
+class material;
+class render_target;
+class renderer;
+
+/**
+ * \brief A recorded list of rendering operations, which can be submitted later.
+ * \details A snapshot is recorded by calling renderer::begin_snapshot(), then rendering as
+ * usual, then calling renderer::end_snapshot(). Instead of being drawn, the quads are copied
+ * into a single packed list, and each rendering operation is stored as a command referring to
+ * these quads. Materials and render targets are referenced with shared pointers, so the
+ * snapshot does not depend on the regions which were rendered: it can be submitted with
+ * renderer::submit_snapshot() after these regions have changed, or been destroyed, and from
+ * another thread. Vertex caches are not used while recording, since their content could
+ * change before the snapshot is submitted.
+ */
+class render_snapshot {
+public:
+    /// Creates an empty snapshot.
+    render_snapshot() = default;
+
+    /**
+     * \brief Removes all the recorded commands.
+     * \note This keeps the allocated memory, to record the next snapshot.
+     */
+    void clear();
+
+    /**
+     * \brief Checks if this snapshot contains any command.
+     * \return 'true' if this snapshot contains no command, 'false' otherwise
+     */
+    bool is_empty() const;
+
+    /**
+     * \brief Returns the number of recorded commands.
+     * \return The number of recorded commands
+     * \note Consecutive quads sharing the same material are merged into a single command.
+     */
+    std::size_t get_command_count() const;
+
+    /**
+     * \brief Returns the number of recorded quads.
+     * \return The number of recorded quads
+     */
+    std::size_t get_quad_count() const;
+
+private:
+    friend class renderer;
+    friend class render_snapshot_buffer;
+
+    enum class command_type {
+        begin,
+        end,
+        clear,
+        set_view,
+        set_scissor,
+        set_distance_field_threshold,
+        render_quads
+    };
+
+    struct command {
+        command_type                    type = command_type::render_quads;
+        std::shared_ptr<render_target>  target;
+        std::shared_ptr<const material> mat;
+        std::size_t                     first_quad = 0u;
+        std::size_t                     num_quads  = 0u;
+        matrix4f                        matrix     = matrix4f::identity;
+        color                           tint       = color::white;
+        std::optional<bounds2f>         rect;
+        std::optional<float>            threshold;
+    };
+
+    command& add_command_(command_type type);
+
+    void add_quads_(const material* mat, const std::vector<std::array<vertex, 4>>& quad_list);
+
+    void prepend_target_passes_(const render_snapshot& previous);
+
+    std::vector<command>               command_list_;
+    std::vector<std::array<vertex, 4>> quad_list_;
+    std::size_t                        culled_frame_count_  = 0u;
+    std::size_t                        culled_region_count_ = 0u;
+};
+
+/**
+ * \brief Two render snapshots, to record one while the other is submitted.
+ * \details The update thread records into the back snapshot (see get_back_snapshot()), then
+ * calls swap() to publish it. The render thread calls submit(), which renders the last
+ * published snapshot. If multi-threading is enabled (see LXGUI_ENABLE_MULTITHREADING), these
+ * can be called from two different threads: swap() then waits until the published snapshot is
+ * no longer being submitted, and submit() never waits for the update thread. Otherwise,
+ * they must be called from the same thread.
+ */
+class render_snapshot_buffer {
+public:
+    /// Creates a buffer with no published snapshot.
+    render_snapshot_buffer() = default;
+
+    // Non-copiable, non-movable
+    render_snapshot_buffer(const render_snapshot_buffer&)            = delete;
+    render_snapshot_buffer(render_snapshot_buffer&&)                 = delete;
+    render_snapshot_buffer& operator=(const render_snapshot_buffer&) = delete;
+    render_snapshot_buffer& operator=(render_snapshot_buffer&&)      = delete;
+
+    /**
+     * \brief Returns the snapshot to record into.
+     * \return The snapshot to record into
+     * \note This must only be used by the update thread.
+     */
+    render_snapshot& get_back_snapshot();
+
+    /**
+     * \brief Publishes the back snapshot, which will be rendered by the next call to submit().
+     * \note The previously published snapshot becomes the new back snapshot. If it was not
+     * submitted yet, its main pass is skipped, but its passes into render targets are moved to
+     * the published snapshot: render targets are only drawn when their content changes, so
+     * these passes cannot be dropped.
+     */
+    void swap();
+
+    /**
+     * \brief Renders the last published snapshot.
+     * \param rdr The renderer to submit the snapshot to
+     * \return 'true' if a snapshot was rendered, 'false' if no snapshot was published yet
+     * \note The same snapshot is rendered again if no new snapshot was published since the
+     * last call.
+     */
+    bool submit(renderer& rdr);
+
+    /// Releases the content of both snapshots, and forgets the published snapshot.
+    void clear();
+
+private:
+    std::array<render_snapshot, 2> snapshot_list_;
+    std::size_t                    front_index_        = 0u;
+    bool                           has_front_          = false;
+    bool                           is_front_submitted_ = false;
+    bool                           is_submitting_      = false;
+
+#if defined(LXGUI_ENABLE_MULTITHREADING)
+    std::mutex              mutex_;
+    std::condition_variable condition_;
+#endif
+};
+
+} // namespace lxgui::gui
+
+#endif
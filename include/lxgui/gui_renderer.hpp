@@ -1,6 +1,7 @@
 #ifndef LXGUI_GUI_RENDERER_HPP
 #define LXGUI_GUI_RENDERER_HPP
 
+#include "lxgui/gui_bounds2.hpp"
 #include "lxgui/gui_code_point_range.hpp"
 #include "lxgui/gui_material.hpp"
 #include "lxgui/gui_matrix4.hpp"
@@ -9,6 +10,7 @@
 
 #include <array>
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -18,6 +20,7 @@ namespace lxgui::gui {
 class font;
 class atlas;
 class render_target;
+class render_snapshot;
 class color;
 struct quad;
 struct vertex;
@@ -55,6 +58,14 @@ public:
      */
     virtual bool is_texture_vertex_color_supported() const = 0;
 
+    /**
+     * \brief Checks if the fonts of this renderer store glyphs in single-channel textures.
+     * \return 'true' if font textures have a single channel, 'false' if they are RGBA
+     * \note Single-channel font textures use four times less memory. They cannot share
+     * a texture with RGBA materials, hence create_atlas_font() places them in separate atlases.
+     */
+    virtual bool is_single_channel_font_supported() const = 0;
+
     /**
      * \brief Checks if the renderer has quad render batching enabled.
      * \return 'true' if enabled, 'false' otherwise
@@ -140,6 +151,8 @@ public:
     /**
      * \brief Checks if the renderer has enabled support for vertex caches.
      * \return 'true' if vertex caches are supported and enabled, 'false' otherwise
+     * \note This returns 'false' while a snapshot is being recorded on this thread (see
+     * begin_snapshot()), so that regions render quads instead.
      */
     bool is_vertex_cache_enabled() const;
 
@@ -151,6 +164,57 @@ public:
      */
     void set_vertex_cache_enabled(bool enabled);
 
+    /**
+     * \brief Checks if the renderer supports the compact vertex layout in vertex caches.
+     * \return 'true' if supported, 'false' otherwise
+     * \note See gui::packed_vertex.
+     */
+    virtual bool is_packed_vertex_supported() const = 0;
+
+    /**
+     * \brief Checks if vertex caches use the compact vertex layout.
+     * \return 'true' if the compact layout is supported and enabled, 'false' otherwise
+     */
+    bool is_packed_vertex_enabled() const;
+
+    /**
+     * \brief Enables/disables the compact vertex layout in vertex caches.
+     * \param enabled 'true' to enable the compact layout, 'false' to disable it
+     * \note The compact layout is disabled by default. When enabled, vertex caches store
+     * vertices as gui::packed_vertex, which halves the amount of data uploaded to the GPU.
+     * Vertices with texture coordinates outside of the range [0,1] (repeat wrapping) cannot
+     * be packed; caches holding such vertices automatically fall back to the full layout.
+     * \note Changing this flag will only impact newly created vertex caches, and the caches
+     * used for quad batching. Existing caches will not be affected. This function must not
+     * be called between begin() and end().
+     */
+    void set_packed_vertex_enabled(bool enabled);
+
+    /**
+     * \brief Checks if the renderer supports rendering distance field fonts.
+     * \return 'true' if supported, 'false' otherwise
+     * \see create_distance_field_font()
+     */
+    virtual bool is_distance_field_supported() const = 0;
+
+    /**
+     * \brief Checks if font strings use distance field fonts.
+     * \return 'true' if distance field fonts are supported and enabled, 'false' otherwise
+     */
+    bool is_distance_field_font_enabled() const;
+
+    /**
+     * \brief Enables/disables distance field fonts for font strings.
+     * \param enabled 'true' to enable distance field fonts, 'false' to disable them
+     * \note Distance field fonts are disabled by default. When enabled, font strings use a
+     * single font texture per font file, for all sizes, outlines, and interface scaling
+     * factors, instead of one rasterized font texture per combination. Renderers which do not
+     * support distance field fonts (see is_distance_field_supported()) fall back to
+     * rasterized fonts. Changing this flag will only impact newly created font strings, or
+     * font strings which change font.
+     */
+    void set_distance_field_font_enabled(bool enabled);
+
     /// Automatically determines the best rendering settings for the current platform.
     void auto_detect_settings();
 
@@ -173,6 +237,37 @@ public:
      */
     std::size_t get_vertex_count() const;
 
+    /**
+     * \brief Returns the number of frames skipped since the last call to reset_counters.
+     * \return The number of frames skipped since the last call to reset_counters
+     * \note Frames are skipped if they are fully transparent, or if none of their content
+     * is within the visible area of the render target (see is_in_view()).
+     */
+    std::size_t get_culled_frame_count() const;
+
+    /**
+     * \brief Returns the number of layered regions skipped since the last call to reset_counters.
+     * \return The number of layered regions skipped since the last call to reset_counters
+     * \note Layered regions are skipped if they are fully transparent, or if they are not
+     * within the visible area of the render target (see is_in_view()). Regions of skipped
+     * frames are not counted.
+     */
+    std::size_t get_culled_region_count() const;
+
+    /// Tells this renderer that a frame was skipped (for analytics only).
+    void notify_culled_frame();
+
+    /// Tells this renderer that a layered region was skipped (for analytics only).
+    void notify_culled_region();
+
+    /**
+     * \brief Checks if a rectangle is (at least partly) visible with the current view.
+     * \param rect The rectangle to check, in the coordinates of the current view
+     * \return 'true' if the rectangle is visible, or if the view is unknown
+     * \note The visible area is defined by the last call to set_view() since begin().
+     */
+    bool is_in_view(const bounds2f& rect) const;
+
     /**
      * \brief Begins rendering on a particular render target.
      * \param target The render target (main screen if nullptr)
@@ -198,6 +293,16 @@ public:
      */
     void flush_quad_batch();
 
+    /**
+     * \brief Clears the current render target.
+     * \param c The color to clear the render target with
+     * \note The current render target is the one given to begin(); this has no effect when
+     * rendering on the main screen. Unlike render_target::clear(), this can be recorded in a
+     * snapshot (see begin_snapshot()). This function is meant to be called between begin() and
+     * end() only.
+     */
+    void clear(const color& c);
+
     /**
      * \brief Sets the view matrix to use when rendering (viewport).
      * \param view_matrix The view matrix
@@ -221,9 +326,40 @@ public:
      * \return The current view matrix to use when rendering
      * \note See set_view() for more information. The returned matrix may be different
      * from the matrix given to set_view(), if the rendering backend does not
-     * support certain transformations.
+     * support certain transformations. While recording a snapshot, this returns the
+     * matrix given to set_view().
+     */
+    matrix4f get_view() const;
+
+    /**
+     * \brief Checks if the renderer supports restricting rendering to a rectangle.
+     * \return 'true' if supported, 'false' otherwise
+     * \see set_scissor()
      */
-    virtual matrix4f get_view() const = 0;
+    virtual bool is_scissor_supported() const = 0;
+
+    /**
+     * \brief Restricts rendering to a rectangle of the current render target.
+     * \param rect The rectangle in pixels of the render target (origin at the top-left
+     * corner), or std::nullopt to render on the whole render target
+     * \note Clearing the render target is also restricted to this rectangle. The rectangle
+     * is reset by end(). If is_scissor_supported() is 'false', this function
+     * has no effect. This function is meant to be called between begin() and end() only.
+     */
+    void set_scissor(const std::optional<bounds2f>& rect);
+
+    /**
+     * \brief Sets the distance threshold to use when rendering distance field fonts.
+     * \param threshold The value of the distance field (between 0 and 1) at the edge of the
+     * rendered glyphs, or std::nullopt to render materials normally
+     * \note When a threshold is set, all textured quads and vertex caches are rendered as
+     * distance fields, which must only be used with the material of a distance field font
+     * (see create_distance_field_font()). A threshold of 0.5 renders the glyphs as designed,
+     * and lower values render thicker glyphs (e.g., for outlines). The threshold is reset by
+     * end(). If is_distance_field_supported() is 'false', this function has no effect. This
+     * function is meant to be called between begin() and end() only.
+     */
+    void set_distance_field_threshold(const std::optional<float>& threshold);
 
     /**
      * \brief Renders a quad.
@@ -249,6 +385,7 @@ public:
      * \param mat The material to use for rendering, or null if none
      * \param cache The vertex cache
      * \param model_transform The transformation matrix to apply to vertices
+     * \param tint The color to multiply with the color of each vertex
      * \note This function is meant to be called between begin() and
      * end() only. When multiple quads share the same material, it is
      * always more efficient to call this method than calling render_quad
@@ -260,11 +397,16 @@ public:
      * call, no matter what, even when quad batching is enabled. For this reason,
      * if quad batching is enabled, only use vertex caches for large vertex arrays
      * and not for just a handful of quads. Benchmark when in doubt.
+     * \note The tint is applied when drawing, so that the color or transparency of cached
+     * vertices can be changed without updating the cache.
+     * \throw gui::exception if a snapshot is being recorded on this thread: the content of the
+     * cache could change before the snapshot is submitted.
      */
     void render_cache(
         const material*     mat,
         const vertex_cache& cache,
-        const matrix4f&     model_transform = matrix4f::identity);
+        const matrix4f&     model_transform = matrix4f::identity,
+        const color&        tint            = color::white);
 
     /**
      * \brief Creates a new material from a texture file.
@@ -372,7 +514,9 @@ public:
      * \note Even though the gui has been designed to use vector fonts files
      * (such as .ttf or .otf font formats), nothing prevents the implementation
      * from using any other font type, including bitmap fonts.
-     * \note See create_atlas_material() for more information on atlases.
+     * \note See create_atlas_material() for more information on atlases. If fonts use
+     * single-channel textures (see is_single_channel_font_supported()), they are placed in
+     * atlases separate from the materials of the same category.
      */
     std::shared_ptr<font> create_atlas_font(
         const std::string&                   atlas_category,
@@ -382,6 +526,87 @@ public:
         const std::vector<code_point_range>& code_points,
         char32_t                             default_code_point);
 
+    /**
+     * \brief Creates a new distance field font.
+     * \param font_file The file from which to read the font
+     * \param code_points The list of Unicode characters to load
+     * \param default_code_point The character to display as fallback
+     * \note The font is created once at distance_field_font_size, and can be rendered at any
+     * size, with or without outline, using set_distance_field_threshold().
+     * \note Not all implementations support distance field fonts.
+     * See is_distance_field_supported().
+     */
+    std::shared_ptr<font> create_distance_field_font(
+        const std::string&                   font_file,
+        const std::vector<code_point_range>& code_points,
+        char32_t                             default_code_point);
+
+    /// Size (in pixels) at which distance field fonts are created.
+    static constexpr std::size_t distance_field_font_size = 32u;
+
+    /// Largest distance (in pixels of the font texture) stored in distance field fonts.
+    static constexpr std::size_t distance_field_spread = 8u;
+
+    /**
+     * \brief Starts recording rendering operations into a snapshot, instead of rendering them.
+     * \param snapshot The snapshot to record into (commands are appended)
+     * \throw gui::exception if a snapshot is already being recorded on this thread.
+     * \note Until end_snapshot() is called on the same thread, calls to begin(), end(), clear(),
+     * set_view(), set_scissor(), set_distance_field_threshold(), render_quad(), and
+     * render_quads() made from this thread are recorded; the quads are copied into the
+     * snapshot. Vertex caches cannot be recorded (see is_vertex_cache_enabled()). Other threads
+     * can meanwhile render normally, or submit another snapshot (see submit_snapshot()).
+     * Resources (materials, fonts, and render targets) are still created, updated, and
+     * destroyed immediately, so the backend must allow this from the recording thread.
+     */
+    void begin_snapshot(render_snapshot& snapshot);
+
+    /// Stops recording rendering operations on this thread (see begin_snapshot()).
+    void end_snapshot();
+
+    /**
+     * \brief Checks if rendering operations are being recorded on this thread.
+     * \return 'true' if a snapshot is being recorded on this thread, 'false' otherwise
+     */
+    bool is_recording_snapshot() const;
+
+    /**
+     * \brief Renders a snapshot.
+     * \param snapshot The snapshot to render
+     * \note The recorded operations are applied in order, as if they had been called
+     * directly: quads are batched at this point (see is_quad_batching_enabled()). If the
+     * snapshot was recorded between begin() and end(), it must be submitted between begin()
+     * and end() too. The snapshot is not modified, and can be submitted again.
+     */
+    void submit_snapshot(const render_snapshot& snapshot);
+
+    /**
+     * \brief Checks if materials and fonts loaded from files are kept alive when unused.
+     * \return 'true' if resources are kept alive, 'false' otherwise
+     */
+    bool is_resource_retention_enabled() const;
+
+    /**
+     * \brief Keeps materials and fonts loaded from files alive, even when unused.
+     * \param enabled 'true' to keep resources alive, 'false' to release them when unused
+     * \note By default, materials and fonts are destroyed as soon as they are no longer used,
+     * for example when the UI is closed. When retention is enabled, the renderer keeps them
+     * alive, so re-loading the UI does not decode textures or rasterize fonts again. This is
+     * enabled by manager::set_hot_reload_enabled(). See also release_unused_resources().
+     */
+    void set_resource_retention_enabled(bool enabled);
+
+    /**
+     * \brief Stops keeping alive the materials and fonts loaded from a file.
+     * \param file_name The texture or font file
+     * \note Use this when the file has been modified, so it is loaded again the next time it
+     * is used. Resources which are still in use remain valid.
+     */
+    void release_resources(const std::string& file_name);
+
+    /// Destroys the materials and fonts which are only kept alive by resource retention.
+    void release_unused_resources();
+
     /**
      * \brief Creates a new empty vertex cache.
      * \param type The type of data this cache will hold
@@ -423,6 +648,26 @@ protected:
      */
     virtual void set_view_(const matrix4f& view_matrix) = 0;
 
+    /**
+     * \brief Returns the current view matrix to use when rendering (viewport).
+     * \return The current view matrix to use when rendering
+     */
+    virtual matrix4f get_view_() const = 0;
+
+    /**
+     * \brief Restricts rendering to a rectangle of the current render target.
+     * \param rect The rectangle in pixels of the render target (origin at the top-left
+     * corner), or std::nullopt to render on the whole render target
+     */
+    virtual void set_scissor_(const std::optional<bounds2f>& rect) = 0;
+
+    /**
+     * \brief Sets the distance threshold to use when rendering distance field fonts.
+     * \param threshold The value of the distance field at the edge of the rendered glyphs,
+     * or std::nullopt to render materials normally
+     */
+    virtual void set_distance_field_threshold_(const std::optional<float>& threshold) = 0;
+
     /**
      * \brief Renders a set of quads.
      * \param mat The material to use for rendering, or null if none
@@ -440,6 +685,7 @@ protected:
      * \param mat The material to use for rendering, or null if none
      * \param cache The vertex cache
      * \param model_transform The transformation matrix to apply to vertices
+     * \param tint The color to multiply with the color of each vertex
      * \note This function is meant to be called between begin() and
      * end() only. When multiple quads share the same material, it is
      * always more efficient to call this method than calling render_quad
@@ -453,7 +699,10 @@ protected:
      * and not for just a handful of quads. Benchmark when in doubt.
      */
     virtual void render_cache_(
-        const material* mat, const vertex_cache& cache, const matrix4f& model_transform) = 0;
+        const material*     mat,
+        const vertex_cache& cache,
+        const matrix4f&     model_transform,
+        const color&        tint) = 0;
 
     /**
      * \brief Creates a new material from a texture file.
@@ -469,9 +718,12 @@ protected:
     /**
      * \brief Creates a new atlas with a given texture filter mode.
      * \param filt The filtering to apply to the texture
+     * \param single_channel 'true' if the atlas holds single-channel font textures
      * \return The new atlas
+     * \note Single-channel atlases are only requested if is_single_channel_font_supported()
+     * returns 'true'.
      */
-    virtual std::shared_ptr<atlas> create_atlas_(material::filter filt) = 0;
+    virtual std::shared_ptr<atlas> create_atlas_(material::filter filt, bool single_channel) = 0;
 
     /**
      * \brief Creates a new font.
@@ -491,7 +743,28 @@ protected:
         const std::vector<code_point_range>& code_points,
         char32_t                             default_code_point) = 0;
 
-    atlas& get_atlas_(const std::string& atlas_category, material::filter filt);
+    /**
+     * \brief Creates a new distance field font.
+     * \param font_file The file from which to read the font
+     * \param size The size of the characters in the font texture (in pixels)
+     * \param spread The largest distance stored in the distance field (in pixels)
+     * \param code_points The list of Unicode characters to load
+     * \param default_code_point The character to display as fallback
+     */
+    virtual std::shared_ptr<font> create_distance_field_font_(
+        const std::string&                   font_file,
+        std::size_t                          size,
+        std::size_t                          spread,
+        const std::vector<code_point_range>& code_points,
+        char32_t                             default_code_point) = 0;
+
+    atlas& get_atlas_(
+        const std::string& atlas_category, material::filter filt, bool single_channel = false);
+
+    std::shared_ptr<gui::material>
+    load_material_(const std::string& file_name, material::filter filt);
+
+    void retain_resource_(const std::string& file_name, std::shared_ptr<const void> resource);
 
     std::unordered_map<std::string, std::weak_ptr<gui::material>> texture_list_;
     std::unordered_map<std::string, std::shared_ptr<gui::atlas>>  atlas_list_;
@@ -500,10 +773,27 @@ protected:
 private:
     bool uses_same_texture_(const material* mat1, const material* mat2) const;
 
-    bool        texture_atlas_enabled_   = true;
-    bool        vertex_cache_enabled_    = true;
-    bool        quad_batching_enabled_   = true;
-    std::size_t texture_atlas_page_size_ = 0u;
+    render_snapshot* get_recorded_snapshot_() const;
+
+    void batch_quads_(const material* mat, const std::array<vertex, 4>* quads, std::size_t count);
+
+    bool        texture_atlas_enabled_       = true;
+    bool        vertex_cache_enabled_        = true;
+    bool        packed_vertex_enabled_       = false;
+    bool        distance_field_font_enabled_ = false;
+    bool        scissor_enabled_             = false;
+    bool        quad_batching_enabled_       = true;
+    std::size_t texture_atlas_page_size_     = 0u;
+
+    std::optional<float> distance_field_threshold_;
+
+    struct retained_resource {
+        std::string                 file_name;
+        std::shared_ptr<const void> resource;
+    };
+
+    bool                                               resource_retention_enabled_ = false;
+    std::unordered_map<const void*, retained_resource> retained_resource_list_;
 
     struct quad_batcher {
         std::vector<std::array<vertex, 4>> data;
@@ -513,12 +803,20 @@ private:
     static constexpr std::size_t                        batching_cache_cycle_size = 16u;
     std::array<quad_batcher, batching_cache_cycle_size> quad_cache_;
 
+    std::shared_ptr<render_target> current_render_target_;
+
     const gui::material* current_material_        = nullptr;
     std::size_t          current_quad_cache_      = 0u;
     std::size_t          batch_count_             = 0u;
     std::size_t          vertex_count_            = 0u;
     std::size_t          last_frame_batch_count_  = 0u;
     std::size_t          last_frame_vertex_count_ = 0u;
+
+    std::optional<bounds2f> view_rect_;
+    std::size_t             culled_frame_count_             = 0u;
+    std::size_t             culled_region_count_            = 0u;
+    std::size_t             last_frame_culled_frame_count_  = 0u;
+    std::size_t             last_frame_culled_region_count_ = 0u;
 };
 
 } // namespace lxgui::gui
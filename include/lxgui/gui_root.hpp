@@ -2,7 +2,9 @@
 #define LXGUI_GUI_ROOT_HPP
 
 #include "lxgui/gui_anchor.hpp"
+#include "lxgui/gui_animation.hpp"
 #include "lxgui/gui_frame_container.hpp"
+#include "lxgui/gui_frame_pool.hpp"
 #include "lxgui/gui_frame_renderer.hpp"
 #include "lxgui/gui_key_binder.hpp"
 #include "lxgui/gui_registry.hpp"
@@ -14,6 +16,7 @@
 
 #include <list>
 #include <memory>
+#include <optional>
 
 namespace lxgui::input {
 
@@ -86,12 +89,79 @@ public:
      */
     bool is_caching_enabled() const;
 
+    /**
+     * \brief Enables or disables partial redraw of the interface cache.
+     * \param enable 'true' to enable, 'false' to disable
+     * \note Disabled by default, and only used if caching is enabled (see toggle_caching())
+     * and the renderer supports scissor rectangles (see renderer::is_scissor_supported()).
+     * When enabled, a change in a layered region only redraws the area covered by this
+     * region (before and after the change) in the strata cache, and only this area is
+     * composited into the final cache. Changes to the frames themselves (moving, resizing,
+     * changing the backdrop, etc.) still redraw the whole strata.
+     * \warning Content drawn outside of the borders of a layered region (e.g., a text
+     * shadow extending beyond its font_string) may not be properly erased on redraw.
+     */
+    void enable_partial_redraw(bool enable);
+
+    /**
+     * \brief Checks if partial redraw of the interface cache is enabled.
+     * \return 'true' if partial redraw is enabled
+     * \see enable_partial_redraw()
+     */
+    bool is_partial_redraw_enabled() const;
+
+    /// Statistics about the redraw of the interface cache, for a single call to update().
+    struct redraw_stats {
+        /// Number of strata fully redrawn
+        std::size_t num_full_strata = 0u;
+        /// Number of strata partially redrawn
+        std::size_t num_partial_strata = 0u;
+        /// Number of frames rendered into the strata caches
+        std::size_t num_frames = 0u;
+        /// Number of pixels cleared and redrawn in the strata caches
+        std::size_t num_strata_pixels = 0u;
+        /// Number of pixels cleared and redrawn in the final cache
+        std::size_t num_composite_pixels = 0u;
+    };
+
+    /**
+     * \brief Returns statistics about the redraw of the interface cache in the last update().
+     * \return Statistics about the redraw of the interface cache
+     * \note This is only filled when caching is enabled (see toggle_caching()).
+     */
+    const redraw_stats& get_redraw_stats() const {
+        return redraw_stats_;
+    }
+
+    /**
+     * \brief Tells this renderer that an area of a strata requires redraw.
+     * \param strata_id The strata to redraw
+     * \param rect The area to redraw
+     * \note If partial redraw is disabled (see enable_partial_redraw()), this redraws the
+     * whole strata.
+     */
+    void notify_strata_rect_needs_redraw(strata strata_id, const bounds2f& rect) override;
+
     /**
      * \brief updates this root and its regions.
      * \param delta The time elapsed since the last call
      */
     void update(float delta);
 
+    /**
+     * \brief Registers an animation group to be updated in update().
+     * \param group The animation group
+     * \note This is called automatically by animation_group::play(). Groups are removed
+     * from the list when they stop playing, are paused, or are destroyed.
+     */
+    void register_animation_group(utils::observer_ptr<animation_group> group);
+
+    /**
+     * \brief Returns the number of animation groups currently playing.
+     * \return The number of animation groups currently playing
+     */
+    std::size_t get_num_playing_animation_groups() const;
+
     /// Tells this object that the global interface scaling factor has changed.
     void notify_scaling_factor_updated();
 
@@ -286,10 +356,32 @@ public:
         return key_binder_;
     }
 
+    /**
+     * \brief Returns the frame_pool object, which enables re-using frames instead of
+     * creating and destroying them.
+     * \return The frame_pool object
+     */
+    frame_pool& get_frame_pool() {
+        return frame_pool_;
+    }
+
+    /**
+     * \brief Returns the frame_pool object, which enables re-using frames instead of
+     * creating and destroying them.
+     * \return The frame_pool object
+     */
+    const frame_pool& get_frame_pool() const {
+        return frame_pool_;
+    }
+
 private:
     void create_caching_render_target_();
     void create_strata_cache_render_target_(strata_data& strata_obj);
 
+    std::optional<bounds2f> get_scissor_rect_(const bounds2f& rect) const;
+
+    void update_animations_(float delta);
+
     void clear_hovered_frame_();
     void update_hovered_frame_();
     void
@@ -313,16 +405,23 @@ private:
     renderer&                renderer_;
     registry                 object_registry_;
     key_binder               key_binder_;
+    frame_pool               frame_pool_;
     input::world_dispatcher& world_input_dispatcher_;
 
     // Rendering
     vector2ui screen_dimensions_;
 
-    bool caching_enabled_ = false;
+    bool caching_enabled_        = false;
+    bool partial_redraw_enabled_ = false;
+
+    redraw_stats redraw_stats_;
 
     std::shared_ptr<render_target> target_;
     quad                           screen_quad_;
 
+    // Animations
+    std::vector<utils::observer_ptr<animation_group>> animation_group_list_;
+
     // IO
     std::vector<utils::scoped_connection> connections_;
 
@@ -0,0 +1,121 @@
+#ifndef LXGUI_GUI_SAVED_VARIABLES_HPP
+#define LXGUI_GUI_SAVED_VARIABLES_HPP
+
+#include "lxgui/lxgui.hpp"
+
+#include <string>
+#include <vector>
+
+#if defined(LXGUI_ENABLE_MULTITHREADING)
+#    include <thread>
+#endif
+
+/** \cond INCLUDE_INTERNALS_IN_DOC
+ */
+namespace sol {
+
+class state;
+
+}
+/** \endcond
+ */
+
+namespace lxgui::gui {
+
+/// File format used to store the saved variables of addons.
+enum class saved_variables_format {
+    /// Lua script assigning each variable, run when loaded (human-readable)
+    lua,
+    /// Compact binary file, loaded directly into the Lua state (faster to write and to load)
+    binary
+};
+
+/**
+ * \brief Returns the file extension used for a saved variables format.
+ * \param format The saved variables format
+ * \return The file extension, including the leading dot
+ */
+const char* get_saved_variables_extension(saved_variables_format format) noexcept;
+
+/**
+ * \brief Serializes Lua global variables.
+ * \param lua The Lua state holding the variables
+ * \param variable_list The names of the global variables to serialize
+ * \param format The format to serialize to
+ * \param output The buffer to append the serialized variables to
+ * \details Values are written one after the other into the output buffer, without building
+ * intermediate strings, so the cost is linear in the size of the output. Nil, boolean,
+ * number, string, and table values are supported. Functions, userdata, and threads cannot be
+ * saved: table entries holding them are skipped, and variables holding them are saved as nil.
+ * A table which contains itself (directly or not) is saved as nil where the cycle occurs.
+ * Each skipped value is reported in the log.
+ * \note This must be called from the thread owning the Lua state.
+ */
+void serialize_saved_variables(
+    sol::state&                     lua,
+    const std::vector<std::string>& variable_list,
+    saved_variables_format          format,
+    std::string&                    output);
+
+/**
+ * \brief Loads a saved variables file in binary format into Lua global variables.
+ * \param lua The Lua state to load the variables into
+ * \param file_name The file to load
+ * \throw gui::exception if the file cannot be read, or is not a valid binary saved variables
+ * file. In this case, no variable is set, and the Lua stack is left unchanged.
+ */
+void load_binary_saved_variables(sol::state& lua, const std::string& file_name);
+
+/**
+ * \brief Writes saved variables files to disk.
+ * \details The files are written in a background thread if multi-threading is enabled (see
+ * LXGUI_ENABLE_MULTITHREADING), so that closing the UI does not wait for the disk. Otherwise,
+ * they are written immediately.
+ */
+class saved_variables_writer {
+public:
+    /// A file to write.
+    struct file {
+        std::string name;
+        std::string content;
+    };
+
+    /// Default constructor.
+    saved_variables_writer() = default;
+
+    /// Destructor, waits for all files to be written.
+    ~saved_variables_writer();
+
+    // Non-copiable, non-movable
+    saved_variables_writer(const saved_variables_writer&)            = delete;
+    saved_variables_writer(saved_variables_writer&&)                 = delete;
+    saved_variables_writer& operator=(const saved_variables_writer&) = delete;
+    saved_variables_writer& operator=(saved_variables_writer&&)      = delete;
+
+    /**
+     * \brief Writes a list of files.
+     * \param file_list The files to write
+     * \note If files are still being written from a previous call, this waits for them first.
+     */
+    void write(std::vector<file> file_list);
+
+    /**
+     * \brief Waits until all files are written.
+     * \note Errors which occurred while writing the files are reported in the log here.
+     * This must be called before reading the files back.
+     */
+    void wait();
+
+private:
+    void write_files_(const std::vector<file>& file_list);
+
+    std::vector<std::string> error_list_;
+
+#if defined(LXGUI_ENABLE_MULTITHREADING)
+    std::thread thread_;
+#endif
+};
+
+} // namespace lxgui::gui
+
+#endif
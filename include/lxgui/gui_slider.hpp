@@ -202,6 +202,8 @@ protected:
 
     void notify_thumb_texture_needs_update_();
 
+    bool has_custom_hit_test_() const override;
+
     void parse_attributes_(const layout_node& node) override;
     void parse_all_nodes_before_children_(const layout_node& node) override;
 
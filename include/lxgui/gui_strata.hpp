@@ -1,6 +1,7 @@
 #ifndef LXGUI_GUI_STRATA_HPP
 #define LXGUI_GUI_STRATA_HPP
 
+#include "lxgui/gui_bounds2.hpp"
 #include "lxgui/gui_quad.hpp"
 #include "lxgui/gui_render_target.hpp"
 #include "lxgui/lxgui.hpp"
@@ -20,6 +21,8 @@ struct strata_data {
     strata                              id;
     std::pair<std::size_t, std::size_t> range;
     bool                                redraw_flag = true;
+    bool                                has_damage  = false;
+    bounds2f                            damage_rect;
     std::shared_ptr<render_target>      target;
     quad                                target_quad;
 };
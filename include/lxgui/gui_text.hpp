@@ -13,6 +13,7 @@
 #include <array>
 #include <limits>
 #include <memory>
+#include <optional>
 #include <vector>
 
 namespace lxgui::gui {
@@ -39,6 +40,9 @@ public:
         std::shared_ptr<const font> fnt,
         std::shared_ptr<const font> outline_fnt = nullptr);
 
+    /// Destructor.
+    ~text();
+
     // Non-copiable, non-movable
     text(const text&) = delete;
     text(text&&)      = delete;
@@ -66,6 +70,36 @@ public:
      */
     float get_scaling_factor() const;
 
+    /**
+     * \brief Sets the size at which glyphs are rendered, for distance field fonts.
+     * \param size The size of the glyphs, in pixels (zero to use the size of the font)
+     * \note Distance field fonts (see font::get_distance_field_spread()) are created once
+     * at a reference size, and can be rendered at any size. Other fonts are always rendered
+     * at their own size, and this setting has no effect.
+     */
+    void set_font_size(float size);
+
+    /**
+     * \brief Returns the size at which glyphs are rendered, for distance field fonts.
+     * \return The size of the glyphs, in pixels (zero to use the size of the font)
+     */
+    float get_font_size() const;
+
+    /**
+     * \brief Sets the thickness of the outline, for distance field fonts.
+     * \param thickness The thickness of the outline, in pixels (zero for no outline)
+     * \note Distance field fonts render the outline from the same font texture as the
+     * glyphs. Other fonts use a separate outline font, given to the constructor, and this
+     * setting has no effect.
+     */
+    void set_outline_thickness(float thickness);
+
+    /**
+     * \brief Returns the thickness of the outline, for distance field fonts.
+     * \return The thickness of the outline, in pixels (zero for no outline)
+     */
+    float get_outline_thickness() const;
+
     /**
      * \brief Sets the text to render (unicode character set).
      * \param content The text to render
@@ -76,6 +110,16 @@ public:
      */
     void set_text(const utils::ustring& content);
 
+    /**
+     * \brief Replaces part of the text to render.
+     * \param pos The position of the first character to replace
+     * \param count The number of characters to replace
+     * \param content The text to insert in their place
+     * \note This gives the same result as set_text() with the edited text, but only the
+     * paragraphs touched by the edit are split, parsed, and laid out again.
+     */
+    void replace_text(std::size_t pos, std::size_t count, const utils::ustring& content);
+
     /**
      * \brief Returns the text that will be rendered (unicode character set).
      * \return The text that will be rendered (unicode character set)
@@ -87,6 +131,8 @@ public:
      * \brief Sets this text's default color.
      * \param c The default color
      * \param force_color 'true' to ignore color tags
+     * \note When using vertex caches, the color is applied when rendering and changing it
+     * does not require updating the cache, unless the text contains color tags.
      */
     void set_color(const color& c, bool force_color = false);
 
@@ -99,6 +145,8 @@ public:
     /**
      * \brief Sets this text's transparency (alpha).
      * \param alpha The new alpha value
+     * \note When using vertex caches, the alpha is applied when rendering and changing it
+     * does not require updating the cache.
      */
     void set_alpha(float alpha);
 
@@ -385,6 +433,15 @@ public:
      */
     const std::array<vertex, 4>& get_letter_quad(std::size_t index) const;
 
+    /**
+     * \brief Returns the line on which the letter at the provided index is displayed.
+     * \param index The index of the letter (0: first letter); must be less than get_letter_count().
+     * \return The index of the line (0: first line)
+     * \note This is a binary search over the displayed lines. This function may update the
+     * quad cache as needed.
+     */
+    std::size_t get_letter_line(std::size_t index) const;
+
     /**
      * \brief Creates a quad that contains the provided character.
      * \param c The character to draw
@@ -422,14 +479,28 @@ public:
     }
 
 private:
+    struct line_glyphs;
+    struct paragraph_layout;
+
     void update_() const;
+    void update_paragraph_list_() const;
+    void layout_paragraph_(paragraph_layout& paragraph) const;
+    void build_paragraph_glyphs_(
+        paragraph_layout& paragraph, const std::vector<color>& begin_color_stack, float x0) const;
     void update_vertex_cache_() const;
+    void render_glyphs_(
+        const material&             mat,
+        const matrix4f&             transform,
+        bool                        use_vertex_cache,
+        const std::optional<color>& outline_color) const;
+    void fill_vertex_cache_(vertex_cache& cache, const color& default_color, bool force) const;
     bool use_vertex_cache_() const;
     void notify_cache_dirty_() const;
     void notify_vertex_cache_dirty_() const;
 
     float round_to_pixel_(
         float value, utils::rounding_method method = utils::rounding_method::nearest) const;
+    float get_glyph_scale_() const;
 
     std::array<vertex, 4> create_letter_quad_(const gui::font& font, char32_t c) const;
     std::array<vertex, 4> create_letter_quad_(char32_t c) const;
@@ -438,6 +509,8 @@ private:
     renderer& renderer_;
 
     float       scaling_factor_         = 1.0f;
+    float       font_size_              = 0.0f;
+    float       outline_thickness_      = 0.0f;
     float       tracking_               = 0.0f;
     float       line_spacing_           = 1.0f;
     bool        remove_starting_spaces_ = false;
@@ -461,13 +534,23 @@ private:
     mutable float       height_            = 0.0f;
     mutable std::size_t num_lines_         = 0u;
 
-    bool                                       use_vertex_cache_flag_    = false;
-    mutable bool                               update_vertex_cache_flag_ = false;
+    bool                                       use_vertex_cache_flag_           = false;
+    mutable bool                               update_vertex_cache_flag_        = false;
+    mutable bool                               update_forced_vertex_cache_flag_ = false;
+    mutable bool                               has_color_tags_                  = false;
+    mutable color                              vertex_cache_color_              = color::white;
     mutable std::vector<std::array<vertex, 4>> quad_list_;
     mutable std::shared_ptr<vertex_cache>      vertex_cache_;
+    mutable std::shared_ptr<vertex_cache>      forced_vertex_cache_;
     mutable std::vector<std::array<vertex, 4>> outline_quad_list_;
     mutable std::shared_ptr<vertex_cache>      outline_vertex_cache_;
     mutable std::vector<quad>                  icons_list_;
+    mutable std::vector<std::size_t>           line_first_letter_list_;
+
+    // Layout of each paragraph (line separated by '\n') of the text, kept across calls to
+    // set_text() so that only edited paragraphs need to be laid out again
+    mutable std::vector<paragraph_layout> paragraph_list_;
+    mutable bool                          update_paragraph_list_flag_ = true;
 };
 
 } // namespace lxgui::gui
@@ -244,6 +244,9 @@ private:
     void update_dimensions_from_tex_coord_();
     void update_borders_() override;
 
+    std::optional<color> get_animation_color_() const override;
+    void                 set_animation_color_(const color& c) override;
+
     using content    = std::variant<color, std::string, gradient>;
     content content_ = color::white;
 
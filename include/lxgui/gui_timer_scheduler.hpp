@@ -0,0 +1,123 @@
+#ifndef LXGUI_GUI_TIMER_SCHEDULER_HPP
+#define LXGUI_GUI_TIMER_SCHEDULER_HPP
+
+#include "lxgui/lxgui.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+namespace lxgui::gui {
+
+/**
+ * \brief Calls functions after a delay, or at regular intervals.
+ * \details Timers are stored in a binary min-heap sorted by due time, so update() only looks
+ * at the timers which are due: when no timer is due, it costs a single comparison, no matter
+ * how many timers are scheduled. Cancelled timers are removed lazily from the heap.
+ * This replaces "OnUpdate" handlers which accumulate the elapsed time on every frame.
+ */
+class timer_scheduler {
+public:
+    /// Type of a timer callback.
+    using function_type = std::function<void()>;
+
+    /// Identifier of a timer, used to cancel it.
+    using timer_id = std::uint64_t;
+
+    /// Identifier which is never used by any timer.
+    static constexpr timer_id invalid_id = 0u;
+
+    /// Constructor.
+    timer_scheduler() = default;
+
+    // Non-copiable, non-movable
+    timer_scheduler(const timer_scheduler&)            = delete;
+    timer_scheduler(timer_scheduler&&)                 = delete;
+    timer_scheduler& operator=(const timer_scheduler&) = delete;
+    timer_scheduler& operator=(timer_scheduler&&)      = delete;
+
+    /**
+     * \brief Calls a function once, after a delay.
+     * \param delay The delay (in seconds)
+     * \param function The function to call
+     * \return The identifier of the new timer
+     * \note The function is called by the first call to update() after the delay has
+     * elapsed. A timer created while update() is running is never called by the same update.
+     */
+    timer_id run_after(double delay, function_type function);
+
+    /**
+     * \brief Calls a function repeatedly, at a regular interval.
+     * \param interval The interval between two calls (in seconds)
+     * \param function The function to call
+     * \return The identifier of the new timer
+     * \note The function is called at most once per call to update(): intervals missed
+     * because of a slow update are skipped. With an interval of zero, the function is called
+     * on every update. The timer runs until cancelled with cancel().
+     */
+    timer_id run_every(double interval, function_type function);
+
+    /**
+     * \brief Cancels a timer.
+     * \param id The identifier of the timer
+     * \return 'true' if the timer was cancelled, 'false' if it did not exist (anymore)
+     * \note This can be called from within a timer function, including for its own timer.
+     */
+    bool cancel(timer_id id);
+
+    /// Cancels all timers.
+    void clear();
+
+    /**
+     * \brief Checks if a timer is scheduled.
+     * \param id The identifier of the timer
+     * \return 'true' if the timer will be called again, 'false' otherwise
+     */
+    bool is_scheduled(timer_id id) const;
+
+    /**
+     * \brief Returns the number of scheduled timers.
+     * \return The number of scheduled timers
+     */
+    std::size_t get_timer_count() const;
+
+    /**
+     * \brief Returns the time elapsed since this scheduler was created.
+     * \return The sum of all the delta times given to update() (in seconds)
+     */
+    double get_time() const;
+
+    /**
+     * \brief Advances the time, and calls the functions of timers which are due.
+     * \param delta The time elapsed since the last call (in seconds)
+     * \note Functions are called in order of due time. Exceptions thrown by a function are
+     * logged, and do not prevent other functions from being called.
+     */
+    void update(double delta);
+
+private:
+    struct timer {
+        function_type function;
+        double        interval     = 0.0;
+        bool          is_repeating = false;
+    };
+
+    struct heap_entry {
+        double   time = 0.0;
+        timer_id id   = invalid_id;
+    };
+
+    timer_id add_timer_(double time, timer data);
+    void     push_(double time, timer_id id);
+
+    std::unordered_map<timer_id, timer> timer_list_;
+    std::vector<heap_entry>             heap_;
+    std::vector<heap_entry>             due_list_;
+    double                              time_    = 0.0;
+    timer_id                            next_id_ = 1u;
+};
+
+} // namespace lxgui::gui
+
+#endif
@@ -0,0 +1,94 @@
+#ifndef LXGUI_GUI_TRANSLATION_TABLE_HPP
+#define LXGUI_GUI_TRANSLATION_TABLE_HPP
+
+#include "lxgui/lxgui.hpp"
+#include "lxgui/utils_file_system.hpp"
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace lxgui::gui {
+
+/**
+ * \brief Compact binary table of translated strings.
+ * \details This is a read-only table of key/value string pairs, loaded from a binary file
+ * without running any Lua code. The file contains a single string pool holding all keys and
+ * values, and a minimal perfect hash index over the keys (hash and displace). Looking up a key
+ * therefore costs two hashes of the key and one string comparison, regardless of the number of
+ * entries in the table.
+ *
+ * Binary tables are created from regular Lua translation files with
+ * localizer::compile_translation_file(), and loaded with localizer::load_translation_file().
+ * Only string translations can be stored; translation functions require Lua and must remain in
+ * a Lua translation file.
+ */
+class translation_table {
+public:
+    /// Key/value pair, as stored in the table
+    using entry = std::pair<std::string, std::string>;
+
+    /**
+     * \brief Loads a binary table from a file.
+     * \param file_name The path to the file to load
+     * \throw gui::exception if the file cannot be read or is not a valid table
+     * \note The file is read with utils::read_file(). If it is stored in a mounted archive, the
+     * string pool is used in place, without copy.
+     */
+    explicit translation_table(const std::string& file_name);
+
+    /**
+     * \brief Returns the number of entries in this table.
+     * \return The number of entries in this table
+     */
+    std::size_t get_entry_count() const;
+
+    /**
+     * \brief Returns the key of an entry.
+     * \param slot The index of the entry (must be less than get_entry_count())
+     * \return The key of the entry
+     */
+    std::string_view get_key(std::size_t slot) const;
+
+    /**
+     * \brief Returns the value of an entry.
+     * \param slot The index of the entry (must be less than get_entry_count())
+     * \return The value of the entry
+     */
+    std::string_view get_value(std::size_t slot) const;
+
+    /**
+     * \brief Searches for a key in the table.
+     * \param key The key to search for
+     * \return The index of the matching entry, or nothing if not found
+     */
+    std::optional<std::size_t> find(std::string_view key) const;
+
+    /**
+     * \brief Writes a binary table to a file.
+     * \param file_name The path to the file to write
+     * \param entries The key/value pairs to store (keys must be unique)
+     * \throw gui::exception if the file cannot be written
+     */
+    static void save(const std::string& file_name, const std::vector<entry>& entries);
+
+private:
+    struct slot_data {
+        std::uint32_t key_offset   = 0u;
+        std::uint32_t key_size     = 0u;
+        std::uint32_t value_offset = 0u;
+        std::uint32_t value_size   = 0u;
+    };
+
+    std::vector<std::uint32_t> displacements_;
+    std::vector<slot_data>     slots_;
+    utils::file_content        content_;
+    std::string_view           pool_;
+};
+
+} // namespace lxgui::gui
+
+#endif
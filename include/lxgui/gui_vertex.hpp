@@ -6,8 +6,14 @@
 #include "lxgui/lxgui.hpp"
 #include "lxgui/utils.hpp"
 
+#include <array>
+#include <cstdint>
+#include <vector>
+
 namespace lxgui::gui {
 
+struct matrix4f;
+
 /// Holds position, texture coordinate, and color information for drawing
 struct vertex {
     vector2f pos;
@@ -15,6 +21,81 @@ struct vertex {
     color    col;
 };
 
+/**
+ * \brief Compact vertex layout, for renderers which support it
+ * \details This holds the same information as gui::vertex in 16 bytes instead of 32: texture
+ * coordinates are stored as normalized 16-bit integers, and colors as 8-bit integers. This
+ * halves the amount of data sent to the GPU, but texture coordinates must be in the range
+ * [0,1]. See renderer::set_packed_vertex_enabled().
+ */
+struct packed_vertex {
+    vector2f      pos;
+    std::uint16_t uvs[2];
+    color32       col;
+};
+
+/**
+ * \brief Converts a list of vertices to the compact vertex layout.
+ * \param vertex_list The first vertex to convert
+ * \param count The number of vertices to convert
+ * \param packed_list The first packed vertex to write (must have room for 'count' vertices)
+ * \return 'true' if all vertices could be converted, 'false' if some texture coordinates are
+ * outside of the range [0,1] (in which case the content of 'packed_list' is unspecified)
+ * \note Colors are clamped to the range [0,1].
+ */
+bool pack_vertices(
+    const vertex* vertex_list, std::size_t count, packed_vertex* packed_list) noexcept;
+
+/**
+ * \brief Applies a transformation matrix to the position of a list of vertices.
+ * \param vertex_list The first vertex to transform
+ * \param count The number of vertices to transform
+ * \param transform The transformation matrix
+ * \note This is equivalent to calling 'v.pos = v.pos * transform' for each vertex, but uses
+ * SIMD instructions when available (SSE2 or NEON).
+ */
+void transform_vertices(vertex* vertex_list, std::size_t count, const matrix4f& transform) noexcept;
+
+/**
+ * \brief Multiplies the color of a list of vertices by a tint.
+ * \param vertex_list The first vertex to modify
+ * \param count The number of vertices to modify
+ * \param tint The color to multiply each vertex color with
+ * \note This is equivalent to calling 'v.col *= tint' for each vertex, but uses
+ * SIMD instructions when available (SSE2 or NEON).
+ */
+void tint_vertices(vertex* vertex_list, std::size_t count, const color& tint) noexcept;
+
+/**
+ * \brief Multiplies the alpha of a list of vertices.
+ * \param vertex_list The first vertex to modify
+ * \param count The number of vertices to modify
+ * \param alpha The factor to multiply each vertex alpha with
+ */
+void multiply_vertices_alpha(vertex* vertex_list, std::size_t count, float alpha) noexcept;
+
+/**
+ * \brief Applies a transformation matrix to the position of a list of quads.
+ * \param quad_list The list of quads to transform
+ * \param transform The transformation matrix
+ */
+inline void
+transform_quads(std::vector<std::array<vertex, 4>>& quad_list, const matrix4f& transform) noexcept {
+    if (!quad_list.empty())
+        transform_vertices(quad_list[0].data(), quad_list.size() * 4u, transform);
+}
+
+/**
+ * \brief Multiplies the alpha of a list of quads.
+ * \param quad_list The list of quads to modify
+ * \param alpha The factor to multiply each vertex alpha with
+ */
+inline void
+multiply_quads_alpha(std::vector<std::array<vertex, 4>>& quad_list, float alpha) noexcept {
+    if (!quad_list.empty())
+        multiply_vertices_alpha(quad_list[0].data(), quad_list.size() * 4u, alpha);
+}
+
 } // namespace lxgui::gui
 
 #endif
@@ -5,11 +5,14 @@
 #include "lxgui/lxgui.hpp"
 #include "lxgui/utils_observer.hpp"
 
+#include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 namespace lxgui::gui {
 
+class frame;
 class region;
 
 /// Keeps track of virtual UI objects and records their names for lookup.
@@ -30,8 +33,51 @@ public:
     std::vector<utils::observer_ptr<const region>>
     get_virtual_region_list(std::string_view names) const;
 
+    /**
+     * \brief Returns the flattened template cached for a given list of bases.
+     * \param key The key identifying the object type and list of bases
+     * \return The flattened template, or nullptr if none is cached or if it is outdated
+     * \note A flattened template is a virtual frame into which a list of templates has been
+     * copied, in order. Instantiating a frame from multiple templates can then be done with a
+     * single copy, rather than one copy per template. The cached template is considered
+     * outdated as soon as one of the templates it was created from is destroyed.
+     */
+    utils::observer_ptr<const frame> get_flattened_template(const std::string& key) const;
+
+    /**
+     * \brief Stores the flattened template for a given list of bases.
+     * \param key The key identifying the object type and list of bases
+     * \param flattened The flattened template
+     * \param base_list The list of bases the template was created from
+     */
+    void set_flattened_template(
+        std::string                                    key,
+        utils::observer_ptr<frame>                     flattened,
+        std::vector<utils::observer_ptr<const region>> base_list);
+
+    /**
+     * \brief Forgets the flattened templates which are outdated.
+     * \return The outdated flattened templates, which should be destroyed
+     * \note The flattened templates are owned by the virtual root, not by this registry.
+     */
+    std::vector<utils::observer_ptr<frame>> remove_outdated_flattened_templates();
+
+    /**
+     * \brief Forgets all the flattened templates, so they are created again on next use.
+     * \note The flattened templates are owned by the virtual root, not by this registry. This
+     * must be called when the virtual root destroys its frames.
+     */
+    void clear_flattened_templates();
+
 private:
+    struct flattened_template {
+        utils::observer_ptr<frame>                     flattened;
+        std::vector<utils::observer_ptr<const region>> base_list;
+    };
+
     const registry* object_registry_ = nullptr;
+
+    std::unordered_map<std::string, flattened_template> flattened_list_;
 };
 
 } // namespace lxgui::gui
@@ -24,8 +24,12 @@ public:
      * \brief Constructor.
      * \param rdr The renderer with witch to create this atlas
      * \param filt Use texture filtering or not (see material::set_filter())
+     * \param format The layout of the pixels stored in this page
      */
-    explicit atlas_page(gui::renderer& rdr, material::filter filt);
+    explicit atlas_page(
+        gui::renderer&         rdr,
+        material::filter       filt,
+        material::pixel_format format = material::pixel_format::rgba);
 
     /// Destructor.
     ~atlas_page() override;
@@ -53,8 +57,9 @@ protected:
     float get_height_() const override;
 
 private:
-    std::uint32_t texture_handle_ = 0u;
-    std::size_t   size_           = 0u;
+    std::uint32_t          texture_handle_ = 0u;
+    std::size_t            size_           = 0u;
+    material::pixel_format format_         = material::pixel_format::rgba;
 };
 
 /**
@@ -69,8 +74,12 @@ public:
      * \brief Constructor for textures.
      * \param rdr The renderer with witch to create this atlas
      * \param filt Use texture filtering or not (see material::set_filter())
+     * \param format The layout of the pixels stored in the pages of this atlas
      */
-    explicit atlas(renderer& rdr, material::filter filt);
+    explicit atlas(
+        renderer&              rdr,
+        material::filter       filt,
+        material::pixel_format format = material::pixel_format::rgba);
 
     atlas(const atlas& tex)            = delete;
     atlas(atlas&& tex)                 = delete;
@@ -83,6 +92,9 @@ protected:
      * \return The new page, added at the back of the page list
      */
     std::unique_ptr<gui::atlas_page> create_page_() override;
+
+private:
+    material::pixel_format format_ = material::pixel_format::rgba;
 };
 
 } // namespace lxgui::gui::gl
@@ -4,6 +4,7 @@
 #include "lxgui/gui_font.hpp"
 #include "lxgui/impl/gui_gl_material.hpp"
 #include "lxgui/utils.hpp"
+#include "lxgui/utils_file_system.hpp"
 
 #include <ft2build.h>
 #include <vector>
@@ -26,13 +27,19 @@ public:
      * \param outline The thickness of the outline (in points)
      * \param code_points The list of Unicode characters to load
      * \param default_code_point The character to display as fallback
+     * \param distance_field_spread The largest distance stored in the distance field (in
+     * pixels), or zero to rasterize the glyphs normally
+     * \note When 'distance_field_spread' is not zero, the font texture stores the signed
+     * distance field of each glyph, padded by 'distance_field_spread' on each side, and
+     * 'outline' must be zero.
      */
     font(
         const std::string&                   font_file,
         std::size_t                          size,
         std::size_t                          outline,
         const std::vector<code_point_range>& code_points,
-        char32_t                             default_code_point);
+        char32_t                             default_code_point,
+        std::size_t                          distance_field_spread = 0u);
 
     /// Destructor.
     ~font() override;
@@ -85,6 +92,13 @@ public:
      */
     float get_character_kerning(char32_t c1, char32_t c2) const override;
 
+    /**
+     * \brief Returns the spread of the distance field, for distance field fonts.
+     * \return The largest distance (in pixels of the font texture) stored in the distance
+     * field, or zero if this font is not a distance field font
+     */
+    float get_distance_field_spread() const override;
+
     /**
      * \brief Returns the underlying material to use for rendering.
      * \return The underlying material to use for rendering
@@ -112,13 +126,15 @@ private:
 
     const character_info* get_character_(char32_t c) const;
 
-    FT_Face     face_               = nullptr;
-    std::size_t size_               = 0u;
-    bool        kerning_            = false;
-    char32_t    default_code_point_ = 0u;
+    FT_Face     face_                  = nullptr;
+    std::size_t size_                  = 0u;
+    std::size_t distance_field_spread_ = 0u;
+    char32_t    default_code_point_    = 0u;
 
+    utils::file_content           content_;
     std::shared_ptr<gl::material> texture_;
     std::vector<range_info>       range_list_;
+    kerning_table                 kerning_;
 };
 
 } // namespace lxgui::gui::gl
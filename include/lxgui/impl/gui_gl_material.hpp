@@ -20,13 +20,26 @@ namespace lxgui::gui::gl {
  */
 class material final : public gui::material {
 public:
+    /// Layout of the pixels stored in the texture
+    enum class pixel_format {
+        /// Four channels: red, green, blue, and alpha
+        rgba,
+        /// A single channel, used as alpha for white pixels (e.g., font glyph coverage)
+        alpha
+    };
+
     /**
      * \brief Constructor for textures.
      * \param dimensions The requested texture dimensions
      * \param wrp How to adjust texture coordinates that are outside the [0,1] range
      * \param filt Use texture filtering or not (see set_filter())
+     * \param format The layout of the pixels stored in the texture
      */
-    material(const vector2ui& dimensions, wrap wrp = wrap::repeat, filter filt = filter::none);
+    material(
+        const vector2ui& dimensions,
+        wrap             wrp    = wrap::repeat,
+        filter           filt   = filter::none,
+        pixel_format     format = pixel_format::rgba);
 
     /**
      * \brief Constructor for atlas textures.
@@ -34,12 +47,14 @@ public:
      * \param canvas_dimensions The dimensions of the texture atlas
      * \param rect The position of this texture inside the atlas
      * \param filt Use texture filtering or not (see set_filter())
+     * \param format The layout of the pixels stored in the atlas texture
      */
     material(
         std::uint32_t    texture_handle,
         const vector2ui& canvas_dimensions,
         const bounds2f   rect,
-        filter           filt = filter::none);
+        filter           filt   = filter::none,
+        pixel_format     format = pixel_format::rgba);
 
     material(const material& tex)            = delete;
     material(material&& tex)                 = delete;
@@ -110,15 +125,48 @@ public:
      */
     filter get_filter() const;
 
+    /**
+     * \brief Returns the layout of the pixels stored in this texture.
+     * \return The layout of the pixels stored in this texture
+     */
+    pixel_format get_pixel_format() const;
+
     /// Sets this material as the active one.
     void bind() const;
 
     /**
      * \brief Updates the texture that is in GPU memory.
      * \param data The new pixel data
+     * \note This texture must use the pixel_format::rgba format.
      */
     void update_texture(const color32* data);
 
+    /**
+     * \brief Updates the texture that is in GPU memory.
+     * \param data The new pixel data, one byte per pixel
+     * \note This texture must use the pixel_format::alpha format.
+     */
+    void update_texture(const std::uint8_t* data);
+
+    /**
+     * \brief Uploads pixel data to a region of a texture.
+     * \param texture_handle The handle of the texture to update
+     * \param rect The region of the texture to update
+     * \param format The layout of the pixels stored in the texture
+     * \param data The new pixel data, in the layout given by 'format'
+     * \note For internal use.
+     */
+    static void update_texture_region(
+        std::uint32_t texture_handle, const bounds2f& rect, pixel_format format, const void* data);
+
+    /**
+     * \brief Allocates storage for the currently bound texture.
+     * \param dimensions The dimensions of the texture
+     * \param format The layout of the pixels stored in the texture
+     * \note For internal use.
+     */
+    static void allocate_texture(const vector2ui& dimensions, pixel_format format);
+
     /**
      * \brief Returns the OpenGL texture handle.
      * \note For internal use.
@@ -143,6 +191,7 @@ private:
     vector2ui     canvas_dimensions_;
     wrap          wrap_           = wrap::repeat;
     filter        filter_         = filter::none;
+    pixel_format  format_         = pixel_format::rgba;
     std::uint32_t texture_handle_ = 0u;
     bounds2f      rect_;
     bool          is_owner_ = false;
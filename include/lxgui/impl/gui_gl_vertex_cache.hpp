@@ -31,11 +31,14 @@ public:
     /**
      * \brief Constructor.
      * \param t The type of data this cache will hold
+     * \param packed Set to 'true' to store vertices in the compact layout when possible
      * \details A default constructed vertex cache holds no data. Use update()
      * to store vertices to be rendered. The size hint can enable the cache to be
      * pre-allocated, which will avoid a reallocation when update() is called.
+     * \note See gui::packed_vertex for the compact layout. If some vertices cannot be
+     * packed, the full layout is used for that update.
      */
-    explicit vertex_cache(type t);
+    explicit vertex_cache(type t, bool packed = false);
 
     /// Destructor.
     ~vertex_cache() override;
@@ -81,10 +84,21 @@ public:
      */
     void render() const;
 
+    /**
+     * \brief Checks if the data currently stored uses the compact vertex layout.
+     * \return 'true' if the data uses the compact layout, 'false' otherwise
+     */
+    bool is_packed() const;
+
 private:
+    void set_vertex_layout_(bool packed);
+    void upload_data_(const void* data, std::size_t num_bytes);
+
+    bool          packed_enabled_          = false;
+    bool          packed_layout_           = false;
     std::size_t   current_size_vertex_     = 0u;
     std::size_t   current_size_index_      = 0u;
-    std::size_t   current_capacity_vertex_ = 0u;
+    std::size_t   current_capacity_data_   = 0u;
     std::size_t   current_capacity_index_  = 0u;
     std::uint32_t vertex_array_            = std::numeric_limits<std::uint32_t>::max();
     std::uint32_t vertex_buffer_           = std::numeric_limits<std::uint32_t>::max();
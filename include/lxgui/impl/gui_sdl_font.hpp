@@ -4,10 +4,12 @@
 #include "lxgui/gui_font.hpp"
 #include "lxgui/impl/gui_sdl_material.hpp"
 #include "lxgui/utils.hpp"
+#include "lxgui/utils_file_system.hpp"
 
 #include <vector>
 
 struct SDL_Renderer;
+struct _TTF_Font;
 
 namespace lxgui::gui::sdl {
 
@@ -38,6 +40,9 @@ public:
         char32_t                             default_code_point,
         bool                                 pre_multiplied_alpha_supported);
 
+    /// Destructor.
+    ~font() override;
+
     /**
      * \brief Get the size of the font in pixels.
      * \return The size of the font in pixels
@@ -86,6 +91,14 @@ public:
      */
     float get_character_kerning(char32_t c1, char32_t c2) const override;
 
+    /**
+     * \brief Returns the spread of the distance field, for distance field fonts.
+     * \return The largest distance (in pixels of the font texture) stored in the distance
+     * field, or zero if this font is not a distance field font
+     * \note Distance field fonts are not supported by this implementation.
+     */
+    float get_distance_field_spread() const override;
+
     /**
      * \brief Returns the underlying material to use for rendering.
      * \return The underlying material to use for rendering
@@ -113,11 +126,14 @@ private:
 
     const character_info* get_character_(char32_t c) const;
 
+    _TTF_Font*  font_               = nullptr;
     std::size_t size_               = 0u;
     char32_t    default_code_point_ = 0u;
 
+    utils::file_content            content_;
     std::shared_ptr<sdl::material> texture_;
     std::vector<range_info>        range_list_;
+    kerning_table                  kerning_;
 };
 
 } // namespace lxgui::gui::sdl
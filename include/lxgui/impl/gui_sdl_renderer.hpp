@@ -4,9 +4,11 @@
 #include "lxgui/gui_matrix4.hpp"
 #include "lxgui/gui_renderer.hpp"
 #include "lxgui/impl/gui_sdl_render_target.hpp"
+#include "lxgui/impl/gui_sdl_vertex_cache.hpp"
 #include "lxgui/utils.hpp"
 
 #include <memory>
+#include <vector>
 
 struct SDL_Renderer;
 
@@ -31,13 +33,10 @@ public:
     std::string get_name() const override;
 
     /**
-     * \brief Returns the current view matrix to use when rendering (viewport).
-     * \return The current view matrix to use when rendering
-     * \note See set_view() for more information. The returned matrix may be different
-     * from the matrix given to set_view(), if the rendering backend does not
-     * support certain transformations.
+     * \brief Checks if the renderer supports restricting rendering to a rectangle.
+     * \return 'true' if supported, 'false' otherwise
      */
-    matrix4f get_view() const override;
+    bool is_scissor_supported() const override;
 
     /**
      * \brief Returns the maximum texture width/height (in pixels).
@@ -56,9 +55,17 @@ public:
     /**
      * \brief Checks if the renderer supports setting colors for each vertex of a textured quad.
      * \return 'true' if supported, 'false' otherwise
+     * \note This requires SDL 2.0.18 or later (see is_geometry_supported()).
      */
     bool is_texture_vertex_color_supported() const override;
 
+    /**
+     * \brief Checks if the fonts of this renderer store glyphs in single-channel textures.
+     * \return 'true' if font textures have a single channel, 'false' if they are RGBA
+     * \note SDL textures are always RGBA.
+     */
+    bool is_single_channel_font_supported() const override;
+
     /**
      * \brief Creates a new material from arbitrary pixel data.
      * \param dimensions The dimensions of the material
@@ -91,9 +98,25 @@ public:
     /**
      * \brief Checks if the renderer supports vertex caches.
      * \return 'true' if supported, 'false' otherwise
+     * \note This requires SDL 2.0.18 or later (see is_geometry_supported()).
      */
     bool is_vertex_cache_supported() const override;
 
+    /**
+     * \brief Checks if the renderer supports the compact vertex layout in vertex caches.
+     * \return 'true' if supported, 'false' otherwise
+     * \note SDL vertices already use 8-bit colors (see sdl::geometry_vertex), and are
+     * not sent to the GPU by lxgui, so this always returns 'false'.
+     */
+    bool is_packed_vertex_supported() const override;
+
+    /**
+     * \brief Checks if the renderer supports rendering distance field fonts.
+     * \return 'true' if supported, 'false' otherwise
+     * \note SDL has no shaders, so this always returns 'false'.
+     */
+    bool is_distance_field_supported() const override;
+
     /**
      * \brief Creates a new empty vertex cache.
      * \param type The type of data this cache will hold
@@ -107,6 +130,16 @@ public:
      */
     void notify_window_resized(const vector2ui& new_dimensions) override;
 
+    /**
+     * \brief Checks if quads are rendered as triangles with SDL_RenderGeometry.
+     * \return 'true' if SDL_RenderGeometry is used, 'false' otherwise
+     * \note SDL_RenderGeometry is available since SDL 2.0.18, and allows rendering
+     * a whole batch of quads in a single call, with a color for each vertex. With older
+     * versions of SDL, each quad is rendered with SDL_RenderCopyEx, per-vertex colors are
+     * emulated with temporary textures, and vertex caches are not supported.
+     */
+    bool is_geometry_supported() const;
+
     /**
      * \brief Returns the SDL renderer implementation.
      * \return the SDL renderer implementation
@@ -127,9 +160,10 @@ protected:
     /**
      * \brief Creates a new atlas with a given texture filter mode.
      * \param filt The filtering to apply to the texture
+     * \param single_channel 'true' if the atlas holds single-channel font textures
      * \return The new atlas
      */
-    std::shared_ptr<gui::atlas> create_atlas_(material::filter filt) override;
+    std::shared_ptr<gui::atlas> create_atlas_(material::filter filt, bool single_channel) override;
 
     /**
      * \brief Creates a new font.
@@ -148,6 +182,22 @@ protected:
         const std::vector<code_point_range>& code_points,
         char32_t                             default_code_point) override;
 
+    /**
+     * \brief Creates a new distance field font.
+     * \param font_file The file from which to read the font
+     * \param size The size of the characters in the font texture (in pixels)
+     * \param spread The largest distance stored in the distance field (in pixels)
+     * \param code_points The list of Unicode characters to load
+     * \param default_code_point The character to display as fallback
+     * \note Not supported by this implementation.
+     */
+    std::shared_ptr<gui::font> create_distance_field_font_(
+        const std::string&                   font_file,
+        std::size_t                          size,
+        std::size_t                          spread,
+        const std::vector<code_point_range>& code_points,
+        char32_t                             default_code_point) override;
+
     /**
      * \brief Begins rendering on a particular render target.
      * \param target The render target (main screen if nullptr)
@@ -175,6 +225,26 @@ protected:
      */
     void set_view_(const matrix4f& view_matrix) override;
 
+    /**
+     * \brief Returns the current view matrix to use when rendering (viewport).
+     * \return The current view matrix to use when rendering
+     */
+    matrix4f get_view_() const override;
+
+    /**
+     * \brief Restricts rendering to a rectangle of the current render target.
+     * \param rect The rectangle in pixels of the render target (origin at the top-left
+     * corner), or std::nullopt to render on the whole render target
+     */
+    void set_scissor_(const std::optional<bounds2f>& rect) override;
+
+    /**
+     * \brief Sets the distance threshold to use when rendering distance field fonts.
+     * \param threshold The value of the distance field at the edge of the rendered glyphs,
+     * or std::nullopt to render materials normally
+     */
+    void set_distance_field_threshold_(const std::optional<float>& threshold) override;
+
     /**
      * \brief Renders a quad from a material and array of vertices.
      * \param mat The material to use to to render the quad, or null if none
@@ -208,6 +278,7 @@ protected:
      * \param mat The material to use for rendering, or null if none
      * \param cache The vertex cache
      * \param model_transform The transformation matrix to apply to vertices
+     * \param tint The color to multiply with the color of each vertex
      * \note This function is meant to be called between begin() and
      * end() only. When multiple quads share the same material, it is
      * always more efficient to call this method than calling render_quad
@@ -223,11 +294,28 @@ protected:
     void render_cache_(
         const gui::material*     mat,
         const gui::vertex_cache& cache,
-        const matrix4f&          model_transform) override;
+        const matrix4f&          model_transform,
+        const color&             tint) override;
 
 private:
+    void set_blend_mode_(const sdl::material* mat);
+
+    const int* get_quad_index_list_(std::size_t num_quads);
+
+    void render_geometry_(
+        const sdl::material*   mat,
+        const float*           position_data,
+        std::size_t            position_stride,
+        const geometry_vertex* vertex_data,
+        std::size_t            num_vertex,
+        bool                   quads);
+
+    void render_quads_geometry_(
+        const sdl::material* mat, const std::vector<std::array<vertex, 4>>& quad_list);
+
     SDL_Renderer* renderer_                       = nullptr;
     bool          pre_multiplied_alpha_supported_ = false;
+    bool          geometry_supported_             = false;
     std::size_t   texture_max_size_               = 0u;
 
     vector2ui window_dimensions_;
@@ -236,6 +324,10 @@ private:
     matrix4f  target_view_matrix_;
 
     std::shared_ptr<gui::sdl::render_target> current_target_;
+
+    std::vector<geometry_vertex> geometry_vertex_list_;
+    std::vector<vector2f>        geometry_position_list_;
+    std::vector<int>             quad_index_list_;
 };
 
 } // namespace lxgui::gui::sdl
@@ -0,0 +1,86 @@
+#ifndef LXGUI_GUI_SDL_VERTEX_CACHE_HPP
+#define LXGUI_GUI_SDL_VERTEX_CACHE_HPP
+
+#include "lxgui/gui_color.hpp"
+#include "lxgui/gui_vector2.hpp"
+#include "lxgui/gui_vertex_cache.hpp"
+#include "lxgui/utils.hpp"
+
+#include <vector>
+
+namespace lxgui::gui::sdl {
+
+/**
+ * \brief Vertex data in the format expected by SDL_RenderGeometryRaw
+ * \details Colors are stored as 8-bit channels (pre-multiplied by alpha if the
+ * renderer supports it), and texture coordinates are normalized to the dimensions
+ * of the texture canvas.
+ */
+struct geometry_vertex {
+    vector2f pos;
+    color32  col;
+    vector2f uvs;
+};
+
+/**
+ * \brief An object representing cached vertex data
+ * \details A vertex cache stores vertices and indices that can be used to draw
+ * any shape on the screen. If the type is TRIANGLES, each group of 3
+ * vertices forms a triangle, while if the type is QUADS, each group of 4
+ * vertices forms a quad.
+ *
+ * SDL has no notion of GPU vertex buffers, so the data is kept in main memory,
+ * already converted to the format expected by SDL_RenderGeometryRaw. Only the
+ * vertex positions need to be transformed when the cache is rendered.
+ *
+ * A vertex cache can be rendered with gui::renderer::render_vertex_cache().
+ */
+class vertex_cache final : public gui::vertex_cache {
+public:
+    /**
+     * \brief Constructor.
+     * \param t The type of data this cache will hold
+     * \param pre_multiplied_alpha_supported Set to 'true' if the renderer supports
+     * pre-multipled alpha
+     * \details A default constructed vertex cache holds no data. Use update()
+     * to store vertices to be rendered.
+     */
+    explicit vertex_cache(type t, bool pre_multiplied_alpha_supported);
+
+    /**
+     * \brief Update the data stored in the cache to form new triangles.
+     * \param vertex_data The vertices to cache
+     * \param num_vertex The number of vertices to cache
+     * \note If the type if TRIANGLES, num_vertex must be a multiple of 3.
+     * If the type if QUADS, num_vertex must be a multiple of 4.
+     */
+    void update(const vertex* vertex_data, std::size_t num_vertex) override;
+
+    /**
+     * \brief Returns the type of data stored in this cache.
+     * \return The type of data stored in this cache
+     */
+    type get_type() const;
+
+    /**
+     * \brief Returns the cached vertices.
+     * \return The cached vertices
+     */
+    const std::vector<geometry_vertex>& get_vertex_list() const;
+
+    /**
+     * \brief Converts a vertex to the SDL geometry format.
+     * \param v The vertex to convert
+     * \param pre_multiplied_alpha_supported Set to 'true' to pre-multiply the color by alpha
+     * \return The converted vertex
+     */
+    static geometry_vertex to_sdl(const vertex& v, bool pre_multiplied_alpha_supported);
+
+private:
+    bool                         pre_multiplied_alpha_supported_ = false;
+    std::vector<geometry_vertex> vertex_list_;
+};
+
+} // namespace lxgui::gui::sdl
+
+#endif
@@ -4,6 +4,7 @@
 #include "lxgui/gui_font.hpp"
 #include "lxgui/impl/gui_sfml_material.hpp"
 #include "lxgui/utils.hpp"
+#include "lxgui/utils_file_system.hpp"
 
 #include <SFML/Graphics/Font.hpp>
 #include <vector>
@@ -80,6 +81,14 @@ public:
      */
     float get_character_kerning(char32_t c1, char32_t c2) const override;
 
+    /**
+     * \brief Returns the spread of the distance field, for distance field fonts.
+     * \return The largest distance (in pixels of the font texture) stored in the distance
+     * field, or zero if this font is not a distance field font
+     * \note Distance field fonts are not supported by this implementation.
+     */
+    float get_distance_field_spread() const override;
+
     /**
      * \brief Returns the underlying material to use for rendering.
      * \return The underlying material to use for rendering
@@ -95,13 +104,15 @@ public:
 private:
     char32_t get_character_(char32_t c) const;
 
-    sf::Font    font_;
-    std::size_t size_               = 0u;
-    std::size_t outline_            = 0u;
-    char32_t    default_code_point_ = 0u;
+    utils::file_content content_; // read by font_, must outlive it
+    sf::Font            font_;
+    std::size_t         size_               = 0u;
+    std::size_t         outline_            = 0u;
+    char32_t            default_code_point_ = 0u;
 
     std::shared_ptr<sfml::material> texture_;
     std::vector<code_point_range>   code_points_;
+    kerning_table                   kerning_;
 };
 
 } // namespace lxgui::gui::sfml
@@ -33,13 +33,11 @@ public:
     std::string get_name() const override;
 
     /**
-     * \brief Returns the current view matrix to use when rendering (viewport).
-     * \return The current view matrix to use when rendering
-     * \note See set_view() for more information. The returned matrix may be different
-     * from the matrix given to set_view(), if the rendering backend does not
-     * support certain transformations.
+     * \brief Checks if the renderer supports restricting rendering to a rectangle.
+     * \return 'true' if supported, 'false' otherwise
+     * \note Not supported by this implementation.
      */
-    matrix4f get_view() const override;
+    bool is_scissor_supported() const override;
 
     /**
      * \brief Returns the maximum texture width/height (in pixels).
@@ -61,6 +59,13 @@ public:
      */
     bool is_texture_vertex_color_supported() const override;
 
+    /**
+     * \brief Checks if the fonts of this renderer store glyphs in single-channel textures.
+     * \return 'true' if font textures have a single channel, 'false' if they are RGBA
+     * \note SFML textures are always RGBA.
+     */
+    bool is_single_channel_font_supported() const override;
+
     /**
      * \brief Creates a new material from arbitrary pixel data.
      * \param dimensions The dimensions of the material
@@ -96,6 +101,21 @@ public:
      */
     bool is_vertex_cache_supported() const override;
 
+    /**
+     * \brief Checks if the renderer supports the compact vertex layout in vertex caches.
+     * \return 'true' if supported, 'false' otherwise
+     * \note SFML vertex buffers have a fixed layout (sf::Vertex), so this always
+     * returns 'false'.
+     */
+    bool is_packed_vertex_supported() const override;
+
+    /**
+     * \brief Checks if the renderer supports rendering distance field fonts.
+     * \return 'true' if supported, 'false' otherwise
+     * \note Not supported by this implementation.
+     */
+    bool is_distance_field_supported() const override;
+
     /**
      * \brief Creates a new empty vertex cache.
      * \param type The type of data this cache will hold
@@ -123,9 +143,10 @@ protected:
     /**
      * \brief Creates a new atlas with a given texture filter mode.
      * \param filt The filtering to apply to the texture
+     * \param single_channel 'true' if the atlas holds single-channel font textures
      * \return The new atlas
      */
-    std::shared_ptr<gui::atlas> create_atlas_(material::filter filt) override;
+    std::shared_ptr<gui::atlas> create_atlas_(material::filter filt, bool single_channel) override;
 
     /**
      * \brief Creates a new font.
@@ -144,6 +165,22 @@ protected:
         const std::vector<code_point_range>& code_points,
         char32_t                             default_code_point) override;
 
+    /**
+     * \brief Creates a new distance field font.
+     * \param font_file The file from which to read the font
+     * \param size The size of the characters in the font texture (in pixels)
+     * \param spread The largest distance stored in the distance field (in pixels)
+     * \param code_points The list of Unicode characters to load
+     * \param default_code_point The character to display as fallback
+     * \note Not supported by this implementation.
+     */
+    std::shared_ptr<gui::font> create_distance_field_font_(
+        const std::string&                   font_file,
+        std::size_t                          size,
+        std::size_t                          spread,
+        const std::vector<code_point_range>& code_points,
+        char32_t                             default_code_point) override;
+
     /**
      * \brief Begins rendering on a particular render target.
      * \param target The render target (main screen if nullptr)
@@ -171,6 +208,26 @@ protected:
      */
     void set_view_(const matrix4f& view_matrix) override;
 
+    /**
+     * \brief Returns the current view matrix to use when rendering (viewport).
+     * \return The current view matrix to use when rendering
+     */
+    matrix4f get_view_() const override;
+
+    /**
+     * \brief Restricts rendering to a rectangle of the current render target.
+     * \param rect The rectangle in pixels of the render target (origin at the top-left
+     * corner), or std::nullopt to render on the whole render target
+     */
+    void set_scissor_(const std::optional<bounds2f>& rect) override;
+
+    /**
+     * \brief Sets the distance threshold to use when rendering distance field fonts.
+     * \param threshold The value of the distance field at the edge of the rendered glyphs,
+     * or std::nullopt to render materials normally
+     */
+    void set_distance_field_threshold_(const std::optional<float>& threshold) override;
+
     /**
      * \brief Renders a set of quads.
      * \param mat The material to use for rendering, or null if none
@@ -195,6 +252,7 @@ protected:
      * \param mat The material to use for rendering, or null if none
      * \param cache The vertex cache
      * \param model_transform The transformation matrix to apply to vertices
+     * \param tint The color to multiply with the color of each vertex
      * \note This function is meant to be called between begin() and
      * end() only. When multiple quads share the same material, it is
      * always more efficient to call this method than calling render_quad
@@ -210,7 +268,8 @@ protected:
     void render_cache_(
         const gui::material*     mat,
         const gui::vertex_cache& cache,
-        const matrix4f&          model_transform) override;
+        const matrix4f&          model_transform,
+        const color&             tint) override;
 
 private:
     sf::RenderWindow& window_;
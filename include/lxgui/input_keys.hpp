@@ -5,6 +5,7 @@
 
 #include <cstdint>
 #include <optional>
+#include <string>
 #include <string_view>
 
 namespace lxgui::input {
@@ -247,6 +248,51 @@ key get_key_from_codename(std::string_view key_name);
  */
 std::string_view get_localizable_key_name(key key_id);
 
+/**
+ * \brief Compact code for a key pressed together with modifiers (Shift, Ctrl, Alt).
+ * \details The lower 8 bits hold the key, and the next 3 bits hold the modifiers. This is
+ * the integer equivalent of key names with modifiers, e.g., "Ctrl-Shift-C".
+ * \see make_key_chord()
+ */
+enum class key_chord : std::uint16_t {};
+
+/**
+ * \brief Returns the chord for a key and the modifiers pressed with it.
+ * \param key_id The key
+ * \param shift_is_pressed 'true' if the Shift key is pressed
+ * \param ctrl_is_pressed 'true' if the Ctrl key is pressed
+ * \param alt_is_pressed 'true' if the Alt key is pressed
+ * \return The chord
+ * \note Modifiers are ignored if the key is itself a modifier key (e.g., Shift).
+ */
+key_chord
+make_key_chord(key key_id, bool shift_is_pressed, bool ctrl_is_pressed, bool alt_is_pressed);
+
+/**
+ * \brief Returns the key of a chord, without modifiers.
+ * \param chord The chord
+ * \return The key of the chord
+ */
+key get_key_chord_key(key_chord chord);
+
+/**
+ * \brief Returns a standard English name for the provided key chord.
+ * \param chord The chord
+ * \return The name of the chord, e.g., "Ctrl-Alt-Shift-C"
+ * \note The modifiers are listed before the key name, in the order "Ctrl-", "Alt-", "Shift-".
+ * \see get_key_codename()
+ */
+std::string get_key_chord_codename(key_chord chord);
+
+/**
+ * \brief Returns the key chord from its standard English name.
+ * \param chord_name The name of the chord, e.g., "Shift-C"
+ * \return The chord, or std::nullopt if the key name is not recognized
+ * \note Modifiers can be listed in any order.
+ * \see get_key_chord_codename()
+ */
+std::optional<key_chord> get_key_chord_from_codename(std::string_view chord_name);
+
 constexpr std::size_t mouse_button_number = 3u;
 constexpr std::size_t key_number          = static_cast<std::size_t>(key::k_maxkey);
 
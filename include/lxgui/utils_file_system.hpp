@@ -4,13 +4,112 @@
 #include "lxgui/lxgui.hpp"
 #include "lxgui/utils.hpp"
 
+#include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace lxgui::utils {
 
 using string_vector = std::vector<std::string>;
 
+/**
+ * \brief Content of a file, as returned by read_file().
+ * \details For a file stored in a mounted archive, this points directly into the memory-mapped
+ * archive, and keeps the archive mapped for as long as this object lives. For a file stored on
+ * disk, this owns a copy of the file content. Copying this object does not copy the content.
+ */
+class file_content {
+public:
+    /// Creates an empty content.
+    file_content() = default;
+
+    /**
+     * \brief Creates a content owning a buffer.
+     * \param content The file content
+     */
+    explicit file_content(std::string content);
+
+    /**
+     * \brief Creates a content pointing into a buffer owned by another object.
+     * \param owner The object owning the buffer
+     * \param content The file content, within the buffer
+     */
+    file_content(std::shared_ptr<const void> owner, std::string_view content) noexcept;
+
+    /**
+     * \brief Returns the content of the file.
+     * \return The content of the file
+     */
+    std::string_view get_view() const noexcept {
+        return view_;
+    }
+
+    /**
+     * \brief Returns a pointer to the first byte of the file.
+     * \return A pointer to the first byte of the file
+     */
+    const char* data() const noexcept {
+        return view_.data();
+    }
+
+    /**
+     * \brief Returns the size of the file, in bytes.
+     * \return The size of the file, in bytes
+     */
+    std::size_t size() const noexcept {
+        return view_.size();
+    }
+
+private:
+    std::shared_ptr<const void> owner_;
+    std::string_view            view_;
+};
+
+/**
+ * \brief Mounts a packed archive into the virtual file system.
+ * \param archive_file The archive to mount (see pack_archive())
+ * \param mount_point The directory in which the archive content appears (empty: current directory)
+ * \throw utils::exception if the archive cannot be opened, or is not a valid archive.
+ * \details The archive is memory-mapped, and its index is read once. Files in the archive are
+ * then found by file_exists(), read_file(), get_directory_list(), and get_file_list(), as if they
+ * were stored on disk under the mount point. Archives mounted last take precedence, and all
+ * archives take precedence over files on disk.
+ * \note If LXGUI_ENABLE_MULTITHREADING is defined, archives can be mounted while other threads
+ * read files: these reads find the file either in the new archive, or where it was found
+ * before. Otherwise, the virtual file system must only be used from one thread.
+ */
+void mount_archive(const std::string& archive_file, const std::string& mount_point = "");
+
+/**
+ * \brief Unmounts all the archives from the virtual file system.
+ * \note Content returned by read_file() remains valid until destroyed. Like mount_archive(),
+ * this can be called while other threads read files if LXGUI_ENABLE_MULTITHREADING is defined.
+ */
+void unmount_archives();
+
+/**
+ * \brief Packs the content of a directory into an archive.
+ * \param directory The directory to pack (including sub-directories)
+ * \param archive_file The archive to create
+ * \return The number of files in the archive
+ * \throw utils::exception if a file cannot be read, or the archive cannot be written.
+ * \details The archive contains an index of all the files, followed by their content. Paths in
+ * the index are relative to the packed directory, and use '/' as separator.
+ */
+std::size_t pack_archive(const std::string& directory, const std::string& archive_file);
+
+/**
+ * \brief Reads the whole content of a file from the virtual file system.
+ * \param file The file to read
+ * \return The content of the file, or std::nullopt if the file cannot be read
+ * \note If LXGUI_ENABLE_MULTITHREADING is defined, this can be called from several threads at
+ * once, like file_exists(), get_directory_list(), and get_file_list(). This is what allows
+ * layout files to be read by worker threads (see parallel_for()).
+ */
+std::optional<file_content> read_file(const std::string& file);
+
 bool file_exists(const std::string& file);
 
 bool make_directory(const std::string& path);
@@ -24,6 +123,15 @@ get_file_list(const std::string& rel_path, bool with_path, const std::string& ex
 
 std::string get_file_extension(const std::string& file);
 
+/**
+ * \brief Returns a path in normal form, to compare paths to the same file.
+ * \param path The path to normalize
+ * \return The normalized path
+ * \details Redundant separators, "." and ".." elements, and trailing separators are removed,
+ * and '/' is used as separator. The current directory is returned as an empty path.
+ */
+std::string normalize_path(const std::string& path);
+
 } // namespace lxgui::utils
 
 #endif
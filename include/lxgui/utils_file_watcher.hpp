@@ -0,0 +1,77 @@
+#ifndef LXGUI_UTILS_FILE_WATCHER_HPP
+#define LXGUI_UTILS_FILE_WATCHER_HPP
+
+#include "lxgui/lxgui.hpp"
+#include "lxgui/utils.hpp"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#if !defined(LXGUI_PLATFORM_LINUX)
+#    include <chrono>
+#    include <filesystem>
+#endif
+
+namespace lxgui::utils {
+
+/**
+ * \brief Watches directories for created or modified files.
+ * \details On Linux, this uses inotify: the kernel reports each file as soon as it is written,
+ * and checking for changes costs a single system call. On other platforms, the watched
+ * directories are scanned for new modification times, at most once per polling interval.
+ * \note Files in mounted archives (see mount_archive()) are not watched.
+ */
+class file_watcher {
+public:
+    /**
+     * \brief Constructor.
+     * \throw utils::exception if file notifications cannot be initialized.
+     */
+    file_watcher();
+
+    /// Destructor.
+    ~file_watcher();
+
+    // Non-copiable, non-movable
+    file_watcher(const file_watcher&)            = delete;
+    file_watcher(file_watcher&&)                 = delete;
+    file_watcher& operator=(const file_watcher&) = delete;
+    file_watcher& operator=(file_watcher&&)      = delete;
+
+    /**
+     * \brief Starts watching a directory, and all its sub-directories.
+     * \param directory The directory to watch
+     * \note Directories which do not exist on disk are ignored.
+     */
+    void watch_directory(const std::string& directory);
+
+    /**
+     * \brief Returns the files created or modified since the last call.
+     * \return The list of files, each listed once
+     * \note This does not block. Paths start with the watched directory, and use '/' as
+     * separator (see normalize_path()).
+     */
+    std::vector<std::string> get_modified_files();
+
+    /// Interval between two scans of the watched directories, without file notifications.
+    static constexpr float polling_interval = 0.5f;
+
+private:
+#if defined(LXGUI_PLATFORM_LINUX)
+    void add_watch_(const std::string& directory);
+
+    int                                  inotify_ = -1;
+    std::unordered_map<int, std::string> watch_list_;
+#else
+    void scan_(const std::string& directory, std::vector<std::string>* modified_list);
+
+    std::vector<std::string>                                         directory_list_;
+    std::unordered_map<std::string, std::filesystem::file_time_type> time_list_;
+    std::chrono::steady_clock::time_point                            last_scan_;
+#endif
+};
+
+} // namespace lxgui::utils
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef LXGUI_UTILS_PARALLEL_HPP
+#define LXGUI_UTILS_PARALLEL_HPP
+
+#include "lxgui/lxgui.hpp"
+
+#include <cstddef>
+#include <functional>
+
+namespace lxgui::utils {
+
+/**
+ * \brief Returns the number of threads used by parallel_for().
+ * \return The number of threads used by parallel_for(), including the calling thread
+ * \note This is 1 if multi-threading is disabled (see LXGUI_ENABLE_MULTITHREADING).
+ */
+std::size_t get_worker_thread_count() noexcept;
+
+/**
+ * \brief Calls a function for each index in [0, count), using multiple threads.
+ * \param count The number of indices to process
+ * \param function The function to call for each index
+ * \details The indices are distributed among up to get_worker_thread_count() threads
+ * (including the calling thread), in an unspecified order. This function returns once all
+ * the indices have been processed. If the function throws, the first exception is re-thrown
+ * on the calling thread once all the threads are done. The function must therefore be safe
+ * to call from multiple threads at once.
+ * \note The worker threads are started on the first call, and then wait for the next calls
+ * until the program exits. They serve one call at a time: calls made from another thread
+ * while the workers are busy, or from within the function itself, process all their indices
+ * on the calling thread.
+ */
+void parallel_for(std::size_t count, const std::function<void(std::size_t)>& function);
+
+} // namespace lxgui::utils
+
+#endif
@@ -0,0 +1,126 @@
+#ifndef LXGUI_UTILS_POOL_ALLOCATOR_HPP
+#define LXGUI_UTILS_POOL_ALLOCATOR_HPP
+
+#include "lxgui/lxgui.hpp"
+
+#include <cstddef>
+#include <memory>
+
+namespace lxgui::utils {
+
+/// Allocation statistics of the memory pools used by pool_allocator.
+struct memory_pool_stats {
+    /// Number of blocks given by the pools
+    std::size_t allocations = 0u;
+    /// Number of blocks given back to the pools
+    std::size_t deallocations = 0u;
+    /// Number of chunks requested from the system allocator to fill the pools
+    std::size_t system_allocations = 0u;
+    /// Total size of these chunks (in bytes)
+    std::size_t reserved_bytes = 0u;
+
+    /**
+     * \brief Returns the number of blocks currently in use.
+     * \return The number of blocks currently in use
+     */
+    std::size_t get_live_count() const {
+        return allocations - deallocations;
+    }
+};
+
+/// Largest allocation (in bytes) served by the memory pools.
+constexpr std::size_t max_pooled_size = 256u;
+
+/** \cond INCLUDE_INTERNALS_IN_DOC
+ */
+namespace memory_pool_impl {
+
+void* allocate(std::size_t size);
+void  deallocate(void* ptr, std::size_t size) noexcept;
+
+} // namespace memory_pool_impl
+/** \endcond
+ */
+
+/**
+ * \brief Returns the allocation statistics of the memory pools.
+ * \return The allocation statistics of the memory pools
+ */
+memory_pool_stats get_memory_pool_stats();
+
+/**
+ * \brief Resets the allocation statistics of the memory pools.
+ * \note Blocks which are still in use remain counted as allocated, and the reserved memory
+ * is unchanged. This can be used to measure the allocations done during a specific
+ * operation (e.g., reloading the UI).
+ */
+void reset_memory_pool_stats();
+
+/**
+ * \brief Standard allocator drawing small blocks from shared memory pools.
+ * \details Allocations up to max_pooled_size bytes are rounded up to a multiple of 16 bytes,
+ * and served from a free list holding blocks of that size. The free lists are filled by
+ * allocating chunks of several blocks at once, so creating and destroying many small objects
+ * (list nodes, short vectors, signal slots) no longer reaches the system allocator, nor
+ * fragments the heap. Larger allocations use std::allocator.
+ * \note Memory given back to the pools is kept for later allocations, and is never returned
+ * to the system. The pools are shared by all allocators. If LXGUI_ENABLE_MULTITHREADING is
+ * defined, each size class is protected by its own mutex, so only allocations of the same
+ * size class contend with each other; otherwise the pools must only be used from one thread.
+ */
+template<typename T>
+class pool_allocator {
+public:
+    using value_type = T;
+
+    /// Default constructor.
+    pool_allocator() noexcept = default;
+
+    /// Conversion constructor.
+    template<typename U>
+    pool_allocator(const pool_allocator<U>&) noexcept {}
+
+    /**
+     * \brief Allocates memory for an array of objects.
+     * \param count The number of objects
+     * \return The allocated memory
+     */
+    T* allocate(std::size_t count) {
+        if constexpr (alignof(T) <= alignof(std::max_align_t)) {
+            if (count <= max_pooled_size / sizeof(T))
+                return static_cast<T*>(memory_pool_impl::allocate(count * sizeof(T)));
+        }
+
+        return std::allocator<T>().allocate(count);
+    }
+
+    /**
+     * \brief Deallocates memory allocated with allocate().
+     * \param ptr The memory to deallocate
+     * \param count The number of objects given to allocate()
+     */
+    void deallocate(T* ptr, std::size_t count) noexcept {
+        if constexpr (alignof(T) <= alignof(std::max_align_t)) {
+            if (count <= max_pooled_size / sizeof(T)) {
+                memory_pool_impl::deallocate(ptr, count * sizeof(T));
+                return;
+            }
+        }
+
+        std::allocator<T>().deallocate(ptr, count);
+    }
+
+    template<typename U>
+    bool operator==(const pool_allocator<U>&) const noexcept {
+        return true;
+    }
+
+    template<typename U>
+    bool operator!=(const pool_allocator<U>&) const noexcept {
+        return false;
+    }
+};
+
+} // namespace lxgui::utils
+
+#endif
@@ -3,6 +3,7 @@
 
 #include "lxgui/utils.hpp"
 #include "lxgui/utils_observer.hpp"
+#include "lxgui/utils_pool_allocator.hpp"
 #include "lxgui/utils_view.hpp"
 
 #include <algorithm>
@@ -29,7 +30,7 @@ class connection {
     template<typename T>
     friend class signal;
 
-    explicit connection(utils::observer_ptr<signal_impl::slot_base> slot) noexcept :
+    explicit connection(std::weak_ptr<signal_impl::slot_base> slot) noexcept :
         slot_(std::move(slot)) {}
 
 public:
@@ -44,22 +45,22 @@ public:
 
     /// Disconnect the slot.
     void disconnect() noexcept {
-        if (auto* raw = slot_.get()) {
+        if (auto raw = slot_.lock())
             raw->disconnected = true;
-            slot_             = nullptr;
-        }
+
+        slot_.reset();
     }
 
     /// Check if this slot is still connected.
     [[nodiscard]] bool connected() const noexcept {
-        if (auto* raw = slot_.get())
+        if (auto raw = slot_.lock())
             return !raw->disconnected;
         else
             return false;
     }
 
 private:
-    utils::observer_ptr<signal_impl::slot_base> slot_;
+    std::weak_ptr<signal_impl::slot_base> slot_;
 };
 
 /// A @ref connection that automatically disconnects when going out of scope.
@@ -182,19 +183,22 @@ private:
      *  - std::list
      *  - std::forward_list
      *
-     * std::vector is the simplest and most efficient, hence is chosen here.
+     * std::vector is the simplest and most efficient, hence is chosen here. Its memory is
+     * taken from the memory pools (see utils::pool_allocator), since most signals only
+     * have a few slots.
      */
     template<typename U>
-    using container_type = std::vector<U>;
+    using container_type = std::vector<U, utils::pool_allocator<U>>;
 
     /**
      * \brief Type of the slot list.
-     * Slots are stored as observable shared pointers, so that connection objects
-     * can be implemented as a simple observer pointer, without risk of accessing
-     * an already deleted slot. If manual disconnection is not required, this could
-     * be changed to store slots by value directly for better performance.
+     * Slots are stored as shared pointers, so that connection objects can be implemented
+     * as a simple weak pointer, without risk of accessing an already deleted slot. Slots
+     * are allocated from the memory pools (see utils::pool_allocator). If manual
+     * disconnection is not required, this could be changed to store slots by value
+     * directly for better performance.
      */
-    using slot_list = container_type<utils::owner_ptr<slot>>;
+    using slot_list = container_type<std::shared_ptr<slot>>;
 
     /// De-reference an iterator from the slot list to get to the function.
     template<typename BaseIterator>
@@ -219,7 +223,8 @@ public:
         utils::view::adaptor<slot_list, slot_dereferencer, non_disconnected_filter>;
 
     /// Default constructor (no slot).
-    signal() : impl_(std::make_shared<implementation>()) {}
+    signal() :
+        impl_(std::allocate_shared<implementation>(utils::pool_allocator<implementation>())) {}
 
     /// Destructor.
     ~signal() {
@@ -281,7 +286,8 @@ public:
      * can do this safely.
      */
     connection connect(function_type function) {
-        impl_->slots.push_back(utils::make_owned<slot>(std::move(function)));
+        impl_->slots.push_back(
+            std::allocate_shared<slot>(utils::pool_allocator<slot>(), std::move(function)));
         return connection(impl_->slots.back());
     }
 
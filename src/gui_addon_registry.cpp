@@ -1,15 +1,18 @@
 #include "lxgui/gui_addon_registry.hpp"
 
 #include "lxgui/gui_event_emitter.hpp"
+#include "lxgui/gui_exception.hpp"
 #include "lxgui/gui_localizer.hpp"
 #include "lxgui/gui_out.hpp"
 #include "lxgui/utils_file_system.hpp"
+#include "lxgui/utils_parallel.hpp"
 #include "lxgui/utils_range.hpp"
 #include "lxgui/utils_std.hpp"
 #include "lxgui/utils_string.hpp"
 
-#include <fstream>
+#include <array>
 #include <lxgui/extern_sol2_state.hpp>
+#include <sstream>
 
 namespace {
 // This should be incremented for each non-backward compatible change
@@ -23,30 +26,23 @@ addon_registry::addon_registry(
     sol::state& lua, localizer& loc, event_emitter& emitter, root& r, virtual_root& vr) :
     lua_(lua), localizer_(loc), event_emitter_(emitter), root_(r), virtual_root_(vr) {}
 
-void addon_registry::load_addon_toc_(
-    const std::string& addon_name, const std::string& addon_directory) {
-    auto& addons = addon_list_[addon_directory];
-    if (addons.find(addon_name) != addons.end())
-        return;
-
+std::optional<addon> addon_registry::parse_addon_toc_(
+    const std::string& addon_name, const std::string& addon_directory, std::ostream& log) {
     addon a;
     a.enabled        = true;
     a.main_directory = utils::cut(addon_directory, "/").back();
     a.directory      = addon_directory + "/" + addon_name;
 
-    std::string   toc_file = a.directory + "/" + addon_name + ".toc";
-    std::ifstream file(toc_file);
-    if (!file.is_open())
-        return;
+    std::string toc_file = a.directory + "/" + addon_name + ".toc";
+    const auto  content  = utils::read_file(toc_file);
+    if (!content.has_value())
+        return std::nullopt;
 
-    std::string line;
-    while (std::getline(file, line)) {
-        utils::replace(line, "\r", "");
-        if (line.empty())
+    for (std::string_view line_view : utils::cut_each(content->get_view(), "\n")) {
+        line_view = utils::trim(line_view, '\r');
+        if (line_view.empty())
             continue;
 
-        std::string_view line_view = line;
-
         if (line_view.size() >= 2 && line_view[0] == '#' && line_view[1] == '#') {
             line_view = line_view.substr(2);
             line_view = utils::trim(line_view, ' ');
@@ -61,7 +57,7 @@ void addon_registry::load_addon_toc_(
                     if (a.ui_version == lxgui_ui_version)
                         a.enabled = true;
                     else {
-                        gui::out << gui::warning << "gui::manager: "
+                        log << gui::warning << "gui::manager: "
                                  << "Wrong UI version for \"" << addon_name
                                  << "\" (got: " << a.ui_version
                                  << ", expected: " << lxgui_ui_version << "). AddOn disabled."
@@ -89,11 +85,13 @@ void addon_registry::load_addon_toc_(
         }
     }
 
-    if (a.name.empty())
-        gui::out << gui::error << "gui::manager: Missing addon name in " << toc_file << "."
-                 << std::endl;
-    else
-        addons[addon_name] = a;
+    if (a.name.empty()) {
+        log << gui::error << "gui::manager: Missing addon name in " << toc_file << "."
+            << std::endl;
+        return std::nullopt;
+    }
+
+    return a;
 }
 
 void addon_registry::load_addon_files_(const addon& a) {
@@ -103,52 +101,98 @@ void addon_registry::load_addon_files_(const addon& a) {
     for (const auto& file : a.file_list) {
         const std::string extension = utils::get_file_extension(file);
         if (extension == ".lua") {
-            auto result = lua_.do_file(file);
-            if (!result.valid()) {
-                std::string err = result.get<sol::error>().what();
-                gui::out << gui::error << err << std::endl;
-                event_emitter_.fire_event("LUA_ERROR", {err});
-            }
+            loaded_file_list_[utils::normalize_path(file)] = loaded_file{&a, true};
+            this->run_script_(file);
         } else {
             this->parse_layout_file_(file, a);
         }
     }
 
-    std::string saved_variables_file =
-        "saves/interface/" + a.main_directory + "/" + a.name + ".lua";
+    load_saved_variables_(a);
 
-    if (utils::file_exists(saved_variables_file)) {
-        auto result = lua_.do_file(saved_variables_file);
-        if (!result.valid()) {
-            std::string err = result.get<sol::error>().what();
-            gui::out << gui::error << err << std::endl;
-            event_emitter_.fire_event("LUA_ERROR", {err});
-        }
+    event_emitter_.fire_event("ADDON_LOADED", {a.name});
+}
+
+void addon_registry::run_script_(const std::string& file_name) {
+    std::string err;
+    if (const auto content = utils::read_file(file_name)) {
+        auto result =
+            lua_.safe_script(content->get_view(), sol::script_pass_on_error, "@" + file_name);
+        if (result.valid())
+            return;
+
+        err = result.get<sol::error>().what();
+    } else {
+        err = "cannot open " + file_name;
     }
 
-    event_emitter_.fire_event("ADDON_LOADED", {a.name});
+    gui::out << gui::error << err << std::endl;
+    event_emitter_.fire_event("LUA_ERROR", {err});
+}
+
+void addon_registry::load_saved_variables_(const addon& a) {
+    const std::string base_name = "saves/interface/" + a.main_directory + "/" + a.name;
+
+    // Prefer the current format, but read files saved in the other format too
+    const saved_variables_format other_format =
+        saved_variables_format_ == saved_variables_format::lua ? saved_variables_format::binary
+                                                               : saved_variables_format::lua;
+
+    for (const auto format : {saved_variables_format_, other_format}) {
+        const std::string file = base_name + get_saved_variables_extension(format);
+        if (!utils::file_exists(file))
+            continue;
+
+        if (format == saved_variables_format::lua) {
+            this->run_script_(file);
+        } else {
+            try {
+                load_binary_saved_variables(lua_, file);
+            } catch (const gui::exception& e) {
+                std::string err = e.get_description();
+                gui::out << gui::error << err << std::endl;
+                event_emitter_.fire_event("LUA_ERROR", {err});
+            }
+        }
+
+        return;
+    }
 }
 
 void addon_registry::load_addon_directory(const std::string& directory) {
-    for (const auto& sub_dir : utils::get_directory_list(directory))
-        this->load_addon_toc_(sub_dir, directory);
+    auto& addons = addon_list_[directory];
+
+    // Parse all TOC files in parallel, then register the addons in order. NB: listing and
+    // reading files through the virtual file system is safe from several threads at once.
+    const auto                        sub_dir_list = utils::get_directory_list(directory);
+    std::vector<std::optional<addon>> toc_list(sub_dir_list.size());
+    std::vector<std::string>          toc_log_list(sub_dir_list.size());
+
+    utils::parallel_for(sub_dir_list.size(), [&](std::size_t i) {
+        if (addons.find(sub_dir_list[i]) != addons.end())
+            return;
+
+        std::ostringstream log;
+        toc_list[i]     = parse_addon_toc_(sub_dir_list[i], directory, log);
+        toc_log_list[i] = log.str();
+    });
+
+    for (std::size_t i = 0; i < sub_dir_list.size(); ++i) {
+        gui::out << toc_log_list[i] << std::flush;
+        if (toc_list[i])
+            addons[sub_dir_list[i]] = std::move(*toc_list[i]);
+    }
 
     std::vector<addon*> core_addon_stack;
     std::vector<addon*> addon_stack;
     bool                core = false;
 
-    auto& addons = addon_list_[directory];
-
-    std::ifstream file(directory + "/addons.txt");
-    if (file.is_open()) {
-        std::string line;
-        while (std::getline(file, line)) {
-            utils::replace(line, "\r", "");
-            if (line.empty())
+    if (const auto content = utils::read_file(directory + "/addons.txt")) {
+        for (std::string_view line_view : utils::cut_each(content->get_view(), "\n")) {
+            line_view = utils::trim(line_view, '\r');
+            if (line_view.empty())
                 continue;
 
-            std::string_view line_view = line;
-
             if (line_view[0] == '#') {
                 line_view = line_view.substr(1);
                 line_view = utils::trim(line_view, ' ');
@@ -170,78 +214,137 @@ void addon_registry::load_addon_directory(const std::string& directory) {
                 }
             }
         }
-        file.close();
     }
 
+    std::vector<const addon*> load_list;
     for (auto* a : core_addon_stack) {
         if (a->enabled)
-            this->load_addon_files_(*a);
+            load_list.push_back(a);
     }
 
     for (auto* a : addon_stack) {
         if (a->enabled)
-            this->load_addon_files_(*a);
+            load_list.push_back(a);
     }
 
-    current_addon_ = nullptr;
-}
-
-std::string serialize(const std::string& tab, const sol::object& value) noexcept {
-    if (value.is<double>()) {
-        return utils::to_string(value.as<double>());
-    } else if (value.is<int>()) {
-        return utils::to_string(value.as<int>());
-    } else if (value.is<std::string>()) {
-        return "\"" + utils::to_string(value.as<std::string>()) + "\"";
-    } else if (value.is<sol::table>()) {
-        std::string result;
-        result += "{";
-
-        std::string content;
-        sol::table  table = value.as<sol::table>();
-        for (const auto& key_value : table) {
-            content += tab + "    [" + serialize("", key_value.first) +
-                       "] = " + serialize(tab + "    ", key_value.second) + ",\n";
+    // Parse all layout files in parallel; they will be picked up by parse_layout_file_()
+    std::vector<std::pair<std::string, std::string>> layout_file_list;
+    for (const auto* a : load_list) {
+        for (const auto& file : a->file_list) {
+            if (utils::get_file_extension(file) != ".lua")
+                layout_file_list.emplace_back(file, a->directory);
         }
+    }
 
-        if (!content.empty())
-            result += "\n" + content + tab;
+    this->parse_layout_files_(std::move(layout_file_list));
 
-        result += "}";
-        return result;
-    }
+    // Create frames and run scripts sequentially, in order
+    for (const auto* a : load_list)
+        this->load_addon_files_(*a);
 
-    return "nil";
+    parsed_layout_file_list_.clear();
+    current_addon_ = nullptr;
 }
 
-std::string serialize_global(sol::state& lua, const std::string& variable) noexcept {
-    sol::object value = lua.globals()[variable];
-    return serialize("", value);
+void addon_registry::set_saved_variables_format(saved_variables_format format) {
+    saved_variables_format_ = format;
+}
+
+saved_variables_format addon_registry::get_saved_variables_format() const {
+    return saved_variables_format_;
 }
 
 void addon_registry::save_variables() const {
+    saved_variables_writer writer;
+    save_variables(writer);
+    writer.wait();
+}
+
+void addon_registry::save_variables(saved_variables_writer& writer) const {
+    std::vector<saved_variables_writer::file> file_list;
     for (const auto& directory : addon_list_) {
-        for (const auto& a : utils::range::value(directory.second))
-            save_variables_(a);
+        for (const auto& a : utils::range::value(directory.second)) {
+            if (auto f = save_variables_(a))
+                file_list.push_back(std::move(f.value()));
+        }
     }
+
+    writer.write(std::move(file_list));
 }
 
-void addon_registry::save_variables_(const addon& a) const noexcept {
-    if (!a.saved_variable_list.empty()) {
-        if (!utils::make_directory("saves/interface/" + a.main_directory)) {
-            gui::out << gui::error
-                     << "gui::addon_registry: unable to create directory 'saves/interface/"
-                     << a.main_directory << "'" << std::endl;
-            return;
+std::optional<saved_variables_writer::file>
+addon_registry::save_variables_(const addon& a) const noexcept {
+    if (a.saved_variable_list.empty())
+        return std::nullopt;
+
+    if (!utils::make_directory("saves/interface/" + a.main_directory)) {
+        gui::out << gui::error
+                 << "gui::addon_registry: unable to create directory 'saves/interface/"
+                 << a.main_directory << "'" << std::endl;
+        return std::nullopt;
+    }
+
+    saved_variables_writer::file f;
+    f.name = "saves/interface/" + a.main_directory + "/" + a.name +
+             get_saved_variables_extension(saved_variables_format_);
+
+    try {
+        serialize_saved_variables(lua_, a.saved_variable_list, saved_variables_format_, f.content);
+    } catch (const std::exception& e) {
+        gui::out << gui::error << "gui::addon_registry: unable to save variables of '" << a.name
+                 << "': " << e.what() << std::endl;
+        return std::nullopt;
+    }
+
+    return f;
+}
+
+bool addon_registry::reload_files(const std::vector<std::string>& file_list) {
+    // Files which, when not used by a loaded addon, may still affect the UI
+    static const std::array<std::string_view, 14> resource_extension_list = {
+        ".toc", ".txt", ".lua", ".lxt", ".xml", ".yml", ".yaml", ".png", ".jpg", ".jpeg", ".bmp",
+        ".tga", ".ttf", ".otf"};
+
+    // Check all files first, so nothing is reloaded if a full reload is needed
+    std::vector<std::string> reload_list;
+    for (const auto& file : file_list) {
+        std::string file_name = utils::normalize_path(file);
+
+        auto iter = loaded_file_list_.find(file_name);
+        if (iter == loaded_file_list_.end()) {
+            const std::string extension = utils::get_file_extension(file_name);
+            if (utils::find(resource_extension_list, extension) != resource_extension_list.end())
+                return false;
+
+            continue;
         }
 
-        std::ofstream file("saves/interface/" + a.main_directory + "/" + a.name + ".lua");
-        for (const auto& variable : a.saved_variable_list) {
-            std::string serialized = serialize_global(lua_, variable);
-            if (!serialized.empty())
-                file << serialized << "\n";
+        if (!iter->second.is_script && has_virtual_frames_(file_name))
+            return false;
+
+        if (utils::find(reload_list, file_name) == reload_list.end())
+            reload_list.push_back(std::move(file_name));
+    }
+
+    for (const auto& file_name : reload_list) {
+        auto iter = loaded_file_list_.find(file_name);
+        if (iter == loaded_file_list_.end())
+            continue;
+
+        const addon& a = *iter->second.add_on;
+        gui::out << "gui::addon_registry: reloading " << file_name << "." << std::endl;
+
+        current_addon_ = &a;
+        if (iter->second.is_script) {
+            this->run_script_(file_name);
+        } else {
+            this->unload_layout_file_(file_name);
+            this->parse_layout_file_(file_name, a);
         }
     }
+
+    current_addon_ = nullptr;
+    return true;
 }
 
 const addon* addon_registry::get_current_addon() {
@@ -7,6 +7,8 @@
 #include "lxgui/gui_root.hpp"
 #include "lxgui/gui_virtual_root.hpp"
 #include "lxgui/utils_file_system.hpp"
+#include "lxgui/utils_parallel.hpp"
+#include "lxgui/utils_std.hpp"
 #include "lxgui/utils_string.hpp"
 
 #include <lxgui/extern_sol2_state.hpp>
@@ -17,67 +19,22 @@
 #    include <lxgui/extern_ryml.hpp>
 #endif
 
-#include <fstream>
+#include <cctype>
+#include <sstream>
 
 namespace lxgui::gui {
 
-class file_line_mappings {
-public:
-    explicit file_line_mappings(const std::string& file_name) : file_name_(file_name) {
-        std::ifstream stream(file_name);
-        if (!stream.is_open())
-            return;
-
-        std::string line;
-        std::size_t prev_pos = 0u;
-        while (std::getline(stream, line)) {
-            file_content_ += '\n' + line;
-            line_offsets_.push_back(prev_pos);
-            prev_pos += line.size() + 1u;
-        }
-
-        line_offsets_.push_back(prev_pos);
-
-        is_open_ = true;
-    }
-
-    bool is_open() const {
-        return is_open_;
-    }
-
-    const std::string& get_content() const {
-        return file_content_;
-    }
-
-    std::pair<std::size_t, std::size_t> get_line_info(std::size_t offset) const {
-        auto iter = std::lower_bound(line_offsets_.begin(), line_offsets_.end(), offset);
-        if (iter == line_offsets_.end())
-            return std::make_pair(0, 0);
+std::string_view
+normalize_node_name(file_line_mappings& file, std::string_view name, bool capital_first) {
+    // Most names are already normalized; in this case, point directly to the file content
+    const bool needs_capital =
+        capital_first && !name.empty() && std::islower(static_cast<unsigned char>(name[0]));
+    if (!needs_capital && name.find('_') == name.npos && file.contains(name))
+        return name;
 
-        std::size_t line_nbr    = iter - line_offsets_.begin();
-        std::size_t char_offset = offset - *iter + 1u;
-
-        return std::make_pair(line_nbr, char_offset);
-    }
-
-    std::string get_location(std::size_t offset) const {
-        auto location = get_line_info(offset);
-        if (location.first == 0)
-            return file_name_ + ":?";
-        else
-            return file_name_ + ":" + utils::to_string(location.first);
-    }
-
-private:
-    bool                     is_open_ = false;
-    std::string              file_name_;
-    std::string              file_content_;
-    std::vector<std::size_t> line_offsets_;
-};
-
-std::string normalize_node_name(const std::string& name, bool capital_first) {
     std::string normalized;
-    bool        next_capitalize = capital_first;
+    normalized.reserve(name.size());
+    bool next_capitalize = capital_first;
     for (auto c : name) {
         if (next_capitalize)
             c = std::toupper(c);
@@ -89,102 +46,140 @@ std::string normalize_node_name(const std::string& name, bool capital_first) {
         normalized.push_back(c);
     }
 
-    return normalized;
+    return file.store(std::move(normalized));
+}
+
+std::string_view view_or_store(file_line_mappings& file, std::string_view str) {
+    if (str.empty() || file.contains(str))
+        return str;
+
+    return file.store(std::string(str));
 }
 
 #if defined(LXGUI_ENABLE_XML_PARSER)
-void set_node(const file_line_mappings& file, layout_node& node, const pugi::xml_node& xml_node) {
-    auto location = file.get_location(xml_node.offset_debug());
-    node.set_location(location);
-    node.set_value_location(location);
-    node.set_name(normalize_node_name(xml_node.name(), true));
+void set_node(
+    file_line_mappings&   file,
+    layout_node&          node,
+    const pugi::xml_node& xml_node,
+    std::ostream&         log) {
+    const std::size_t offset = xml_node.offset_debug();
+    node.set_location(file, offset);
+    node.set_value_location(file, offset);
+    node.set_name_view(normalize_node_name(file, xml_node.name(), true));
+
+    std::size_t num_attributes = 0u;
+    for ([[maybe_unused]] const auto& attr : xml_node.attributes())
+        ++num_attributes;
+
+    std::size_t num_children = 0u;
+    for (const auto& elem_node : xml_node.children()) {
+        if (elem_node.type() != pugi::node_pcdata && elem_node.type() != pugi::node_cdata)
+            ++num_children;
+    }
+
+    node.reserve(num_children, num_attributes);
 
     for (const auto& attr : xml_node.attributes()) {
-        std::string name = normalize_node_name(attr.name(), false);
+        std::string_view name = normalize_node_name(file, attr.name(), false);
         if (const auto* node_attr = node.try_get_attribute(name)) {
-            gui::out << gui::warning << location << ": attribute '" << name
-                     << "' duplicated; only first value will be used." << std::endl;
+            log << gui::warning << file.get_location(offset) << ": attribute '" << name
+                << "' duplicated; only first value will be used." << std::endl;
             node_attr->mark_as_not_accessed();
             continue;
         }
 
         auto& attrib = node.add_attribute();
-        attrib.set_location(location);
-        attrib.set_value_location(location);
-        attrib.set_name(std::move(name));
-        attrib.set_value(attr.value());
+        attrib.set_location(file, offset);
+        attrib.set_value_location(file, offset);
+        attrib.set_name_view(name);
+        attrib.set_value_view(view_or_store(file, attr.value()));
     }
 
-    std::string value;
+    std::string_view value;
+    std::string      concatenated_value;
     for (const auto& elem_node : xml_node.children()) {
         if (elem_node.type() == pugi::node_pcdata || elem_node.type() == pugi::node_cdata) {
-            value += elem_node.value();
+            if (value.empty()) {
+                value = elem_node.value();
+            } else {
+                // Rare: the value is split in several blocks, which must be merged
+                if (concatenated_value.empty())
+                    concatenated_value = value;
+                concatenated_value += elem_node.value();
+            }
         } else {
             auto& child = node.add_child();
-            set_node(file, child, elem_node);
+            set_node(file, child, elem_node, log);
         }
     }
 
-    node.set_value(value);
+    if (!concatenated_value.empty())
+        node.set_value_view(file.store(std::move(concatenated_value)));
+    else
+        node.set_value_view(view_or_store(file, value));
 }
 #endif
 
 #if defined(LXGUI_ENABLE_YAML_PARSER)
-std::string to_string(const c4::csubstr& c_string) {
-    return std::string(c_string.data(), c_string.size());
+std::string_view to_string_view(const c4::csubstr& c_string) {
+    return std::string_view(c_string.data(), c_string.size());
 }
 
 void set_node(
-    const file_line_mappings& file,
+    file_line_mappings&       file,
     const ryml::Tree&         tree,
     layout_node&              node,
-    const ryml::ConstNodeRef& yaml_node) {
-    std::string location;
+    const ryml::ConstNodeRef& yaml_node,
+    std::ostream&             log) {
+    std::size_t offset = file_line_mappings::unknown_offset;
     if (yaml_node.has_key())
-        location = file.get_location(yaml_node.key().data() - tree.arena().data());
+        offset = file.get_offset(yaml_node.key().data());
     else if (yaml_node.has_val())
-        location = file.get_location(yaml_node.val().data() - tree.arena().data());
-    node.set_location(location);
-    node.set_value_location(location);
+        offset = file.get_offset(yaml_node.val().data());
+    node.set_location(file, offset);
+    node.set_value_location(file, offset);
 
-    if (yaml_node.has_key())
-        node.set_name(normalize_node_name(to_string(yaml_node.key()), true));
+    if (yaml_node.has_key()) {
+        node.set_name_view(normalize_node_name(file, to_string_view(yaml_node.key()), true));
+    }
+
+    node.reserve(yaml_node.num_children(), yaml_node.num_children());
 
     for (auto elem_node : yaml_node.children()) {
         switch (elem_node.type()) {
         case ryml::KEYVAL: {
-            std::string name = normalize_node_name(to_string(elem_node.key()), false);
-            std::string attr_location =
-                file.get_location(elem_node.key().data() - tree.arena().data());
+            std::string_view name =
+                normalize_node_name(file, to_string_view(elem_node.key()), false);
+            const std::size_t attr_offset = file.get_offset(elem_node.key().data());
             if (const auto* node_attr = node.try_get_attribute(name)) {
-                gui::out << gui::warning << attr_location << ": attribute '" << name
-                         << "' duplicated; only first value will be used." << std::endl;
-                gui::out << gui::warning << std::string(attr_location.size(), ' ')
-                         << "   first occurence at: '" << std::endl;
-                gui::out << gui::warning << std::string(attr_location.size(), ' ') << "   "
-                         << node_attr->get_location() << std::endl;
+                const std::string attr_location = file.get_location(attr_offset);
+                log << gui::warning << attr_location << ": attribute '" << name
+                    << "' duplicated; only first value will be used." << std::endl;
+                log << gui::warning << std::string(attr_location.size(), ' ')
+                    << "   first occurence at: '" << std::endl;
+                log << gui::warning << std::string(attr_location.size(), ' ') << "   "
+                    << node_attr->get_location() << std::endl;
                 node_attr->mark_as_not_accessed();
                 continue;
             }
 
             auto& attrib = node.add_attribute();
-            attrib.set_location(std::move(attr_location));
-            attrib.set_value_location(
-                file.get_location(elem_node.val().data() - tree.arena().data()));
-            attrib.set_name(std::move(name));
-            attrib.set_value(to_string(elem_node.val()));
+            attrib.set_location(file, attr_offset);
+            attrib.set_value_location(file, file.get_offset(elem_node.val().data()));
+            attrib.set_name_view(name);
+            attrib.set_value_view(view_or_store(file, to_string_view(elem_node.val())));
             break;
         }
         case ryml::KEYMAP: [[fallthrough]];
         case ryml::MAP: [[fallthrough]];
         case ryml::KEYSEQ: {
             auto& child = node.add_child();
-            set_node(file, tree, child, elem_node);
+            set_node(file, tree, child, elem_node, log);
             break;
         }
         default: {
-            gui::out << gui::warning << location << ": unsupported YAML node type: '"
-                     << elem_node.type_str() << "'." << std::endl;
+            log << gui::warning << file.get_location(offset) << ": unsupported YAML node type: '"
+                << elem_node.type_str() << "'." << std::endl;
             break;
         }
         }
@@ -192,15 +187,17 @@ void set_node(
 }
 #endif
 
-void addon_registry::parse_layout_file_(const std::string& file_name, const addon& add_on) {
-    file_line_mappings file(file_name);
-    if (!file.is_open()) {
-        gui::out << gui::error << file_name << ": could not open file for parsing." << std::endl;
-        return;
+std::optional<layout_node> parse_layout_node(const std::string& file_name, std::ostream& log) {
+    auto file = std::make_shared<file_line_mappings>(file_name);
+    if (!file->is_open()) {
+        log << gui::error << file_name << ": could not open file for parsing." << std::endl;
+        return std::nullopt;
     }
 
+    // Node names and values are views into the file content, which is parsed in place
     layout_node root;
-    bool        parsed = false;
+    root.set_file_owner(file);
+    bool parsed = false;
 
     const std::string extension = utils::get_file_extension(file_name);
 
@@ -208,17 +205,19 @@ void addon_registry::parse_layout_file_(const std::string& file_name, const addo
     if (extension == ".xml") {
         const unsigned int options = pugi::parse_ws_pcdata_single;
 
+        std::string& content = file->get_content();
+
         pugi::xml_document     doc;
         pugi::xml_parse_result result =
-            doc.load_buffer(file.get_content().c_str(), file.get_content().size(), options);
+            doc.load_buffer_inplace(content.data(), content.size(), options);
 
         if (!result) {
-            gui::out << gui::error << file.get_location(result.offset) << ": "
-                     << result.description() << std::endl;
-            return;
+            log << gui::error << file->get_location(result.offset) << ": " << result.description()
+                << std::endl;
+            return std::nullopt;
         }
 
-        set_node(file, root, doc.first_child());
+        set_node(*file, root, doc.first_child(), log);
         parsed = true;
     }
 #endif
@@ -226,32 +225,110 @@ void addon_registry::parse_layout_file_(const std::string& file_name, const addo
 #if defined(LXGUI_ENABLE_YAML_PARSER)
     if (extension == ".yml" || extension == ".yaml") {
         ryml::Tree tree;
-        ryml::parse_in_arena(ryml::to_csubstr(file.get_content()), &tree);
-        set_node(file, tree, root, tree.rootref().first_child());
+        ryml::parse_in_place(ryml::to_substr(file->get_content()), &tree);
+        set_node(*file, tree, root, tree.rootref().first_child(), log);
         parsed = true;
     }
 #endif
 
     if (!parsed) {
-        gui::out << gui::error << file_name
-                 << ": no parser registered for extension '" + extension + "'." << std::endl;
-        return;
+        log << gui::error << file_name
+            << ": no parser registered for extension '" + extension + "'." << std::endl;
+        return std::nullopt;
     }
 
+    return root;
+}
+
+struct addon_registry::parsed_layout_file {
+    std::optional<layout_node> root;
+    std::string                log;
+};
+
+addon_registry::~addon_registry() = default;
+
+void addon_registry::parse_layout_files_(
+    std::vector<std::pair<std::string, std::string>> file_list) {
+    // Each pass parses a list of files in parallel, then gathers the included files for
+    // the next pass. NB: this only reads files; nothing is instantiated here.
+    while (!file_list.empty()) {
+        std::vector<std::pair<std::string, std::string>> parse_list;
+        for (auto& file : file_list) {
+            if (parsed_layout_file_list_.find(file.first) != parsed_layout_file_list_.end())
+                continue;
+            if (utils::find_if(parse_list, [&](const auto& other) {
+                    return other.first == file.first;
+                }) != parse_list.end())
+                continue;
+
+            parse_list.push_back(std::move(file));
+        }
+
+        // NB: the files are read from the worker threads with utils::read_file(), which is safe
+        // to call from several threads at once, even if archives are mounted meanwhile
+        std::vector<std::unique_ptr<parsed_layout_file>> parsed_list(parse_list.size());
+        utils::parallel_for(parse_list.size(), [&](std::size_t i) {
+            auto               parsed = std::make_unique<parsed_layout_file>();
+            std::ostringstream log;
+            parsed->root   = parse_layout_node(parse_list[i].first, log);
+            parsed->log    = log.str();
+            parsed_list[i] = std::move(parsed);
+        });
+
+        file_list.clear();
+        for (std::size_t i = 0; i < parse_list.size(); ++i) {
+            const std::string& directory = parse_list[i].second;
+            if (parsed_list[i]->root) {
+                for (const auto& node : parsed_list[i]->root->get_children()) {
+                    if (node.get_name() != "Include")
+                        continue;
+
+                    if (auto file = node.try_get_attribute_value<std::string>("file"))
+                        file_list.emplace_back(directory + "/" + *file, directory);
+                }
+            }
+
+            parsed_layout_file_list_[parse_list[i].first] = std::move(parsed_list[i]);
+        }
+    }
+}
+
+void addon_registry::parse_layout_file_(const std::string& file_name, const addon& add_on) {
+    // Keep track of the frames created by this file, for reload_files()
+    const std::string loaded_name  = utils::normalize_path(file_name);
+    loaded_file_list_[loaded_name] = loaded_file{&add_on};
+
+    std::optional<layout_node> parsed_root;
+
+    // Use the file pre-parsed by parse_layout_files_() if any, else parse it now
+    auto iter = parsed_layout_file_list_.find(file_name);
+    if (iter != parsed_layout_file_list_.end()) {
+        gui::out << iter->second->log << std::flush;
+        parsed_root = std::move(iter->second->root);
+        parsed_layout_file_list_.erase(iter);
+    } else {
+        parsed_root = parse_layout_node(file_name, gui::out);
+    }
+
+    if (!parsed_root)
+        return;
+
+    const layout_node& root = *parsed_root;
+
     for (const auto& node : root.get_children()) {
         if (node.get_name() == "Script") {
             std::string script_file =
                 add_on.directory + "/" + node.get_attribute_value<std::string>("file");
 
-            auto result = lua_.do_file(script_file);
-            if (!result.valid()) {
-                std::string err = result.get<sol::error>().what();
-                gui::out << gui::error << err << std::endl;
-                event_emitter_.fire_event("LUA_ERROR", {err});
-            }
+            loaded_file_list_[utils::normalize_path(script_file)] = loaded_file{&add_on, true};
+            this->run_script_(script_file);
         } else if (node.get_name() == "Include") {
-            parse_layout_file_(
-                add_on.directory + "/" + node.get_attribute_value<std::string>("file"), add_on);
+            std::string include_file =
+                add_on.directory + "/" + node.get_attribute_value<std::string>("file");
+
+            parse_layout_file_(include_file, add_on);
+            loaded_file_list_[loaded_name].include_list.push_back(
+                utils::normalize_path(include_file));
         } else {
             try {
                 auto attr = frame_core_attributes{parse_core_attributes(
@@ -272,6 +349,11 @@ void addon_registry::parse_layout_file_(const std::string& file_name, const addo
                 if (!obj)
                     continue;
 
+                auto& loaded = loaded_file_list_[loaded_name];
+                loaded.frame_list.push_back(obj);
+                if (obj->is_virtual())
+                    loaded.has_virtual_frames = true;
+
                 obj->set_addon(&add_on);
                 obj->parse_layout(node);
                 obj->notify_loaded();
@@ -284,4 +366,38 @@ void addon_registry::parse_layout_file_(const std::string& file_name, const addo
     warn_for_not_accessed_node(root);
 }
 
+void addon_registry::unload_layout_file_(const std::string& file_name) {
+    auto iter = loaded_file_list_.find(file_name);
+    if (iter == loaded_file_list_.end())
+        return;
+
+    loaded_file loaded = std::move(iter->second);
+    loaded_file_list_.erase(iter);
+
+    // Frames may have been destroyed already, e.g., with their parent
+    for (const auto& obj : loaded.frame_list) {
+        if (obj)
+            obj->destroy();
+    }
+
+    for (const auto& include_file : loaded.include_list)
+        unload_layout_file_(include_file);
+}
+
+bool addon_registry::has_virtual_frames_(const std::string& file_name) const {
+    auto iter = loaded_file_list_.find(file_name);
+    if (iter == loaded_file_list_.end())
+        return false;
+
+    if (iter->second.has_virtual_frames)
+        return true;
+
+    for (const auto& include_file : iter->second.include_list) {
+        if (has_virtual_frames_(include_file))
+            return true;
+    }
+
+    return false;
+}
+
 } // namespace lxgui::gui
@@ -39,8 +39,7 @@ void animated_texture::render() const {
 
     if (alpha != 1.0f) {
         quad blended_quad = quad_;
-        for (std::size_t i = 0; i < 4; ++i)
-            blended_quad.v[i].col.a *= alpha;
+        multiply_vertices_alpha(blended_quad.v.data(), blended_quad.v.size(), alpha);
 
         renderer_.render_quad(blended_quad);
     } else {
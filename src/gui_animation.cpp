@@ -0,0 +1,255 @@
+#include "lxgui/gui_animation.hpp"
+
+#include "lxgui/gui_frame.hpp"
+#include "lxgui/gui_manager.hpp"
+#include "lxgui/gui_matrix4.hpp"
+#include "lxgui/gui_region.hpp"
+#include "lxgui/gui_root.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace lxgui::gui {
+
+namespace {
+
+constexpr float pi = 3.14159265358979f;
+
+float lerp(float from, float to, float t) noexcept {
+    return from + (to - from) * t;
+}
+
+} // namespace
+
+float apply_easing(easing curve, float t) noexcept {
+    switch (curve) {
+    case easing::linear: return t;
+    case easing::in_quad: return t * t;
+    case easing::out_quad: return t * (2.0f - t);
+    case easing::in_out_quad: return t < 0.5f ? 2.0f * t * t : -1.0f + (4.0f - 2.0f * t) * t;
+    case easing::in_cubic: return t * t * t;
+    case easing::out_cubic: {
+        const float u = t - 1.0f;
+        return u * u * u + 1.0f;
+    }
+    case easing::in_out_cubic: {
+        if (t < 0.5f)
+            return 4.0f * t * t * t;
+        const float u = 2.0f * t - 2.0f;
+        return 0.5f * u * u * u + 1.0f;
+    }
+    case easing::in_sine: return 1.0f - std::cos(t * pi / 2.0f);
+    case easing::out_sine: return std::sin(t * pi / 2.0f);
+    case easing::in_out_sine: return 0.5f * (1.0f - std::cos(t * pi));
+    }
+
+    return t;
+}
+
+float animation::get_end_time() const noexcept {
+    return start_delay + duration;
+}
+
+float animation::get_progress(float time) const noexcept {
+    if (time <= start_delay)
+        return apply_easing(curve, 0.0f);
+    if (duration <= 0.0f || time >= start_delay + duration)
+        return apply_easing(curve, 1.0f);
+
+    return apply_easing(curve, (time - start_delay) / duration);
+}
+
+animation_group::animation_group(utils::control_block& block, region& owner, std::string name) :
+    utils::enable_observer_from_this<animation_group>(block),
+    owner_(owner),
+    name_(std::move(name)) {}
+
+const std::string& animation_group::get_name() const {
+    return name_;
+}
+
+void animation_group::add_animation(const animation& anim) {
+    animation_list_.push_back(anim);
+    duration_ = std::max(duration_, anim.get_end_time());
+
+    switch (anim.type) {
+    case animation_type::alpha: has_alpha_ = true; break;
+    case animation_type::translation:
+    case animation_type::scale: has_transform_ = true; break;
+    case animation_type::color: has_color_ = true; break;
+    }
+}
+
+const std::vector<animation>& animation_group::get_animations() const {
+    return animation_list_;
+}
+
+void animation_group::clear_animations() {
+    stop();
+
+    animation_list_.clear();
+    duration_      = 0.0f;
+    has_alpha_     = false;
+    has_color_     = false;
+    has_transform_ = false;
+}
+
+void animation_group::set_looping(animation_loop looping) {
+    looping_ = looping;
+}
+
+animation_loop animation_group::get_looping() const {
+    return looping_;
+}
+
+void animation_group::set_auto_play(bool auto_play) {
+    auto_play_ = auto_play;
+}
+
+bool animation_group::is_auto_play() const {
+    return auto_play_;
+}
+
+float animation_group::get_duration() const {
+    return duration_;
+}
+
+void animation_group::play() {
+    if (owner_.is_virtual())
+        return;
+
+    if (is_playing_ && is_paused_) {
+        is_paused_ = false;
+    } else {
+        is_applied_ = true;
+        is_playing_ = true;
+        is_paused_  = false;
+        elapsed_    = 0.0f;
+        apply_(0.0f);
+    }
+
+    if (!is_registered_) {
+        owner_.get_manager().get_root().register_animation_group(observer_from_this());
+        is_registered_ = true;
+    }
+}
+
+void animation_group::pause() {
+    if (is_playing_)
+        is_paused_ = true;
+}
+
+void animation_group::stop() {
+    is_playing_ = false;
+    is_paused_  = false;
+    elapsed_    = 0.0f;
+
+    if (is_applied_)
+        restore_();
+}
+
+bool animation_group::is_playing() const {
+    return is_playing_;
+}
+
+bool animation_group::is_paused() const {
+    return is_paused_;
+}
+
+void animation_group::update(float delta) {
+    if (!is_playing_ || is_paused_)
+        return;
+
+    elapsed_ += delta;
+
+    if (duration_ <= 0.0f || looping_ == animation_loop::none) {
+        if (elapsed_ >= duration_) {
+            finish_();
+            return;
+        }
+
+        apply_(elapsed_);
+    } else if (looping_ == animation_loop::repeat) {
+        elapsed_ = std::fmod(elapsed_, duration_);
+        apply_(elapsed_);
+    } else {
+        elapsed_ = std::fmod(elapsed_, 2.0f * duration_);
+        apply_(elapsed_ <= duration_ ? elapsed_ : 2.0f * duration_ - elapsed_);
+    }
+}
+
+void animation_group::copy_from(const animation_group& other) {
+    clear_animations();
+
+    for (const auto& anim : other.animation_list_)
+        add_animation(anim);
+
+    looping_   = other.looping_;
+    auto_play_ = other.auto_play_;
+}
+
+void animation_group::apply_(float time) {
+    float                alpha  = 1.0f;
+    vector2f             offset = vector2f::zero;
+    vector2f             scale  = vector2f::unit;
+    std::optional<color> col;
+
+    for (const auto& anim : animation_list_) {
+        const float t = anim.get_progress(time);
+        switch (anim.type) {
+        case animation_type::alpha: alpha *= lerp(anim.from_alpha, anim.to_alpha, t); break;
+        case animation_type::translation: offset += anim.offset * t; break;
+        case animation_type::scale:
+            scale.x *= lerp(anim.from_scale.x, anim.to_scale.x, t);
+            scale.y *= lerp(anim.from_scale.y, anim.to_scale.y, t);
+            break;
+        case animation_type::color:
+            col = color(
+                lerp(anim.from_color.r, anim.to_color.r, t),
+                lerp(anim.from_color.g, anim.to_color.g, t),
+                lerp(anim.from_color.b, anim.to_color.b, t),
+                lerp(anim.from_color.a, anim.to_color.a, t));
+            break;
+        }
+    }
+
+    alpha_ = alpha;
+    color_ = col;
+
+    if (has_transform_) {
+        // Scale around the center of the region, then move
+        const vector2f center = owner_.get_borders().center();
+        transform_            = matrix4f::translation(-center) * matrix4f::scaling(scale) *
+                     matrix4f::translation(center + offset);
+    }
+
+    // Other groups may be animating the same region: let it combine all of them
+    owner_.apply_animation_groups_();
+}
+
+void animation_group::restore_() {
+    is_applied_ = false;
+    owner_.apply_animation_groups_();
+}
+
+void animation_group::finish_() {
+    apply_(duration_);
+
+    is_playing_ = false;
+
+    // Callbacks may destroy the owner region, and this group with it
+    auto self = observer_from_this();
+
+    on_finished();
+    if (!self)
+        return;
+
+    frame* target = down_cast<frame>(&owner_);
+    if (!target)
+        target = owner_.get_parent().get();
+
+    if (target)
+        target->fire_script("OnAnimationFinished", {name_, owner_.get_name()});
+}
+
+} // namespace lxgui::gui
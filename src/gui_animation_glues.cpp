@@ -0,0 +1,142 @@
+#include "lxgui/gui_animation.hpp"
+#include "lxgui/gui_out.hpp"
+#include "lxgui/gui_region.hpp"
+#include "lxgui/gui_region_tpl.hpp"
+#include "lxgui/utils_string.hpp"
+
+#include <lxgui/extern_sol2_state.hpp>
+
+/** A set of animations played together on a @{Region}.
+ * Animation groups are created with @{Region:create_animation_group}, or in
+ * layout files with an `Animations` block. They can contain alpha, translation,
+ * scale, and color animations, each with their own duration, start delay, and
+ * easing curve. All the animations of a group start when the group is played.
+ *
+ * Animations are updated automatically by the GUI on each update, which is
+ * much faster than modifying the region from an `OnUpdate` script. Translation
+ * and scale animations are applied when rendering, and do not change the anchors
+ * of the region: the region still reacts to the mouse at its original position.
+ *
+ * When a group reaches its end without looping, the `OnAnimationFinished` script
+ * of the animated @{Frame} (or of the parent @{Frame} of the animated
+ * @{LayeredRegion}) is triggered.
+ *
+ * Inherits all methods from: none.
+ *
+ * Child classes: none.
+ * @classmod AnimationGroup
+ */
+
+namespace lxgui::gui {
+
+void animation_group::register_on_lua(sol::state& lua) {
+    auto type = lua.new_usertype<animation_group>(animation_group::class_name, sol::no_constructor);
+
+    /** Adds a new animation to this group.
+     * The animation is described by a table, with the following fields:
+     * `type` (one of `"alpha"`, `"translation"`, `"scale"`, `"color"`),
+     * `duration`, `start_delay`, and `easing` (e.g., `"linear"`, `"in_out_quad"`).
+     * Alpha animations use `from` and `to` (numbers), translation animations use
+     * `offset_x` and `offset_y`, scale animations use `from_x`, `from_y`, `to_x`,
+     * and `to_y`, and color animations use `from` and `to` (color strings, e.g.,
+     * `"#FF0000"`).
+     * @function add_animation
+     * @tparam table animation The animation description
+     */
+    type.set_function("add_animation", [](animation_group& self, sol::table desc) {
+        const std::string type_name = desc.get_or<std::string>("type", "alpha");
+        const auto        anim_type = utils::from_string<animation_type>(type_name);
+        if (!anim_type.has_value()) {
+            gui::out << gui::warning << "AnimationGroup:add_animation: "
+                     << "Unknown animation type: \"" << type_name << "\"." << std::endl;
+            return;
+        }
+
+        animation anim;
+        anim.type        = anim_type.value();
+        anim.duration    = desc.get_or("duration", 0.0f);
+        anim.start_delay = desc.get_or("start_delay", 0.0f);
+
+        if (const auto curve_name = desc.get<sol::optional<std::string>>("easing")) {
+            const auto curve = utils::from_string<easing>(curve_name.value());
+            if (!curve.has_value()) {
+                gui::out << gui::warning << "AnimationGroup:add_animation: "
+                         << "Unknown easing curve: \"" << curve_name.value() << "\"." << std::endl;
+                return;
+            }
+
+            anim.curve = curve.value();
+        }
+
+        switch (anim.type) {
+        case animation_type::alpha:
+            anim.from_alpha = desc.get_or("from", 1.0f);
+            anim.to_alpha   = desc.get_or("to", 1.0f);
+            break;
+        case animation_type::translation:
+            anim.offset = vector2f(desc.get_or("offset_x", 0.0f), desc.get_or("offset_y", 0.0f));
+            break;
+        case animation_type::scale:
+            anim.from_scale = vector2f(desc.get_or("from_x", 1.0f), desc.get_or("from_y", 1.0f));
+            anim.to_scale   = vector2f(desc.get_or("to_x", 1.0f), desc.get_or("to_y", 1.0f));
+            break;
+        case animation_type::color:
+            anim.from_color = color(desc.get_or<std::string>("from", "#FFFFFF"));
+            anim.to_color   = color(desc.get_or<std::string>("to", "#FFFFFF"));
+            break;
+        }
+
+        self.add_animation(anim);
+    });
+
+    /** @function clear_animations
+     */
+    type.set_function("clear_animations", member_function<&animation_group::clear_animations>());
+
+    /** @function get_duration
+     */
+    type.set_function("get_duration", member_function<&animation_group::get_duration>());
+
+    /** @function get_looping
+     */
+    type.set_function("get_looping", [](const animation_group& self) {
+        return utils::to_string(self.get_looping());
+    });
+
+    /** @function get_name
+     */
+    type.set_function("get_name", member_function<&animation_group::get_name>());
+
+    /** @function is_paused
+     */
+    type.set_function("is_paused", member_function<&animation_group::is_paused>());
+
+    /** @function is_playing
+     */
+    type.set_function("is_playing", member_function<&animation_group::is_playing>());
+
+    /** @function pause
+     */
+    type.set_function("pause", member_function<&animation_group::pause>());
+
+    /** @function play
+     */
+    type.set_function("play", member_function<&animation_group::play>());
+
+    /** @function set_looping
+     */
+    type.set_function("set_looping", [](animation_group& self, const std::string& looping_name) {
+        if (const auto looping = utils::from_string<animation_loop>(looping_name)) {
+            self.set_looping(looping.value());
+        } else {
+            gui::out << gui::warning << "AnimationGroup:set_looping: "
+                     << "Unknown looping mode: \"" << looping_name << "\"." << std::endl;
+        }
+    });
+
+    /** @function stop
+     */
+    type.set_function("stop", member_function<&animation_group::stop>());
+}
+
+} // namespace lxgui::gui
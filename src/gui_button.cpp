@@ -203,6 +203,18 @@ void button::copy_from(const region& obj) {
         this->disable();
 }
 
+void button::recycle_(const frame& default_frame) {
+    // Not reset by copy_from(), which only disables the button if needed
+    state_               = state::up;
+    is_highlighted_      = false;
+    is_highlight_locked_ = false;
+
+    if (const button* button_obj = down_cast<button>(&default_frame))
+        reg_click_list_ = button_obj->reg_click_list_;
+
+    base::recycle_(default_frame);
+}
+
 void button::set_text(const utils::ustring& content) {
     content_ = content;
 
@@ -57,6 +57,12 @@ void check_button::copy_from(const region& obj) {
     }
 }
 
+void check_button::recycle_(const frame& default_frame) {
+    is_checked_ = false;
+
+    base::recycle_(default_frame);
+}
+
 void check_button::check() {
     if (is_checked_)
         return;
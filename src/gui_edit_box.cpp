@@ -13,6 +13,8 @@
 
 #include <lxgui/extern_sol2_state.hpp>
 
+#include <algorithm>
+
 using namespace lxgui::input;
 
 namespace lxgui::gui {
@@ -70,6 +72,26 @@ void edit_box::copy_from(const region& obj) {
     }
 }
 
+void edit_box::recycle_(const frame& default_frame) {
+    // Reset the text directly, since scripts must not be called
+    unicode_text_.clear();
+    displayed_text_.clear();
+    line_break_list_.clear();
+    iter_carret_pos_ = unicode_text_.begin();
+    display_pos_     = 0u;
+    num_letters_     = 0u;
+
+    is_text_selected_    = false;
+    selection_start_pos_ = 0u;
+    selection_end_pos_   = 0u;
+
+    history_line_list_.clear();
+    current_history_line_ = std::numeric_limits<std::size_t>::max();
+    are_arrows_ignored_   = false;
+
+    base::recycle_(default_frame);
+}
+
 void edit_box::update_(float delta) {
     alive_checker checker(*this);
 
@@ -318,11 +340,11 @@ void edit_box::insert_after_cursor(const utils::ustring& content) {
 
     if (unicode_text_.size() + content.size() <= max_letters_) {
         unlight_text();
+        const std::size_t pos = iter_carret_pos_ - unicode_text_.begin();
         unicode_text_.insert(iter_carret_pos_, content.begin(), content.end());
-        iter_carret_pos_ += content.size();
+        iter_carret_pos_ = unicode_text_.begin() + pos + content.size();
 
-        update_displayed_text_();
-        update_font_string_();
+        replace_displayed_text_(pos, 0u, content);
         update_carret_position_();
 
         alive_checker checker(*this);
@@ -796,6 +818,55 @@ void edit_box::update_displayed_text_() {
         // TODO: implement for multiline edit box
         // https://github.com/cschreib/lxgui/issues/39
     }
+
+    // Keep track of the line breaks, so the carret can be placed without counting them
+    line_break_list_.clear();
+    for (std::size_t i = 0; i < displayed_text_.size(); ++i) {
+        if (displayed_text_[i] == U'\n')
+            line_break_list_.push_back(i);
+    }
+}
+
+void edit_box::replace_displayed_text_(
+    std::size_t pos, std::size_t count, const utils::ustring& content) {
+    if (!font_string_ || !font_string_->get_text_object())
+        return;
+
+    // Single line edit boxes only display the part of the text which fits in the box, which
+    // must be found again; multi-line edit boxes display the whole text, and only the edited
+    // part needs updating
+    if (!is_multi_line_ ||
+        displayed_text_.size() + content.size() != unicode_text_.size() + count) {
+        update_displayed_text_();
+        update_font_string_();
+        return;
+    }
+
+    const utils::ustring displayed_content =
+        is_password_mode_ ? utils::ustring(content.size(), U'*') : content;
+
+    displayed_text_.replace(pos, count, displayed_content);
+
+    // Shift the line breaks after the edit, and add the inserted ones
+    auto iter_first = std::lower_bound(line_break_list_.begin(), line_break_list_.end(), pos);
+    auto iter_last  = std::lower_bound(iter_first, line_break_list_.end(), pos + count);
+    for (auto iter = iter_last; iter != line_break_list_.end(); ++iter)
+        *iter = *iter + displayed_content.size() - count;
+
+    iter_first = line_break_list_.erase(iter_first, iter_last);
+
+    std::vector<std::size_t> inserted_list;
+    for (std::size_t i = 0; i < displayed_content.size(); ++i) {
+        if (displayed_content[i] == U'\n')
+            inserted_list.push_back(pos + i);
+    }
+
+    line_break_list_.insert(iter_first, inserted_list.begin(), inserted_list.end());
+
+    font_string_->replace_text(pos, count, displayed_content);
+
+    if (is_text_selected_)
+        highlight_text(selection_start_pos_, selection_end_pos_, true);
 }
 
 void edit_box::update_font_string_() {
@@ -886,21 +957,26 @@ void edit_box::update_carret_position_() {
                 displayed_text_.begin() + (iter_carret_pos_ - unicode_text_.begin()) - display_pos_;
         }
 
-        float y_offset = static_cast<float>((text->get_line_count() - 1)) *
-                         (text->get_line_height() * text->get_line_spacing());
-
         std::size_t index = iter_display_carret - displayed_text_.begin();
 
-        float x_offset = text_insets_.left;
-        if (index < displayed_text_.size()) {
-            if (index < text->get_letter_count())
-                x_offset += text->get_letter_quad(index)[0].pos.x;
+        float       x_offset = text_insets_.left;
+        std::size_t line     = text->get_line_count() - 1;
+        if (!is_multi_line_) {
+            if (index < displayed_text_.size()) {
+                if (index < text->get_letter_count())
+                    x_offset += text->get_letter_quad(index)[0].pos.x;
+            } else {
+                index = displayed_text_.size() - 1;
+                if (index < text->get_letter_count())
+                    x_offset += text->get_letter_quad(index)[2].pos.x;
+            }
         } else {
-            index = displayed_text_.size() - 1;
-            if (index < text->get_letter_count())
-                x_offset += text->get_letter_quad(index)[2].pos.x;
+            get_multi_line_carret_position_(index, x_offset, line);
         }
 
+        float y_offset = static_cast<float>(line) *
+                         (text->get_line_height() * text->get_line_spacing());
+
         carret_->set_anchor(point::center, point::left, vector2f(x_offset, y_offset));
     }
 
@@ -911,6 +987,51 @@ void edit_box::update_carret_position_() {
         carret_->hide();
 }
 
+void edit_box::get_multi_line_carret_position_(
+    std::size_t index, float& x_offset, std::size_t& line) const {
+    const text* text = font_string_->get_text_object();
+
+    // Line breaks do not have a letter quad in the text object; their positions are sorted,
+    // so the number of breaks before the carret is found with a binary search
+    const std::size_t num_letters = text->get_letter_count();
+    const auto        iter_break =
+        std::lower_bound(line_break_list_.begin(), line_break_list_.end(), index);
+    const std::size_t num_breaks_before =
+        static_cast<std::size_t>(iter_break - line_break_list_.begin());
+    const std::size_t letter_index = index - num_breaks_before;
+
+    const bool is_before_break = iter_break != line_break_list_.end() && *iter_break == index;
+    const bool is_after_break  = num_breaks_before != 0u && *(iter_break - 1) == index - 1u;
+
+    if (index < displayed_text_.size() && !is_before_break) {
+        // Carret is before a letter
+        if (letter_index < num_letters) {
+            x_offset += text->get_letter_quad(letter_index)[0].pos.x;
+            line = text->get_letter_line(letter_index);
+        }
+    } else if (index != 0u && !is_after_break) {
+        // Carret is at the end of a line, after a letter
+        if (letter_index - 1 < num_letters) {
+            x_offset += text->get_letter_quad(letter_index - 1)[2].pos.x;
+            line = text->get_letter_line(letter_index - 1);
+        }
+    } else {
+        // Carret is on an empty line; find the line of the next letter, and go back up by
+        // the number of empty lines in between
+        std::size_t num_breaks = 0u;
+        for (auto iter = iter_break;
+             iter != line_break_list_.end() && *iter == index + num_breaks; ++iter) {
+            ++num_breaks;
+        }
+
+        const std::size_t next_line = letter_index < num_letters
+                                          ? text->get_letter_line(letter_index)
+                                          : text->get_line_count() - 1;
+
+        line = next_line >= num_breaks ? next_line - num_breaks : 0u;
+    }
+}
+
 bool edit_box::add_char_(char32_t c) {
     if (is_text_selected_)
         remove_char_();
@@ -920,8 +1041,8 @@ bool edit_box::add_char_(char32_t c) {
 
     iter_carret_pos_ = unicode_text_.insert(iter_carret_pos_, c) + 1;
 
-    update_displayed_text_();
-    update_font_string_();
+    const std::size_t pos = iter_carret_pos_ - unicode_text_.begin() - 1u;
+    replace_displayed_text_(pos, 0u, utils::ustring(1u, c));
     update_carret_position_();
 
     if (carret_)
@@ -933,6 +1054,8 @@ bool edit_box::add_char_(char32_t c) {
 }
 
 bool edit_box::remove_char_() {
+    std::size_t pos   = iter_carret_pos_ - unicode_text_.begin();
+    std::size_t count = 0u;
     if (is_text_selected_) {
         if (selection_start_pos_ != selection_end_pos_) {
             std::size_t left  = std::min(selection_start_pos_, selection_end_pos_);
@@ -941,6 +1064,8 @@ bool edit_box::remove_char_() {
             unicode_text_.erase(left, right - left);
 
             iter_carret_pos_ = unicode_text_.begin() + left;
+            pos              = left;
+            count            = right - left;
         }
 
         unlight_text();
@@ -949,10 +1074,10 @@ bool edit_box::remove_char_() {
             return false;
 
         iter_carret_pos_ = unicode_text_.erase(iter_carret_pos_);
+        count            = 1u;
     }
 
-    update_displayed_text_();
-    update_font_string_();
+    replace_displayed_text_(pos, count, {});
     update_carret_position_();
 
     if (carret_)
@@ -29,4 +29,8 @@ void event_receiver::unregister_event(const std::string& event_name) {
     registered_events_.erase(iter);
 }
 
+void event_receiver::unregister_all_events() {
+    registered_events_.clear();
+}
+
 } // namespace lxgui::gui
@@ -6,6 +6,10 @@
 #include "lxgui/gui_manager.hpp"
 #include "lxgui/gui_out.hpp"
 #include "lxgui/gui_registry.hpp"
+#include "lxgui/gui_virtual_registry.hpp"
+#include "lxgui/gui_virtual_root.hpp"
+
+#include <algorithm>
 
 namespace lxgui::gui {
 
@@ -26,6 +30,8 @@ utils::owner_ptr<region> factory::create_region(registry& reg, const region_core
     if (!new_object)
         return nullptr;
 
+    notify_created_(allocation_stats_.regions);
+
     if (!finalize_object_(reg, *new_object, attr))
         return nullptr;
 
@@ -47,6 +53,9 @@ utils::owner_ptr<frame> factory::create_frame(registry& reg, const frame_core_at
     if (!new_frame)
         return nullptr;
 
+    notify_created_(allocation_stats_.regions);
+    notify_created_(allocation_stats_.frames);
+
     if (!finalize_object_(reg, *new_frame, attr))
         return nullptr;
 
@@ -69,6 +78,9 @@ factory::create_layered_region(registry& reg, const region_core_attributes& attr
     if (!new_region)
         return nullptr;
 
+    notify_created_(allocation_stats_.regions);
+    notify_created_(allocation_stats_.layered_regions);
+
     if (!finalize_object_(reg, *new_region, attr))
         return nullptr;
 
@@ -80,6 +92,37 @@ void factory::register_on_lua(sol::state& lua) {
         reg.second(lua);
 }
 
+const factory::allocation_stats& factory::get_allocation_stats() const {
+    return allocation_stats_;
+}
+
+void factory::reset_allocation_stats() {
+    for (auto* counter :
+         {&allocation_stats_.regions, &allocation_stats_.frames,
+          &allocation_stats_.layered_regions}) {
+        counter->created   = counter->get_live_count();
+        counter->destroyed = 0u;
+        counter->peak      = counter->created;
+    }
+}
+
+void factory::notify_region_destroyed(const region&) {
+    ++allocation_stats_.regions.destroyed;
+}
+
+void factory::notify_frame_destroyed(const frame&) {
+    ++allocation_stats_.frames.destroyed;
+}
+
+void factory::notify_layered_region_destroyed(const layered_region&) {
+    ++allocation_stats_.layered_regions.destroyed;
+}
+
+void factory::notify_created_(allocation_counter& counter) {
+    ++counter.created;
+    counter.peak = std::max(counter.peak, counter.get_live_count());
+}
+
 bool factory::finalize_object_(registry& reg, region& object, const region_core_attributes& attr) {
     if (!object.is_virtual() || attr.parent == nullptr) {
         if (!reg.add_region(observer_from(&object)))
@@ -94,6 +137,9 @@ bool factory::finalize_object_(registry& reg, region& object, const region_core_
 }
 
 void factory::apply_inheritance_(region& object, const region_core_attributes& attr) {
+    std::vector<utils::observer_ptr<const region>> base_list;
+    base_list.reserve(attr.inheritance.size());
+
     for (const auto& base : attr.inheritance) {
         if (!object.is_region_type(*base)) {
             gui::out << gui::warning << "gui::factory: "
@@ -103,9 +149,63 @@ void factory::apply_inheritance_(region& object, const region_core_attributes& a
             continue;
         }
 
-        // Inherit from the other object
+        base_list.push_back(base);
+    }
+
+    // Frames inheriting from several templates copy a single flattened template instead,
+    // which already contains the result of copying all the templates in order. A single
+    // template is already flat: it is its own plan, and is copied directly below.
+    if (base_list.size() > 1u && object.is_region_type<frame>()) {
+        if (auto flattened = get_flattened_template_(object.get_region_type(), base_list)) {
+            object.copy_from(*flattened);
+            return;
+        }
+    }
+
+    // Inherit from the other objects
+    for (const auto& base : base_list)
         object.copy_from(*base);
+}
+
+utils::observer_ptr<const frame> factory::get_flattened_template_(
+    const std::string&                                    object_type,
+    const std::vector<utils::observer_ptr<const region>>& base_list) {
+    std::string key = object_type;
+    for (const auto& base : base_list) {
+        // Templates still being loaded can change, so they cannot be flattened yet
+        if (!base->is_loaded())
+            return nullptr;
+
+        key += ',';
+        key += base->get_name();
     }
+
+    auto& vroot = manager_.get_virtual_root();
+    auto& vreg  = vroot.get_registry();
+    if (auto flattened = vreg.get_flattened_template(key))
+        return flattened;
+
+    // Destroy the templates flattened from bases which no longer exist, including the previous
+    // template for this key, if any
+    for (const auto& outdated : vreg.remove_outdated_flattened_templates())
+        vroot.remove_root_frame(outdated);
+
+    frame_core_attributes attr;
+    attr.object_type = object_type;
+    attr.name        = "$FlattenedTemplate" + std::to_string(++num_flattened_templates_);
+    attr.is_virtual  = true;
+
+    auto flattened = vroot.create_root_frame(std::move(attr));
+    if (!flattened)
+        return nullptr;
+
+    for (const auto& base : base_list)
+        flattened->copy_from(*base);
+
+    flattened->notify_loaded();
+
+    vreg.set_flattened_template(std::move(key), flattened, base_list);
+    return flattened;
 }
 
 } // namespace lxgui::gui
@@ -0,0 +1,149 @@
+#include "lxgui/gui_font.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace lxgui::gui {
+
+namespace {
+
+struct distance_offset {
+    int dx = 0;
+    int dy = 0;
+
+    int squared_length() const noexcept {
+        return dx * dx + dy * dy;
+    }
+};
+
+constexpr distance_offset far_offset = {9999, 9999};
+
+void propagate_distances(std::vector<distance_offset>& grid, int width, int height) {
+    auto compare = [&](distance_offset& current, int x, int y, int ox, int oy) {
+        const int nx = x + ox;
+        const int ny = y + oy;
+        if (nx < 0 || ny < 0 || nx >= width || ny >= height)
+            return;
+
+        distance_offset other = grid[ny * width + nx];
+        other.dx += ox;
+        other.dy += oy;
+
+        if (other.squared_length() < current.squared_length())
+            current = other;
+    };
+
+    // Forward pass
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            distance_offset& current = grid[y * width + x];
+            compare(current, x, y, -1, 0);
+            compare(current, x, y, 0, -1);
+            compare(current, x, y, -1, -1);
+            compare(current, x, y, 1, -1);
+        }
+
+        for (int x = width - 1; x >= 0; --x) {
+            compare(grid[y * width + x], x, y, 1, 0);
+        }
+    }
+
+    // Backward pass
+    for (int y = height - 1; y >= 0; --y) {
+        for (int x = width - 1; x >= 0; --x) {
+            distance_offset& current = grid[y * width + x];
+            compare(current, x, y, 1, 0);
+            compare(current, x, y, 0, 1);
+            compare(current, x, y, -1, 1);
+            compare(current, x, y, 1, 1);
+        }
+
+        for (int x = 0; x < width; ++x) {
+            compare(grid[y * width + x], x, y, -1, 0);
+        }
+    }
+}
+
+float edge_distance(const distance_offset& offset) noexcept {
+    const int squared_length = offset.squared_length();
+    if (squared_length == 0)
+        return 0.0f;
+
+    return std::sqrt(static_cast<float>(squared_length)) - 0.5f;
+}
+
+std::uint64_t make_kerning_pair(char32_t c1, char32_t c2) noexcept {
+    return (static_cast<std::uint64_t>(c1) << 32u) | static_cast<std::uint64_t>(c2);
+}
+
+} // namespace
+
+kerning_table::kerning_table(function_type function) : function_(std::move(function)) {}
+
+float kerning_table::get(char32_t c1, char32_t c2) const {
+    if (!function_)
+        return 0.0f;
+
+    const std::uint64_t pair = make_kerning_pair(c1, c2);
+
+    auto iter = cache_.find(pair);
+    if (iter == cache_.end())
+        iter = cache_.emplace(pair, function_(c1, c2)).first;
+
+    return iter->second;
+}
+
+std::size_t kerning_table::get_pair_count() const noexcept {
+    return cache_.size();
+}
+
+std::vector<std::uint8_t> make_distance_field(
+    const std::uint8_t* coverage,
+    std::size_t         width,
+    std::size_t         height,
+    std::size_t         pitch,
+    std::size_t         spread) {
+
+    const int field_width  = static_cast<int>(width + 2 * spread);
+    const int field_height = static_cast<int>(height + 2 * spread);
+    const int padding      = static_cast<int>(spread);
+
+    auto is_inside = [&](int x, int y) {
+        x -= padding;
+        y -= padding;
+        if (x < 0 || y < 0 || x >= static_cast<int>(width) || y >= static_cast<int>(height))
+            return false;
+
+        return coverage[static_cast<std::size_t>(y) * pitch + static_cast<std::size_t>(x)] >=
+               128u;
+    };
+
+    // Distance to the closest pixel inside the glyph, and outside the glyph
+    std::vector<distance_offset> to_inside(field_width * field_height);
+    std::vector<distance_offset> to_outside(field_width * field_height);
+    for (int y = 0; y < field_height; ++y) {
+        for (int x = 0; x < field_width; ++x) {
+            const bool inside               = is_inside(x, y);
+            to_inside[y * field_width + x]  = inside ? distance_offset{} : far_offset;
+            to_outside[y * field_width + x] = inside ? far_offset : distance_offset{};
+        }
+    }
+
+    propagate_distances(to_inside, field_width, field_height);
+    propagate_distances(to_outside, field_width, field_height);
+
+    std::vector<std::uint8_t> field(to_inside.size());
+    const float               scale = 0.5f / static_cast<float>(std::max<std::size_t>(spread, 1u));
+    for (std::size_t i = 0; i < field.size(); ++i) {
+        // Positive outside the glyph, negative inside. Distances are measured between pixel
+        // centers, and the edge lies half a pixel away from the center of the closest pixel.
+        const float distance = edge_distance(to_inside[i]) - edge_distance(to_outside[i]);
+
+        const float value = std::clamp(0.5f - distance * scale, 0.0f, 1.0f);
+        field[i]          = static_cast<std::uint8_t>(std::round(value * 255.0f));
+    }
+
+    return field;
+}
+
+} // namespace lxgui::gui
@@ -7,6 +7,7 @@
 #include "lxgui/gui_region_tpl.hpp"
 #include "lxgui/gui_renderer.hpp"
 
+#include <algorithm>
 #include <sstream>
 
 namespace lxgui::gui {
@@ -194,18 +195,31 @@ void font_string::create_text_object_() {
     const auto&    code_points        = localizer.get_allowed_code_points();
     const char32_t default_code_point = localizer.get_fallback_code_point();
 
-    std::shared_ptr<gui::font> outline_font;
-    if (is_outlined_) {
-        outline_font = renderer.create_atlas_font(
-            "GUI", font_name_, pixel_height,
-            std::min<std::size_t>(2u, static_cast<std::size_t>(std::round(0.2 * pixel_height))),
-            code_points, default_code_point);
-    }
+    const std::size_t outline_thickness =
+        std::min<std::size_t>(2u, static_cast<std::size_t>(std::round(0.2 * pixel_height)));
+
+    if (renderer.is_distance_field_font_enabled()) {
+        // A single font for all sizes and outlines: changing the interface scaling factor
+        // does not require rasterizing the font again
+        auto fnt = renderer.create_distance_field_font(font_name_, code_points, default_code_point);
+
+        text_ = std::unique_ptr<text>(new text(renderer, fnt));
+        text_->set_font_size(static_cast<float>(pixel_height));
+        if (is_outlined_)
+            text_->set_outline_thickness(static_cast<float>(outline_thickness));
+    } else {
+        std::shared_ptr<gui::font> outline_font;
+        if (is_outlined_) {
+            outline_font = renderer.create_atlas_font(
+                "GUI", font_name_, pixel_height, outline_thickness, code_points,
+                default_code_point);
+        }
 
-    auto fnt = renderer.create_atlas_font(
-        "GUI", font_name_, pixel_height, 0u, code_points, default_code_point);
+        auto fnt = renderer.create_atlas_font(
+            "GUI", font_name_, pixel_height, 0u, code_points, default_code_point);
 
-    text_ = std::unique_ptr<text>(new text(renderer, fnt, outline_font));
+        text_ = std::unique_ptr<text>(new text(renderer, fnt, outline_font));
+    }
 
     text_->set_scaling_factor(1.0f / get_manager().get_interface_scaling_factor());
     text_->set_remove_starting_spaces(true);
@@ -435,6 +449,23 @@ void font_string::set_text(const utils::ustring& content) {
     }
 }
 
+void font_string::replace_text(std::size_t pos, std::size_t count, const utils::ustring& content) {
+    pos   = std::min(pos, content_.size());
+    count = std::min(count, content_.size() - pos);
+    if (count == 0u && content.empty())
+        return;
+
+    content_.replace(pos, count, content);
+
+    if (text_) {
+        text_->replace_text(pos, count, content);
+        if (!is_virtual_) {
+            notify_borders_need_update();
+            notify_renderer_need_redraw();
+        }
+    }
+}
+
 bool font_string::is_vertex_cache_used_() const {
     auto& renderer = get_manager().get_renderer();
     switch (vertex_cache_strategy_) {
@@ -463,6 +494,14 @@ const text* font_string::get_text_object() const {
     return text_.get();
 }
 
+std::optional<color> font_string::get_animation_color_() const {
+    return text_color_;
+}
+
+void font_string::set_animation_color_(const color& c) {
+    set_text_color(c);
+}
+
 void font_string::update_borders_() {
     if (!text_)
         return base::update_borders_();
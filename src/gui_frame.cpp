@@ -10,10 +10,12 @@
 #include "lxgui/gui_manager.hpp"
 #include "lxgui/gui_out.hpp"
 #include "lxgui/gui_region_tpl.hpp"
+#include "lxgui/gui_renderer.hpp"
 #include "lxgui/utils_range.hpp"
 #include "lxgui/utils_std.hpp"
 #include "lxgui/utils_string.hpp"
 
+#include <algorithm>
 #include <functional>
 #include <lxgui/extern_sol2_as_args.hpp>
 #include <lxgui/extern_sol2_state.hpp>
@@ -23,7 +25,10 @@
 namespace lxgui::gui {
 
 frame::frame(utils::control_block& block, manager& mgr, const frame_core_attributes& attr) :
-    base(block, mgr, attr), event_receiver_(mgr.get_event_emitter()), frame_renderer_(attr.rdr) {
+    base(block, mgr, attr),
+    event_receiver_(mgr.get_event_emitter()),
+    frame_renderer_(attr.rdr),
+    renderer_(mgr.get_renderer()) {
 
     initialize_(*this, attr);
 
@@ -57,6 +62,8 @@ frame::~frame() {
     get_manager().get_root().notify_hovered_frame_dirty();
 
     set_focus(false);
+
+    get_manager().get_factory().notify_frame_destroyed(*this);
 }
 
 void frame::render() const {
@@ -65,6 +72,18 @@ void frame::render() const {
     if (!is_visible() || !is_valid_)
         return;
 
+    if (render_cache_ && render_cache_->is_cached()) {
+        render_cache_->render_cache();
+        return;
+    }
+
+    render_content_();
+
+    if (render_cache_)
+        render_cache_->render_frames();
+}
+
+void frame::render_content_() const {
     if (backdrop_) {
         backdrop_->render();
     }
@@ -76,7 +95,24 @@ void frame::render() const {
         }
 
         for (const auto& reg : layer.region_list) {
-            reg->render();
+            const auto& transform = reg->get_animation_transform();
+
+            // Skip regions which would not be visible
+            if (reg->is_visible() && reg->is_valid() &&
+                (reg->get_effective_alpha() <= 0.0f ||
+                 (!transform.has_value() && !renderer_.is_in_view(reg->get_borders())))) {
+                renderer_.notify_culled_region();
+                continue;
+            }
+
+            if (transform.has_value()) {
+                const matrix4f view = renderer_.get_view();
+                renderer_.set_view(transform.value() * view);
+                reg->render();
+                renderer_.set_view(view);
+            } else {
+                reg->render();
+            }
         }
     }
 }
@@ -124,6 +160,7 @@ std::string frame::serialize(const std::string& tab) const {
     str << tab << "  # Max height : " << max_height_ << "\n";
     str << tab << "  # Scale      : " << scale_ << "\n";
     str << tab << "  # Update rate : " << update_rate_ << "\n";
+    str << tab << "  # Render cache: " << is_render_cache_enabled_ << "\n";
     if (title_region_) {
         str << tab << "  # Title reg.  :\n";
         str << tab << "  |-###\n";
@@ -181,7 +218,8 @@ std::string frame::serialize(const std::string& tab) const {
 }
 
 bool frame::can_use_script(const std::string& script_name) const {
-    return script_name == "OnChar" || script_name == "OnDragStart" || script_name == "OnDragStop" ||
+    return script_name == "OnAnimationFinished" || script_name == "OnChar" ||
+           script_name == "OnDragStart" || script_name == "OnDragStop" ||
            script_name == "OnDragMove" || script_name == "OnEnter" || script_name == "OnEvent" ||
            script_name == "OnFocusGained" || script_name == "OnFocusLost" ||
            script_name == "OnHide" || script_name == "OnKeyDown" || script_name == "OnKeyUp" ||
@@ -227,6 +265,7 @@ void frame::copy_from(const region& obj) {
     this->set_scale(frame_obj->get_scale());
 
     this->set_update_rate(frame_obj->get_update_rate());
+    this->enable_render_cache(frame_obj->is_render_cache_enabled());
 
     for (const auto& art : frame_obj->region_list_) {
         if (!art || art->is_manually_inherited())
@@ -300,6 +339,8 @@ void frame::create_title_region() {
 
     title_region_ = std::move(title_region);
     title_region_->notify_loaded();
+
+    notify_frame_data_changed_();
 }
 
 utils::observer_ptr<const frame> frame::get_child(const std::string& name) const {
@@ -441,34 +482,58 @@ void frame::set_mouse_enabled(bool is_mouse_enabled) {
 
 void frame::set_mouse_click_enabled(bool is_mouse_enabled) {
     is_mouse_click_enabled_ = is_mouse_enabled;
+    notify_frame_data_changed_();
 }
 
 void frame::set_mouse_move_enabled(bool is_mouse_enabled) {
     is_mouse_move_enabled_ = is_mouse_enabled;
+    notify_frame_data_changed_();
 }
 
 void frame::set_mouse_wheel_enabled(bool is_mouse_wheel_enabled) {
     is_mouse_wheel_enabled_ = is_mouse_wheel_enabled;
+    notify_frame_data_changed_();
 }
 
 void frame::set_keyboard_enabled(bool is_keyboard_enabled) {
     is_keyboard_enabled_ = is_keyboard_enabled;
+    notify_frame_data_changed_();
 }
 
 void frame::enable_key_capture(const std::string& key_name) {
-    reg_key_list_.insert(key_name);
+    auto chord = input::get_key_chord_from_codename(key_name);
+    if (!chord.has_value()) {
+        gui::out << gui::warning << "gui::" << get_region_type() << ": Unknown key \"" << key_name
+                 << "\" for \"" << name_ << "\". Key capture skipped." << std::endl;
+        return;
+    }
+
+    enable_key_capture(chord.value());
 }
 
 void frame::enable_key_capture(input::key key_id) {
-    reg_key_list_.insert(std::string{input::get_key_codename(key_id)});
+    enable_key_capture(input::make_key_chord(key_id, false, false, false));
+}
+
+void frame::enable_key_capture(input::key_chord chord) {
+    auto iter = std::lower_bound(reg_key_list_.begin(), reg_key_list_.end(), chord);
+    if (iter == reg_key_list_.end() || *iter != chord)
+        reg_key_list_.insert(iter, chord);
 }
 
 void frame::disable_key_capture(const std::string& key_name) {
-    reg_key_list_.erase(key_name);
+    if (auto chord = input::get_key_chord_from_codename(key_name))
+        disable_key_capture(chord.value());
 }
 
 void frame::disable_key_capture(input::key key_id) {
-    reg_key_list_.erase(std::string{input::get_key_codename(key_id)});
+    disable_key_capture(input::make_key_chord(key_id, false, false, false));
+}
+
+void frame::disable_key_capture(input::key_chord chord) {
+    auto iter = std::lower_bound(reg_key_list_.begin(), reg_key_list_.end(), chord);
+    if (iter != reg_key_list_.end() && *iter == chord)
+        reg_key_list_.erase(iter);
 }
 
 void frame::disable_key_capture() {
@@ -557,6 +622,8 @@ void frame::set_parent_(utils::observer_ptr<frame> parent) {
             notify_frame_renderer_changed_(new_top_level_renderer);
         }
 
+        update_render_transform_();
+
         const auto new_strata = compute_effective_strata_();
         if (new_strata != effective_strata_) {
             notify_strata_changed_(new_strata);
@@ -740,7 +807,7 @@ strata frame::compute_effective_strata_() const {
     if (strata_.has_value())
         return strata_.value();
 
-    if (parent_ && parent_->get_effective_frame_renderer() == get_effective_frame_renderer())
+    if (parent_ && parent_->get_child_frame_renderer_() == get_effective_frame_renderer())
         return parent_->get_effective_strata();
 
     // Default if no defined strata and no parent set.
@@ -830,6 +897,11 @@ bool frame::is_in_region(const vector2f& position) const {
 
 utils::observer_ptr<const frame>
 frame::find_topmost_frame(const std::function<bool(const frame&)>& predicate) const {
+    if (render_cache_) {
+        if (auto topmost = render_cache_->find_topmost_frame(predicate))
+            return topmost;
+    }
+
     if (predicate(*this))
         return observer_from(this);
 
@@ -857,7 +929,12 @@ bool frame::is_keyboard_enabled() const {
 }
 
 bool frame::is_key_capture_enabled(const std::string& key_name) const {
-    return reg_key_list_.find(key_name) != reg_key_list_.end();
+    auto chord = input::get_key_chord_from_codename(key_name);
+    return chord.has_value() && is_key_capture_enabled(chord.value());
+}
+
+bool frame::is_key_capture_enabled(input::key_chord chord) const {
+    return std::binary_search(reg_key_list_.begin(), reg_key_list_.end(), chord);
 }
 
 bool frame::is_movable() const {
@@ -1192,6 +1269,7 @@ void frame::set_backdrop(std::unique_ptr<backdrop> bdrop) {
 
 void frame::set_abs_hit_rect_insets(const bounds2f& insets) {
     abs_hit_rect_inset_list_ = insets;
+    notify_frame_data_changed_();
 }
 
 void frame::set_rel_hit_rect_insets(const bounds2f& insets) {
@@ -1315,6 +1393,43 @@ bool frame::is_auto_focus_enabled() const {
     return is_auto_focus_;
 }
 
+void frame::enable_render_cache(bool enable) {
+    if (is_render_cache_enabled_ == enable)
+        return;
+
+    is_render_cache_enabled_ = enable;
+
+    if (is_virtual_)
+        return;
+
+    if (enable) {
+        render_cache_ = utils::make_owned<frame_cache_renderer>(*this);
+
+        for (auto& child : get_children()) {
+            if (!child.get_frame_renderer())
+                child.notify_frame_renderer_changed_(render_cache_);
+        }
+    } else {
+        for (auto& child : get_children()) {
+            if (!child.get_frame_renderer())
+                child.notify_frame_renderer_changed_(effective_frame_renderer_);
+        }
+
+        render_cache_ = nullptr;
+    }
+
+    // Children are no longer (or are now again) rendered with this frame's transformation
+    for (auto& child : get_children())
+        child.update_render_transform_();
+
+    notify_frame_data_changed_();
+    notify_renderer_need_redraw();
+}
+
+bool frame::is_render_cache_enabled() const {
+    return is_render_cache_enabled_;
+}
+
 void frame::set_focus(bool focus) {
     auto& root = get_manager().get_root();
     if (focus)
@@ -1389,6 +1504,11 @@ void frame::notify_frame_renderer_changed_(
     effective_frame_renderer_ = new_renderer;
     effective_frame_renderer_->notify_rendered_frame(observer_from(this), true);
 
+    if (render_cache_) {
+        // Children are rendered by the render cache, which does not change
+        return;
+    }
+
     for (const auto& child : child_list_) {
         if (auto* raw_ptr = child.get(); raw_ptr && !raw_ptr->get_frame_renderer())
             child->notify_frame_renderer_changed_(new_renderer);
@@ -1404,6 +1524,7 @@ void frame::set_frame_renderer(utils::observer_ptr<frame_renderer> rdr) {
 
     if (effective_frame_renderer_ != new_effective_renderer) {
         notify_frame_renderer_changed_(new_effective_renderer);
+        update_render_transform_();
     }
 }
 
@@ -1411,11 +1532,18 @@ utils::observer_ptr<const frame_renderer> frame::get_effective_frame_renderer()
     return effective_frame_renderer_;
 }
 
+utils::observer_ptr<const frame_renderer> frame::get_child_frame_renderer_() const {
+    if (render_cache_)
+        return render_cache_;
+    else
+        return effective_frame_renderer_;
+}
+
 utils::observer_ptr<const frame_renderer> frame::compute_top_level_frame_renderer_() const {
     if (frame_renderer_)
         return frame_renderer_;
     else if (parent_)
-        return parent_->get_effective_frame_renderer();
+        return parent_->get_child_frame_renderer_();
     else
         return get_manager().get_root().observer_from_this();
 }
@@ -1482,7 +1610,114 @@ void frame::notify_renderer_need_redraw() {
     if (is_virtual_)
         return;
 
+    if (render_cache_)
+        render_cache_->notify_content_changed();
+
     get_effective_frame_renderer()->notify_strata_needs_redraw(get_effective_strata());
+    notify_frame_data_changed_();
+}
+
+void frame::notify_renderer_need_redraw(const bounds2f& rect) {
+    if (is_virtual_)
+        return;
+
+    if (render_transform_.has_value()) {
+        // Transformed by an animation, the area drawn does not match the rect
+        notify_renderer_need_redraw();
+        return;
+    }
+
+    if (render_cache_)
+        render_cache_->notify_content_changed();
+
+    get_effective_frame_renderer()->notify_strata_rect_needs_redraw(get_effective_strata(), rect);
+}
+
+void frame::notify_alpha_changed_() {
+    base::notify_alpha_changed_();
+
+    // The effective alpha of children depends on this frame's alpha
+    for (auto& child : get_children())
+        child.notify_alpha_changed_();
+}
+
+void frame::notify_animation_transform_changed_() {
+    update_render_transform_();
+}
+
+void frame::update_render_transform_() {
+    if (is_virtual_)
+        return;
+
+    // Children rendered by another renderer (render cache, scroll child) do not inherit
+    // this frame's transformation: the other renderer is drawn with it already
+    std::optional<matrix4f> parent_transform;
+    if (parent_ && parent_->effective_frame_renderer_ == effective_frame_renderer_)
+        parent_transform = parent_->render_transform_;
+
+    if (!parent_transform.has_value() && !animation_transform_.has_value() &&
+        !render_transform_.has_value())
+        return;
+
+    if (animation_transform_.has_value() && parent_transform.has_value())
+        render_transform_ = animation_transform_.value() * parent_transform.value();
+    else if (animation_transform_.has_value())
+        render_transform_ = animation_transform_;
+    else
+        render_transform_ = parent_transform;
+
+    notify_renderer_need_redraw();
+
+    for (auto& child : get_children())
+        child.update_render_transform_();
+}
+
+void frame::notify_frame_data_changed_() {
+    if (is_virtual_ || !effective_frame_renderer_)
+        return;
+
+    effective_frame_renderer_->notify_frame_data_changed(*this);
+}
+
+bool frame::has_custom_hit_test_() const {
+    // With a render cache, children may be outside of this frame's hit rectangle
+    return title_region_ != nullptr || render_cache_ != nullptr;
+}
+
+void frame::recycle_(const frame& default_frame) {
+    // Disable callbacks
+    signal_list_.clear();
+    event_receiver_.unregister_all_events();
+
+    if (is_focused_)
+        set_focus(false);
+
+    // Destroy all content. NB: the lists are not cleared, since they may be iterated on;
+    // the empty entries will be removed later in update().
+    for (auto& child : child_list_)
+        child = nullptr;
+    for (auto& reg : region_list_)
+        reg = nullptr;
+
+    title_region_ = nullptr;
+    backdrop_     = nullptr;
+
+    reg_drag_list_.clear();
+    reg_key_list_.clear();
+
+    notify_layers_need_update();
+
+    // Stop and remove animations
+    animation_group_list_.clear();
+    apply_animation_groups_();
+
+    // Reset all properties to their default value
+    clear_all_anchors();
+    copy_from(default_frame);
+    hide();
+
+    // Remove Lua members
+    get_lua_().globals()["_METADATA"][get_name()] = sol::lua_nil;
 }
 
 void frame::notify_scaling_factor_updated() {
@@ -1496,6 +1731,9 @@ void frame::notify_scaling_factor_updated() {
 
     for (auto& obj : get_regions())
         obj.notify_scaling_factor_updated();
+
+    if (render_cache_)
+        render_cache_->notify_content_changed();
 }
 
 void frame::notify_mouse_in_frame(bool mouse_in_frame, const vector2f& /*position*/) {
@@ -1524,6 +1762,9 @@ void frame::update_borders_() {
 
     check_position_();
 
+    // The renderer was notified by region::update_borders_(), before the borders were clamped
+    notify_frame_data_changed_();
+
     if (borders_ != old_border_list || is_valid_ != old_valid) {
         if (borders_.width() != old_border_list.width() ||
             borders_.height() != old_border_list.height()) {
@@ -1609,6 +1850,9 @@ void frame::update_(float delta) {
             }
         }
     }
+
+    if (render_cache_ && is_visible())
+        render_cache_->update();
 }
 
 const std::vector<std::string>& frame::get_type_list_() const {
@@ -0,0 +1,166 @@
+#include "lxgui/gui_frame_cache_renderer.hpp"
+
+#include "lxgui/gui_frame.hpp"
+#include "lxgui/gui_manager.hpp"
+#include "lxgui/gui_material.hpp"
+#include "lxgui/gui_out.hpp"
+#include "lxgui/gui_render_target.hpp"
+#include "lxgui/gui_renderer.hpp"
+
+#include <cmath>
+
+namespace lxgui::gui {
+
+frame_cache_renderer::frame_cache_renderer(frame& owner) : owner_(owner) {}
+
+void frame_cache_renderer::notify_strata_needs_redraw(strata strata_id) {
+    frame_renderer::notify_strata_needs_redraw(strata_id);
+    notify_content_changed();
+    owner_.notify_renderer_need_redraw();
+}
+
+void frame_cache_renderer::notify_strata_rect_needs_redraw(strata strata_id, const bounds2f& rect) {
+    frame_renderer::notify_strata_needs_redraw(strata_id);
+    notify_content_changed();
+    owner_.notify_renderer_need_redraw(rect);
+}
+
+vector2f frame_cache_renderer::get_target_dimensions() const {
+    return owner_.get_effective_frame_renderer()->get_target_dimensions();
+}
+
+void frame_cache_renderer::notify_content_changed() {
+    is_cached_          = false;
+    num_static_updates_ = 0u;
+}
+
+void frame_cache_renderer::update() {
+    if (is_cached_ || !is_target_supported_)
+        return;
+
+    if (num_static_updates_ < static_update_threshold) {
+        ++num_static_updates_;
+        return;
+    }
+
+    render_target_();
+}
+
+bool frame_cache_renderer::is_cached() const {
+    return is_cached_;
+}
+
+void frame_cache_renderer::render_cache() const {
+    if (target_quad_.mat)
+        owner_.get_manager().get_renderer().render_quad(target_quad_);
+}
+
+void frame_cache_renderer::render_frames() const {
+    for (const auto& s : strata_list_) {
+        render_strata_(s);
+    }
+}
+
+bounds2f frame_cache_renderer::compute_bounds_() const {
+    bounds2f bounds = owner_.get_borders();
+
+    auto add_regions = [&](const frame& obj) {
+        for (const auto& reg : obj.get_regions()) {
+            if (reg.is_valid())
+                bounds = bounds.merge(reg.get_borders());
+        }
+    };
+
+    add_regions(owner_);
+    update_frame_list_data_();
+
+    constexpr std::uint8_t required_flags = flag_visible | flag_valid;
+
+    for (std::size_t i = 0; i < sorted_frame_list_.size(); ++i) {
+        if ((frame_flag_list_[i] & required_flags) != required_flags)
+            continue;
+
+        const frame& obj = **(sorted_frame_list_.begin() + i);
+        bounds           = bounds.merge(obj.get_borders());
+        add_regions(obj);
+    }
+
+    return bounds;
+}
+
+void frame_cache_renderer::render_target_() {
+    const bounds2f bounds = compute_bounds_();
+    if (bounds.width() <= 0.0f || bounds.height() <= 0.0f) {
+        // Nothing to render
+        target_quad_.mat = nullptr;
+        is_cached_       = true;
+        return;
+    }
+
+    auto&       rdr   = owner_.get_manager().get_renderer();
+    const float scale = owner_.get_manager().get_interface_scaling_factor();
+
+    const vector2ui dimensions(
+        static_cast<std::size_t>(std::ceil(bounds.width() * scale)),
+        static_cast<std::size_t>(std::ceil(bounds.height() * scale)));
+
+    const std::size_t max_size = rdr.get_texture_max_size();
+    if (dimensions.x > max_size || dimensions.y > max_size) {
+        // Too large to be cached for now, try again later
+        num_static_updates_ = 0u;
+        return;
+    }
+
+    try {
+        if (!target_) {
+            target_          = rdr.create_render_target(dimensions);
+            target_quad_.mat = nullptr;
+        } else if (vector2ui(target_->get_rect().dimensions()) != dimensions) {
+            target_->set_dimensions(dimensions);
+            target_quad_.mat = nullptr;
+        }
+    } catch (const utils::exception& e) {
+        gui::out << gui::warning << "gui::frame_cache_renderer: "
+                 << "Unable to create render_target for \"" << owner_.get_name()
+                 << "\", caching disabled: " << e.get_description() << std::endl;
+
+        target_              = nullptr;
+        target_quad_.mat     = nullptr;
+        is_target_supported_ = false;
+        return;
+    }
+
+    rdr.begin(target_);
+
+    const vector2f view = vector2f(target_->get_canvas_dimensions()) / scale;
+    rdr.set_view(matrix4f::translation(-bounds.top_left()) * matrix4f::view(view));
+
+    rdr.clear(color::empty);
+
+    owner_.render_content_();
+    render_frames();
+
+    rdr.end();
+
+    auto& q = target_quad_;
+
+    if (!q.mat) {
+        q.mat = rdr.create_material(target_);
+
+        q.v[0].uvs = q.mat->get_canvas_uv(vector2f(0, 0), true);
+        q.v[1].uvs = q.mat->get_canvas_uv(vector2f(1, 0), true);
+        q.v[2].uvs = q.mat->get_canvas_uv(vector2f(1, 1), true);
+        q.v[3].uvs = q.mat->get_canvas_uv(vector2f(0, 1), true);
+    }
+
+    const vector2f size = vector2f(dimensions) / scale;
+
+    q.v[0].pos = bounds.top_left();
+    q.v[1].pos = bounds.top_left() + vector2f(size.x, 0);
+    q.v[2].pos = bounds.top_left() + size;
+    q.v[3].pos = bounds.top_left() + vector2f(0, size.y);
+
+    is_cached_ = true;
+}
+
+} // namespace lxgui::gui
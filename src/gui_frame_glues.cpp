@@ -90,6 +90,10 @@
  *
  * Hard-coded events available to all @{Frame}s:
  *
+ * - `OnAnimationFinished`: Triggered when an animation group of the frame, or of
+ * one of its layered regions, reaches its end without looping. This event provides
+ * two arguments to the registered callback: the name of the animation group, and
+ * the name of the animated region.
  * - `OnChar`: Triggered whenever a character is typed and the frame has focus
  * (see @{Frame:set_focus}).
  * - `OnDoubleClick`: Triggered when the frame is double-clicked.
@@ -402,6 +406,10 @@ void frame::register_on_lua(sol::state& lua) {
      */
     type.set_function("enable_mouse_wheel", member_function<&frame::enable_mouse_wheel>());
 
+    /** @function enable_render_cache
+     */
+    type.set_function("enable_render_cache", member_function<&frame::enable_render_cache>());
+
     /** @function get_backdrop
      */
     type.set_function(
@@ -581,12 +589,21 @@ void frame::register_on_lua(sol::state& lua) {
 
     /** @function is_key_capture_enabled
      */
-    type.set_function("is_key_capture_enabled", member_function<&frame::is_key_capture_enabled>());
+    type.set_function(
+        "is_key_capture_enabled",
+        member_function< // select the right overload for Lua
+            static_cast<bool (frame::*)(const std::string&) const>(
+                &frame::is_key_capture_enabled)>());
 
     /** @function is_movable
      */
     type.set_function("is_movable", member_function<&frame::is_movable>());
 
+    /** @function is_render_cache_enabled
+     */
+    type.set_function(
+        "is_render_cache_enabled", member_function<&frame::is_render_cache_enabled>());
+
     /** @function is_resizable
      */
     type.set_function("is_resizable", member_function<&frame::is_resizable>());
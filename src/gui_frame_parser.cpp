@@ -17,6 +17,7 @@ void frame::parse_all_nodes_before_children_(const layout_node& node) {
     parse_size_node_(node);
     parse_resize_bounds_node_(node);
     parse_anchor_node_(node);
+    parse_animations_node_(node);
     parse_title_region_node_(node);
     parse_backdrop_node_(node);
     parse_hit_rect_insets_node_(node);
@@ -77,6 +78,8 @@ void frame::parse_attributes_(const layout_node& node) {
         enable_auto_focus(attr.value());
     if (const auto attr = node.try_get_attribute_value<float>("updateRate"))
         set_update_rate(attr.value());
+    if (const auto attr = node.try_get_attribute_value<bool>("renderCache"))
+        enable_render_cache(attr.value());
 }
 
 void frame::parse_resize_bounds_node_(const layout_node& node) {
@@ -0,0 +1,168 @@
+#include "lxgui/gui_frame_pool.hpp"
+
+#include "lxgui/gui_alive_checker.hpp"
+#include "lxgui/gui_factory.hpp"
+#include "lxgui/gui_frame.hpp"
+#include "lxgui/gui_manager.hpp"
+#include "lxgui/gui_out.hpp"
+#include "lxgui/gui_root.hpp"
+#include "lxgui/gui_virtual_root.hpp"
+
+#include <algorithm>
+
+namespace lxgui::gui {
+
+frame_pool::frame_pool(manager& mgr) : manager_(mgr) {}
+
+frame_pool::~frame_pool() {
+    clear();
+}
+
+utils::observer_ptr<frame> frame_pool::acquire_frame(frame_core_attributes attr) {
+    attr.is_virtual = false;
+
+    const std::string key = get_key_(attr);
+
+    auto iter_pool = pooled_list_.find(key);
+    if (iter_pool != pooled_list_.end() && !iter_pool->second.empty()) {
+        utils::owner_ptr<frame> pooled_frame = std::move(iter_pool->second.back());
+        iter_pool->second.pop_back();
+        --num_pooled_;
+
+        utils::observer_ptr<frame> obj;
+        if (attr.parent)
+            obj = attr.parent->add_child(std::move(pooled_frame));
+        else
+            obj = manager_.get_root().add_root_frame(std::move(pooled_frame));
+
+        obj->set_level(attr.parent ? attr.parent->get_level() + 1 : 0);
+        obj->show();
+
+        manager_.get_factory().apply_inheritance_(*obj, attr);
+
+        ++num_reused_;
+        return obj;
+    }
+
+    utils::observer_ptr<frame> obj;
+    if (attr.parent)
+        obj = attr.parent->create_child(std::move(attr));
+    else
+        obj = manager_.get_root().create_root_frame(std::move(attr));
+
+    if (!obj)
+        return nullptr;
+
+    if (acquired_list_.size() >= next_cleanup_) {
+        remove_expired_frames_();
+        next_cleanup_ = std::max<std::size_t>(64u, 2u * acquired_list_.size());
+    }
+
+    acquired_list_[obj.get()] = acquired_frame{obj, key};
+
+    ++num_created_;
+    return obj;
+}
+
+void frame_pool::release_frame(frame& obj) {
+    auto iter = acquired_list_.find(&obj);
+    if (iter == acquired_list_.end() || iter->second.obj.get() != &obj) {
+        if (iter != acquired_list_.end())
+            acquired_list_.erase(iter);
+
+        gui::out << gui::warning << "gui::frame_pool: \"" << obj.get_name()
+                 << "\" was not acquired from the frame pool, destroying it instead." << std::endl;
+        obj.destroy();
+        return;
+    }
+
+    const std::string key = iter->second.key;
+
+    // Gracefully disappear (triggers events, etc.)
+    alive_checker checker(obj);
+    obj.hide();
+    if (!checker.is_alive())
+        return;
+
+    auto owner = utils::static_pointer_cast<frame>(obj.release_from_parent());
+    if (!owner)
+        return;
+
+    auto default_frame = get_default_frame_(owner->get_region_type());
+    if (!default_frame) {
+        // Cannot reset this frame; just let it be destroyed
+        return;
+    }
+
+    owner->recycle_(*default_frame);
+
+    pooled_list_[key].push_back(std::move(owner));
+    ++num_pooled_;
+
+    manager_.get_root().notify_hovered_frame_dirty();
+}
+
+std::size_t frame_pool::get_num_pooled_frames() const {
+    return num_pooled_;
+}
+
+std::size_t frame_pool::get_num_reused_frames() const {
+    return num_reused_;
+}
+
+std::size_t frame_pool::get_num_created_frames() const {
+    return num_created_;
+}
+
+void frame_pool::clear() {
+    pooled_list_.clear();
+    num_pooled_ = 0u;
+
+    remove_expired_frames_();
+}
+
+std::string frame_pool::get_key_(const frame_core_attributes& attr) {
+    std::string key = attr.object_type;
+    for (const auto& base : attr.inheritance) {
+        if (!base)
+            continue;
+
+        key += ',';
+        key += base->get_name();
+    }
+
+    return key;
+}
+
+utils::observer_ptr<const frame> frame_pool::get_default_frame_(const std::string& type) {
+    auto iter = default_list_.find(type);
+    if (iter != default_list_.end() && iter->second)
+        return iter->second;
+
+    // Use a virtual frame with no template, which holds the default state of this frame type
+    frame_core_attributes attr;
+    attr.object_type = type;
+    attr.name        = "$FramePoolDefault" + type;
+    attr.is_virtual  = true;
+
+    auto& vroot = manager_.get_virtual_root();
+    if (auto existing = vroot.get_registry().get_region_by_name(attr.name))
+        return default_list_[type] = down_cast<frame>(existing);
+
+    auto default_frame = vroot.create_root_frame(std::move(attr));
+    if (default_frame)
+        default_frame->notify_loaded();
+
+    return default_list_[type] = default_frame;
+}
+
+void frame_pool::remove_expired_frames_() {
+    for (auto iter = acquired_list_.begin(); iter != acquired_list_.end();) {
+        if (iter->second.obj)
+            ++iter;
+        else
+            iter = acquired_list_.erase(iter);
+    }
+}
+
+} // namespace lxgui::gui
@@ -2,6 +2,7 @@
 
 #include "lxgui/gui_frame.hpp"
 #include "lxgui/gui_out.hpp"
+#include "lxgui/gui_renderer.hpp"
 #include "lxgui/utils_range.hpp"
 #include "lxgui/utils_string.hpp"
 
@@ -27,6 +28,21 @@ void check_sorted(const T& list) {
     }
 }
 
+template<typename Predicate>
+bool any_content_rect(const frame& obj, Predicate&& predicate) {
+    if (predicate(obj.get_borders()))
+        return true;
+
+    for (const auto& reg : obj.get_regions()) {
+        // Regions transformed by an animation can be drawn anywhere
+        if (reg.is_valid() &&
+            (reg.get_animation_transform().has_value() || predicate(reg.get_borders())))
+            return true;
+    }
+
+    return false;
+}
+
 struct strata_comparator {
     bool operator()(strata s1, strata s2) const {
         using int_type        = std::underlying_type_t<strata>;
@@ -79,6 +95,10 @@ void frame_renderer::notify_strata_needs_redraw(strata strata_id) {
     strata_list_[static_cast<std::size_t>(strata_id)].redraw_flag = true;
 }
 
+void frame_renderer::notify_strata_rect_needs_redraw(strata strata_id, const bounds2f& /*rect*/) {
+    notify_strata_needs_redraw(strata_id);
+}
+
 void frame_renderer::notify_rendered_frame(const utils::observer_ptr<frame>& obj, bool rendered) {
     if (!obj)
         return;
@@ -97,9 +117,7 @@ void frame_renderer::notify_rendered_frame(const utils::observer_ptr<frame>& obj
         sorted_frame_list_.erase(iter);
     }
 
-    for (std::size_t i = 0; i < strata_list_.size(); ++i) {
-        strata_list_[i].range = get_strata_range_(static_cast<strata>(i));
-    }
+    notify_frame_list_sorted_();
 
     const auto strata_id = obj->get_effective_strata();
 
@@ -113,9 +131,7 @@ void frame_renderer::notify_strata_changed(
     std::stable_sort(
         sorted_frame_list_.begin(), sorted_frame_list_.end(), sorted_frame_list_.comparator());
 
-    for (std::size_t i = 0; i < strata_list_.size(); ++i) {
-        strata_list_[i].range = get_strata_range_(static_cast<strata>(i));
-    }
+    notify_frame_list_sorted_();
 
     frame_list_updated_ = true;
     notify_strata_needs_redraw(old_strata_id);
@@ -141,10 +157,85 @@ void frame_renderer::notify_level_changed(
 
     std::stable_sort(begin, last, sorted_frame_list_.comparator());
 
+    notify_frame_list_sorted_();
+
     frame_list_updated_ = true;
     notify_strata_needs_redraw(strata_id);
 }
 
+void frame_renderer::notify_frame_list_sorted_() {
+    for (std::size_t i = 0; i < strata_list_.size(); ++i) {
+        strata_list_[i].range = get_strata_range_(static_cast<strata>(i));
+    }
+
+    // Frames have moved in the list. Their index and packed data are only rebuilt when next
+    // needed, so that adding or sorting many frames in a row does not rebuild them each time.
+    frame_data_dirty_ = true;
+}
+
+void frame_renderer::update_frame_list_data_() const {
+    if (!frame_data_dirty_)
+        return;
+
+    frame_data_dirty_ = false;
+
+    const std::size_t num_frames = sorted_frame_list_.size();
+    frame_hit_rect_list_.resize(num_frames);
+    frame_alpha_list_.resize(num_frames);
+    frame_flag_list_.resize(num_frames);
+
+    for (std::size_t i = 0; i < num_frames; ++i) {
+        (*(sorted_frame_list_.begin() + i))->renderer_index_ = i;
+        update_frame_data_(i);
+    }
+}
+
+void frame_renderer::update_frame_data_(std::size_t index) const {
+    const frame& obj = **(sorted_frame_list_.begin() + index);
+
+    // Same rectangle as frame::is_in_region()
+    const bounds2f& borders = obj.get_borders();
+    const bounds2f& insets  = obj.get_abs_hit_rect_insets();
+    frame_hit_rect_list_[index] = bounds2f(
+        borders.left + insets.left, borders.right - insets.right - 1.0f,
+        borders.top + insets.top, borders.bottom - insets.bottom - 1.0f);
+
+    frame_alpha_list_[index] = obj.get_effective_alpha();
+
+    std::uint8_t flags = 0u;
+    if (obj.is_visible())
+        flags |= flag_visible;
+    if (obj.is_valid())
+        flags |= flag_valid;
+    if (obj.is_mouse_click_enabled())
+        flags |= flag_mouse_click;
+    if (obj.is_mouse_move_enabled())
+        flags |= flag_mouse_move;
+    if (obj.is_mouse_wheel_enabled())
+        flags |= flag_mouse_wheel;
+    if (obj.is_keyboard_enabled())
+        flags |= flag_keyboard;
+    if (obj.has_custom_hit_test_())
+        flags |= flag_custom_hit_test;
+    if (obj.render_cache_) {
+        // Children rendered by the cache are only reachable through this frame
+        flags |= flag_mouse_click | flag_mouse_move | flag_mouse_wheel | flag_keyboard;
+    }
+
+    frame_flag_list_[index] = flags;
+}
+
+void frame_renderer::notify_frame_data_changed(const frame& obj) {
+    if (frame_data_dirty_) {
+        // The whole packed data will be rebuilt anyway
+        return;
+    }
+
+    const std::size_t index = obj.renderer_index_;
+    if (index < sorted_frame_list_.size() && *(sorted_frame_list_.begin() + index) == &obj)
+        update_frame_data_(index);
+}
+
 utils::observer_ptr<const frame>
 frame_renderer::find_topmost_frame(const std::function<bool(const frame&)>& predicate) const {
     // Iterate through the frames in reverse order from rendering (frame on top goes first)
@@ -158,6 +249,33 @@ frame_renderer::find_topmost_frame(const std::function<bool(const frame&)>& pred
     return nullptr;
 }
 
+utils::observer_ptr<const frame> frame_renderer::find_topmost_frame(
+    const vector2f&                           position,
+    std::uint8_t                              flags,
+    const std::function<bool(const frame&)>& predicate) const {
+    update_frame_list_data_();
+
+    // Iterate through the frames in reverse order from rendering (frame on top goes first),
+    // using only the packed data to discard frames that cannot match.
+    for (std::size_t i = sorted_frame_list_.size(); i-- > 0;) {
+        const std::uint8_t frame_flags = frame_flag_list_[i];
+        if ((frame_flags & flags) != flags)
+            continue;
+
+        if ((frame_flags & flag_custom_hit_test) == 0u) {
+            const bounds2f& rect = frame_hit_rect_list_[i];
+            if (position.x < rect.left || position.x > rect.right || position.y < rect.top ||
+                position.y > rect.bottom)
+                continue;
+        }
+
+        if (auto topmost = (*(sorted_frame_list_.begin() + i))->find_topmost_frame(predicate))
+            return topmost;
+    }
+
+    return nullptr;
+}
+
 int frame_renderer::get_highest_level(strata strata_id) const {
     auto range = strata_list_[static_cast<std::size_t>(strata_id)].range;
     auto begin = sorted_frame_list_.begin() + range.first;
@@ -171,17 +289,73 @@ int frame_renderer::get_highest_level(strata strata_id) const {
     return 0;
 }
 
-void frame_renderer::render_strata_(const strata_data& strata_obj) const {
+std::size_t frame_renderer::render_strata_(const strata_data& strata_obj) const {
+    return render_strata_(strata_obj, std::nullopt);
+}
+
+std::size_t frame_renderer::render_strata_(
+    const strata_data& strata_obj, const std::optional<bounds2f>& clip_rect) const {
+    update_frame_list_data_();
+
     auto begin = sorted_frame_list_.begin() + strata_obj.range.first;
     auto end   = sorted_frame_list_.begin() + strata_obj.range.second;
 
+    constexpr std::uint8_t required_flags = flag_visible | flag_valid;
+
+    // View before any animation transformation, fetched only if needed
+    std::optional<matrix4f> base_view;
+
+    std::size_t num_rendered = 0u;
     for (auto iter = begin; iter != end; ++iter) {
-        (*iter)->render();
+        const std::size_t index = iter - sorted_frame_list_.begin();
+        if ((frame_flag_list_[index] & required_flags) != required_flags)
+            continue;
+
+        const frame& obj = **iter;
+        renderer&    rdr = obj.renderer_;
+
+        // Skip fully transparent frames; the alpha is inherited, so this also skips
+        // the children of a transparent frame
+        if (frame_alpha_list_[index] <= 0.0f) {
+            rdr.notify_culled_frame();
+            continue;
+        }
+
+        // Skip frames which draw nothing in the visible area (a frame with a render cache
+        // also draws its children, which can be anywhere, and a frame transformed by an
+        // animation is not drawn at its borders)
+        if (!obj.render_cache_ && !obj.render_transform_.has_value()) {
+            const bool has_visible_content = any_content_rect(obj, [&](const bounds2f& rect) {
+                return rdr.is_in_view(rect) &&
+                       (!clip_rect.has_value() || rect.overlaps(clip_rect.value()));
+            });
+
+            if (!has_visible_content) {
+                rdr.notify_culled_frame();
+                continue;
+            }
+        }
+
+        if (obj.render_transform_.has_value()) {
+            if (!base_view.has_value())
+                base_view = rdr.get_view();
+
+            rdr.set_view(obj.render_transform_.value() * base_view.value());
+            obj.render();
+            rdr.set_view(base_view.value());
+        } else {
+            obj.render();
+        }
+
+        ++num_rendered;
     }
+
+    return num_rendered;
 }
 
 void frame_renderer::clear_strata_list_() {
     sorted_frame_list_.clear();
+    notify_frame_list_sorted_();
     frame_list_updated_ = true;
 }
 
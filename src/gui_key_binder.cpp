@@ -3,8 +3,6 @@
 #include "lxgui/gui_event_emitter.hpp"
 #include "lxgui/gui_out.hpp"
 #include "lxgui/input_dispatcher.hpp"
-#include "lxgui/utils_std.hpp"
-#include "lxgui/utils_string.hpp"
 
 #include <lxgui/extern_sol2_state.hpp>
 
@@ -26,19 +24,15 @@ key_binder::register_key_binding(std::string_view name, sol::protected_function
 }
 
 utils::connection key_binder::register_key_binding(std::string_view name, function_type function) {
-    auto iter =
-        utils::find_if(key_bindings_, [&](const auto& binding) { return binding.name == name; });
-
-    if (iter == key_bindings_.end()) {
+    if (key_bindings_.find(name) != key_bindings_.end()) {
         gui::out << gui::error << "key_binder: a binding already exists with name '" << name << "'."
                  << std::endl;
         return {};
     }
 
-    key_binding binding;
+    auto& binding   = key_bindings_[std::string(name)];
     binding.name    = std::string(name);
     auto connection = binding.signal.connect(std::move(function));
-    key_bindings_.push_back(std::move(binding));
 
     return connection;
 }
@@ -49,75 +43,72 @@ void key_binder::set_key_binding(
     bool             shift_is_pressed,
     bool             ctrl_is_pressed,
     bool             alt_is_pressed) {
-    auto iter =
-        utils::find_if(key_bindings_, [&](const auto& binding) { return binding.name == name; });
+    set_key_binding(
+        name, input::make_key_chord(key_id, shift_is_pressed, ctrl_is_pressed, alt_is_pressed));
+}
 
-    if (iter == key_bindings_.end()) {
-        gui::out << gui::error << "key_binder: no binding with name '" << name << "'." << std::endl;
+void key_binder::set_key_binding(std::string_view name, std::string_view key_name) {
+    auto chord = input::get_key_chord_from_codename(key_name);
+    if (!chord.has_value()) {
+        gui::out << gui::error << "key_binder: unknown key '" << key_name << "'." << std::endl;
         return;
     }
 
-    iter->key_id = key_id;
-    iter->shift_is_pressed =
-        shift_is_pressed || key_id == input::key::k_lshift || key_id == input::key::k_rshift;
-    iter->ctrl_is_pressed =
-        ctrl_is_pressed || key_id == input::key::k_lcontrol || key_id == input::key::k_rcontrol;
-    iter->alt_is_pressed =
-        alt_is_pressed || key_id == input::key::k_lmenu || key_id == input::key::k_rmenu;
+    set_key_binding(name, chord.value());
 }
 
-void key_binder::set_key_binding(std::string_view name, std::string_view key_name) {
-    bool shift_is_pressed = false;
-    bool ctrl_is_pressed  = false;
-    bool alt_is_pressed   = false;
-
-    const auto tokens = utils::cut(key_name, "-");
-    for (auto token : tokens) {
-        if (token == "Shift")
-            shift_is_pressed = true;
-        else if (token == "Ctrl")
-            ctrl_is_pressed = true;
-        else if (token == "Alt")
-            alt_is_pressed = true;
+void key_binder::set_key_binding(std::string_view name, input::key_chord chord) {
+    auto* binding = find_binding_(name);
+    if (!binding) {
+        gui::out << gui::error << "key_binder: no binding with name '" << name << "'." << std::endl;
+        return;
     }
 
-    set_key_binding(
-        name, input::get_key_from_codename(tokens.back()), shift_is_pressed, ctrl_is_pressed,
-        alt_is_pressed);
+    if (binding->chord.has_value())
+        chord_bindings_.erase(binding->chord.value());
+
+    auto& previous = chord_bindings_[chord];
+    if (previous && previous != binding)
+        previous->chord = std::nullopt;
+
+    previous       = binding;
+    binding->chord = chord;
 }
 
 void key_binder::remove_key_binding(std::string_view name) {
-    auto iter =
-        utils::find_if(key_bindings_, [&](const auto& binding) { return binding.name == name; });
-
+    auto iter = key_bindings_.find(name);
     if (iter == key_bindings_.end()) {
         gui::out << gui::error << "key_binder: no binding with name '" << name << "'." << std::endl;
         return;
     }
 
+    if (iter->second.chord.has_value())
+        chord_bindings_.erase(iter->second.chord.value());
+
     key_bindings_.erase(iter);
 }
 
-key_binder::key_binding* key_binder::find_binding_(
-    input::key key_id, bool shift_is_pressed, bool ctrl_is_pressed, bool alt_is_pressed) {
-    auto iter = utils::find_if(key_bindings_, [&](const auto& binding) {
-        return binding.key_id == key_id && binding.shift_is_pressed == shift_is_pressed &&
-               binding.ctrl_is_pressed == ctrl_is_pressed &&
-               binding.alt_is_pressed == alt_is_pressed;
-    });
-
+key_binder::key_binding* key_binder::find_binding_(std::string_view name) {
+    auto iter = key_bindings_.find(name);
     if (iter == key_bindings_.end())
         return nullptr;
 
-    return &*iter;
+    return &iter->second;
 }
 
 bool key_binder::on_key_down(
     input::key key_id, bool shift_is_pressed, bool ctrl_is_pressed, bool alt_is_pressed) {
-    auto* binding = find_binding_(key_id, shift_is_pressed, ctrl_is_pressed, alt_is_pressed);
-    if (!binding)
+    return on_key_down(
+        input::make_key_chord(key_id, shift_is_pressed, ctrl_is_pressed, alt_is_pressed));
+}
+
+bool key_binder::on_key_down(input::key_chord chord) {
+    auto iter = chord_bindings_.find(chord);
+    if (iter == chord_bindings_.end())
         return false;
 
+    auto* binding = iter->second;
+
     try {
         binding->signal();
     } catch (const std::exception& e) {
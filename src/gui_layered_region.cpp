@@ -1,5 +1,6 @@
 #include "lxgui/gui_layered_region.hpp"
 
+#include "lxgui/gui_factory.hpp"
 #include "lxgui/gui_frame.hpp"
 #include "lxgui/gui_manager.hpp"
 #include "lxgui/gui_out.hpp"
@@ -17,6 +18,10 @@ layered_region::layered_region(
     initialize_(*this, attr);
 }
 
+layered_region::~layered_region() {
+    get_manager().get_factory().notify_layered_region_destroyed(*this);
+}
+
 std::string layered_region::serialize(const std::string& tab) const {
     std::ostringstream str;
     str << base::serialize(tab);
@@ -62,8 +67,24 @@ void layered_region::notify_renderer_need_redraw() {
     if (is_virtual_)
         return;
 
-    if (parent_)
+    if (!parent_)
+        return;
+
+    // Redraw both the area this region was drawn in, and the area it will be drawn in now
+    std::optional<bounds2f> rect = last_drawn_borders_;
+    if (is_valid_)
+        rect = rect.has_value() ? rect->merge(borders_) : borders_;
+
+    last_drawn_borders_ = is_valid_ ? std::optional<bounds2f>(borders_) : std::nullopt;
+
+    if (animation_transform_.has_value()) {
+        // Transformed by an animation, can be drawn outside of the borders
         parent_->notify_renderer_need_redraw();
+        return;
+    }
+
+    if (rect.has_value())
+        parent_->notify_renderer_need_redraw(rect.value());
 }
 
 const std::vector<std::string>& layered_region::get_type_list_() const {
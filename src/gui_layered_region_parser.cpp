@@ -11,6 +11,7 @@ void layered_region::parse_layout(const layout_node& node) {
 
     parse_size_node_(node);
     parse_anchor_node_(node);
+    parse_animations_node_(node);
 }
 
 void layered_region::parse_attributes_(const layout_node& node) {
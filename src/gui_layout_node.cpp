@@ -0,0 +1,91 @@
+#include "lxgui/gui_layout_node.hpp"
+
+#include "lxgui/utils_file_system.hpp"
+
+#include <algorithm>
+
+namespace lxgui::gui {
+
+file_line_mappings::file_line_mappings(std::string file_name) : file_name_(std::move(file_name)) {
+    const auto content = utils::read_file(file_name_);
+    if (!content.has_value())
+        return;
+
+    // Start with a new line, such that offsets match line numbers (see get_line_info())
+    file_content_.reserve(content->size() + 1u);
+    file_content_.push_back('\n');
+    file_content_.append(content->get_view());
+
+    // Remove carriage returns, for consistency with text-mode reading
+    file_content_.erase(
+        std::remove(file_content_.begin(), file_content_.end(), '\r'), file_content_.end());
+
+    line_offsets_.push_back(0u);
+    for (std::size_t i = 1u; i < file_content_.size(); ++i) {
+        if (file_content_[i] == '\n')
+            line_offsets_.push_back(i);
+    }
+
+    if (file_content_.size() > 1u && file_content_.back() != '\n')
+        line_offsets_.push_back(file_content_.size());
+
+    is_open_ = true;
+}
+
+bool file_line_mappings::is_open() const noexcept {
+    return is_open_;
+}
+
+const std::string& file_line_mappings::get_file_name() const noexcept {
+    return file_name_;
+}
+
+std::string& file_line_mappings::get_content() noexcept {
+    return file_content_;
+}
+
+bool file_line_mappings::contains(std::string_view str) const noexcept {
+    const char* begin = file_content_.data();
+    const char* end   = begin + file_content_.size();
+    return str.data() >= begin && str.data() + str.size() <= end;
+}
+
+std::size_t file_line_mappings::get_offset(const char* str) const noexcept {
+    if (!contains(std::string_view(str, 0u)))
+        return unknown_offset;
+
+    return static_cast<std::size_t>(str - file_content_.data());
+}
+
+std::pair<std::size_t, std::size_t>
+file_line_mappings::get_line_info(std::size_t offset) const noexcept {
+    auto iter = std::lower_bound(line_offsets_.begin(), line_offsets_.end(), offset);
+    if (iter == line_offsets_.end())
+        return std::make_pair(0, 0);
+
+    std::size_t line_nbr    = iter - line_offsets_.begin();
+    std::size_t char_offset = offset - *iter + 1u;
+
+    return std::make_pair(line_nbr, char_offset);
+}
+
+std::string_view file_line_mappings::get_location(std::size_t offset) const {
+    auto iter = location_list_.find(offset);
+    if (iter != location_list_.end())
+        return iter->second;
+
+    auto        location = get_line_info(offset);
+    std::string str;
+    if (location.first == 0)
+        str = file_name_ + ":?";
+    else
+        str = file_name_ + ":" + utils::to_string(location.first);
+
+    return location_list_.emplace(offset, std::move(str)).first->second;
+}
+
+std::string_view file_line_mappings::store(std::string str) {
+    return storage_.emplace_back(std::move(str));
+}
+
+} // namespace lxgui::gui
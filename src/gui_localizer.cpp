@@ -74,6 +74,14 @@ std::vector<std::string> get_default_languages() {
 
     return {"enUS"};
 }
+
+sol::protected_function_result run_file(sol::state& lua, const std::string& file_name) {
+    const auto content = utils::read_file(file_name);
+    if (!content.has_value())
+        throw gui::exception("gui::localizer", "cannot open " + file_name);
+
+    return lua.safe_script(content->get_view(), sol::script_pass_on_error, "@" + file_name);
+}
 } // namespace
 
 localizer::localizer() {
@@ -701,17 +709,27 @@ char32_t localizer::get_fallback_code_point() const {
 }
 
 void localizer::load_translations(const std::string& folder_path) {
+    // Binary translation tables take precedence over Lua files, since they are faster to load
+    const auto try_load = [&](const std::string& language) {
+        for (const char* extension : {".lxt", ".lua"}) {
+            std::string language_file = folder_path + "/" + language + extension;
+            if (utils::file_exists(language_file)) {
+                load_translation_file(language_file);
+                return true;
+            }
+        }
+
+        return false;
+    };
+
     // First, look for an exact match
     for (const std::string& language : languages_) {
-        std::string language_file = folder_path + "/" + language + ".lua";
-        if (utils::file_exists(language_file)) {
-            load_translation_file(language_file);
+        if (try_load(language))
             return;
-        }
     }
 
     // If no exact match found, look for an approximate match (ignore region)
-    const auto files = utils::get_file_list(folder_path, false, "lua");
+    const auto files = utils::get_file_list(folder_path, false, ".lxt,.lua");
     for (const std::string& language : languages_) {
         auto iter = std::find_if(files.begin(), files.end(), [&](const std::string& file) {
             return file.size() == 8u && file.substr(0, 2) == language.substr(0, 2);
@@ -720,21 +738,21 @@ void localizer::load_translations(const std::string& folder_path) {
         if (iter == files.end())
             continue;
 
-        std::string language_file = folder_path + "/" + *iter;
-        load_translation_file(language_file);
-        return;
+        if (try_load(iter->substr(0, 4)))
+            return;
     }
 
     // If no match found, fall back to US english
-    std::string language_file = folder_path + "/enUS.lua";
-    if (utils::file_exists(language_file)) {
-        load_translation_file(language_file);
-        return;
-    }
+    try_load("enUS");
 }
 
 void localizer::load_translation_file(const std::string& file_name) try {
-    auto result = lua_.do_file(file_name);
+    if (utils::get_file_extension(file_name) == ".lxt") {
+        load_translation_table_(file_name);
+        return;
+    }
+
+    auto result = run_file(lua_, file_name);
     if (!result.valid()) {
         gui::out << gui::error << "gui::locale: " << result.get<sol::error>().what() << std::endl;
         return;
@@ -747,16 +765,22 @@ void localizer::load_translation_file(const std::string& file_name) try {
         return;
     }
 
+    const std::size_t load_index = load_count_++;
+
     table.for_each([&](const sol::object& key, const sol::object& value) {
         if (!key.is<std::string>())
             return;
         std::string ks = key.as<std::string>();
 
-        if (value.is<std::string>())
-            map_.insert(std::make_pair(std::hash<std::string>{}(ks), value.as<std::string>()));
-        else if (value.is<sol::protected_function>())
-            map_.insert(
-                std::make_pair(std::hash<std::string>{}(ks), value.as<sol::protected_function>()));
+        if (value.is<std::string>()) {
+            map_.insert_or_assign(
+                std::hash<std::string>{}(ks),
+                loaded_item{compile_format_(value.as<std::string>()), load_index});
+        } else if (value.is<sol::protected_function>()) {
+            map_.insert_or_assign(
+                std::hash<std::string>{}(ks),
+                loaded_item{value.as<sol::protected_function>(), load_index});
+        }
     });
 
     // Keep a copy so variables/functions remain alive
@@ -764,39 +788,258 @@ void localizer::load_translation_file(const std::string& file_name) try {
 } catch (const sol::error& err) {
     gui::out << gui::error << "gui::locale: " << err.what() << std::endl;
     return;
+} catch (const gui::exception& err) {
+    gui::out << gui::error << "gui::locale: " << err.what() << std::endl;
+    return;
+}
+
+void localizer::load_translation_table_(const std::string& file_name) {
+    loaded_table loaded{translation_table(file_name), {}, load_count_};
+
+    const std::size_t entry_count = loaded.table.get_entry_count();
+    loaded.items.reserve(entry_count);
+    for (std::size_t slot = 0; slot < entry_count; ++slot)
+        loaded.items.push_back(compile_format_(loaded.table.get_value(slot)));
+
+    tables_.push_back(std::move(loaded));
+    ++load_count_;
+}
+
+void localizer::compile_translation_file(
+    const std::string& lua_file_name, const std::string& table_file_name) const {
+    sol::state lua;
+    auto       result = run_file(lua, lua_file_name);
+    if (!result.valid())
+        throw gui::exception("gui::localizer", result.get<sol::error>().what());
+
+    sol::table table = lua["localize"];
+    if (table == sol::lua_nil)
+        throw gui::exception("gui::localizer", "no 'localize' table in " + lua_file_name);
+
+    std::vector<translation_table::entry> entries;
+    table.for_each([&](const sol::object& key, const sol::object& value) {
+        if (!key.is<std::string>())
+            return;
+
+        if (value.is<std::string>()) {
+            entries.emplace_back(key.as<std::string>(), value.as<std::string>());
+        } else {
+            gui::out << gui::warning << "gui::locale: translation '" << key.as<std::string>()
+                     << "' in " << lua_file_name
+                     << " is not a string and cannot be stored in a binary table" << std::endl;
+        }
+    });
+
+    translation_table::save(table_file_name, entries);
 }
 
 void localizer::clear_translations() {
     map_.clear();
+    tables_.clear();
+    load_count_ = 0u;
 }
 
 bool localizer::is_key_valid_(std::string_view key) const {
     return !key.empty() && key.front() == '{' && key.back() == '}';
 }
 
-localizer::map_type::const_iterator localizer::find_key_(std::string_view key) const {
+const localizer::mapped_item* localizer::find_key_(std::string_view key) const {
     auto substring = key.substr(1, key.size() - 2);
-    return map_.find(std::hash<std::string_view>{}(substring));
+
+    const auto iter = map_.find(std::hash<std::string_view>{}(substring));
+
+    // Binary tables loaded after the Lua file defining this key take precedence
+    for (auto table_iter = tables_.rbegin(); table_iter != tables_.rend(); ++table_iter) {
+        if (iter != map_.end() && table_iter->load_index < iter->second.load_index)
+            break;
+
+        if (auto slot = table_iter->table.find(substring))
+            return &table_iter->items[*slot];
+    }
+
+    if (iter != map_.end())
+        return &iter->second.item;
+
+    return nullptr;
 }
 
-std::string localizer::format_string(std::string_view message, sol::variadic_args args) const {
-    fmt::dynamic_format_arg_store<fmt::format_context> store;
-    for (auto&& arg : args) {
-        lxgui::utils::variant variant;
-        if (!arg.is<sol::lua_nil_t>())
-            variant = arg;
-
-        std::visit(
-            [&](auto& value) {
-                using inner_type = std::decay_t<decltype(value)>;
-                if constexpr (std::is_same_v<inner_type, lxgui::utils::empty>)
-                    store.push_back(static_cast<const char*>(""));
-                else
-                    store.push_back(value);
-            },
-            variant);
+localizer::format_template localizer::compile_format_(std::string_view message) {
+    format_template tpl;
+    tpl.source = message;
+
+    // Split the string into literal text and replacement fields, so the literal text
+    // does not need to be parsed again each time the string is formatted. Replacement
+    // fields are formatted one at a time, with their argument alone: they are rewritten
+    // to refer to the first argument, and the actual argument index is stored aside.
+    // Anything more complex (named arguments, nested fields) is left to fmtlib, by
+    // formatting the whole source string at runtime.
+    std::string literal;
+    std::size_t next_index   = 0u;
+    bool        has_implicit = false;
+    bool        has_explicit = false;
+
+    const auto flush_literal = [&]() {
+        if (literal.empty())
+            return;
+
+        tpl.literal_size += literal.size();
+        tpl.segments.push_back({std::move(literal), 0u, false});
+        literal.clear();
+    };
+
+    for (std::size_t pos = 0u; pos < message.size(); ++pos) {
+        const char c = message[pos];
+        if (c == '}') {
+            if (pos + 1u < message.size() && message[pos + 1u] == '}') {
+                literal += '}';
+                ++pos;
+                continue;
+            }
+
+            return tpl;
+        }
+
+        if (c != '{') {
+            literal += c;
+            continue;
+        }
+
+        if (pos + 1u < message.size() && message[pos + 1u] == '{') {
+            literal += '{';
+            ++pos;
+            continue;
+        }
+
+        const std::size_t end = message.find_first_of("{}", pos + 1u);
+        if (end == std::string_view::npos || message[end] != '}')
+            return tpl;
+
+        const std::string_view field = message.substr(pos + 1u, end - pos - 1u);
+        const std::size_t      colon = field.find(':');
+        const std::string_view id    = field.substr(0u, colon);
+
+        std::size_t index = 0u;
+        if (id.empty()) {
+            has_implicit = true;
+            index        = next_index++;
+        } else {
+            if (!std::all_of(id.begin(), id.end(), [](char d) { return d >= '0' && d <= '9'; }))
+                return tpl;
+
+            has_explicit = true;
+            index        = utils::from_string<std::size_t>(id).value_or(0u);
+        }
+
+        if (has_implicit && has_explicit)
+            return tpl;
+
+        flush_literal();
+
+        std::string text = "{0";
+        if (colon != std::string_view::npos)
+            text += field.substr(colon);
+        text += "}";
+
+        tpl.segments.push_back({std::move(text), index, true});
+        pos = end;
+    }
+
+    flush_literal();
+    tpl.is_compiled = true;
+    return tpl;
+}
+
+std::string
+localizer::format_template_(const format_template& tpl, fmt::format_args args) const {
+    if (!tpl.is_compiled)
+        return fmt::vformat(locale_, tpl.source, args);
+
+    if (tpl.segments.size() == 1u && !tpl.segments[0].is_field)
+        return tpl.segments[0].text;
+
+    std::string result;
+    result.reserve(tpl.literal_size + 16u * tpl.segments.size());
+
+    auto output = std::back_inserter(result);
+    for (const auto& segment : tpl.segments) {
+        if (segment.is_field) {
+            const auto arg = args.get(static_cast<int>(segment.index));
+            output = fmt::vformat_to(output, locale_, segment.text, fmt::format_args(&arg, 1));
+        } else
+            result += segment.text;
+    }
+
+    return result;
+}
+
+namespace {
+
+template<typename T>
+lxgui::utils::variant get_format_arg(const T& arg) {
+    lxgui::utils::variant variant;
+    if (!arg.template is<sol::lua_nil_t>())
+        variant = arg;
+
+    return variant;
+}
+
+template<typename T, typename F>
+void visit_format_arg(const T& arg, F&& function) {
+    std::visit(
+        [&](const auto& value) {
+            using inner_type = std::decay_t<decltype(value)>;
+            if constexpr (std::is_same_v<inner_type, lxgui::utils::empty>)
+                function(static_cast<const char*>(""));
+            else
+                function(value);
+        },
+        get_format_arg(arg));
+}
+
+void fill_format_arg_store(
+    fmt::dynamic_format_arg_store<fmt::format_context>& store, sol::variadic_args args) {
+    for (auto&& arg : args)
+        visit_format_arg(arg, [&](const auto& value) { store.push_back(value); });
+}
+
+} // namespace
+
+std::string
+localizer::format_template_(const format_template& tpl, sol::variadic_args args) const {
+    if (!tpl.is_compiled) {
+        fmt::dynamic_format_arg_store<fmt::format_context> store;
+        fill_format_arg_store(store, args);
+        return fmt::vformat(locale_, tpl.source, store);
     }
 
+    if (tpl.segments.size() == 1u && !tpl.segments[0].is_field)
+        return tpl.segments[0].text;
+
+    std::string result;
+    result.reserve(tpl.literal_size + 16u * tpl.segments.size());
+
+    // Each argument is formatted directly, without building an argument store
+    auto output = std::back_inserter(result);
+    for (const auto& segment : tpl.segments) {
+        if (!segment.is_field) {
+            result += segment.text;
+            continue;
+        }
+
+        if (segment.index >= static_cast<std::size_t>(args.size()))
+            throw fmt::format_error("argument not found");
+
+        visit_format_arg(args[static_cast<std::ptrdiff_t>(segment.index)], [&](const auto& value) {
+            output = fmt::vformat_to(output, locale_, segment.text, fmt::make_format_args(value));
+        });
+    }
+
+    return result;
+}
+
+std::string localizer::format_string(std::string_view message, sol::variadic_args args) const {
+    fmt::dynamic_format_arg_store<fmt::format_context> store;
+    fill_format_arg_store(store, args);
     return fmt::vformat(locale_, message, store);
 }
 
@@ -804,15 +1047,15 @@ std::string localizer::localize(std::string_view key, sol::variadic_args args) c
     if (!is_key_valid_(key))
         return std::string{key};
 
-    auto iter = find_key_(key);
-    if (iter == map_.end())
+    const mapped_item* item_ptr = find_key_(key);
+    if (!item_ptr)
         return std::string{key};
 
     return std::visit(
         [&](const auto& item) {
             using inner_type = std::decay_t<decltype(item)>;
-            if constexpr (std::is_same_v<inner_type, std::string>) {
-                return format_string(item, args);
+            if constexpr (std::is_same_v<inner_type, format_template>) {
+                return format_template_(item, args);
             } else {
                 auto result = item(args);
                 if (!result.valid()) {
@@ -831,7 +1074,7 @@ std::string localizer::localize(std::string_view key, sol::variadic_args args) c
                 return std::string{key};
             }
         },
-        iter->second);
+        *item_ptr);
 }
 
 } // namespace lxgui::gui
@@ -71,6 +71,12 @@
 * If a translatable string code is duplicated in two addons, it will get over-written
 * by whichever addon is loaded last.
 *
+* For large translation sets, a translation file can be converted into a binary
+* translation table with extension `.lxt` (see `localizer::compile_translation_file()`
+* in C++). When both `{lang}{REGION}.lxt` and `{lang}{REGION}.lua` exist in the same
+* folder, the binary table is loaded instead of the Lua script. Binary tables only
+* contain translation strings; translation functions (see below) must stay in Lua.
+*
 * **Formatted translation strings.** While most translation strings will be simple
 * static strings to be displayed as-is, such as `"Cancel"`, it is also possible to
 * display dynamic data inside the translated text. One example would be displaying
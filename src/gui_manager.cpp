@@ -9,13 +9,17 @@
 #include "lxgui/gui_localizer.hpp"
 #include "lxgui/gui_out.hpp"
 #include "lxgui/gui_region.hpp"
+#include "lxgui/gui_render_snapshot.hpp"
 #include "lxgui/gui_renderer.hpp"
 #include "lxgui/gui_root.hpp"
+#include "lxgui/gui_timer_scheduler.hpp"
 #include "lxgui/gui_virtual_root.hpp"
 #include "lxgui/input_dispatcher.hpp"
 #include "lxgui/input_source.hpp"
 #include "lxgui/input_window.hpp"
 #include "lxgui/input_world_dispatcher.hpp"
+#include "lxgui/utils_exception.hpp"
+#include "lxgui/utils_file_watcher.hpp"
 #include "lxgui/utils_std.hpp"
 
 #include <sstream>
@@ -44,6 +48,7 @@ manager::manager(
     input_dispatcher_(std::make_unique<input::dispatcher>(*input_source_)),
     world_input_dispatcher_(std::make_unique<input::world_dispatcher>()),
     event_emitter_(std::make_unique<gui::event_emitter>()),
+    timer_scheduler_(std::make_unique<timer_scheduler>()),
     factory_(std::make_unique<factory>(*this)),
     localizer_(std::make_unique<localizer>()) {
     set_interface_scaling_factor(1.0f);
@@ -125,6 +130,39 @@ void manager::clear_localization_directory_list() {
     localization_directory_list_.clear();
 }
 
+void manager::set_saved_variables_format(saved_variables_format format) {
+    saved_variables_format_ = format;
+}
+
+saved_variables_format manager::get_saved_variables_format() const {
+    return saved_variables_format_;
+}
+
+void manager::set_hot_reload_enabled(bool enabled) {
+    hot_reload_enabled_ = enabled;
+    renderer_->set_resource_retention_enabled(enabled);
+
+    if (!hot_reload_enabled_) {
+        file_watcher_ = nullptr;
+        modified_file_list_.clear();
+    }
+}
+
+bool manager::is_hot_reload_enabled() const {
+    return hot_reload_enabled_;
+}
+
+void manager::set_threaded_rendering_enabled(bool enabled) {
+    if (enabled && !snapshot_buffer_)
+        snapshot_buffer_ = std::make_unique<render_snapshot_buffer>();
+    else if (!enabled)
+        snapshot_buffer_ = nullptr;
+}
+
+bool manager::is_threaded_rendering_enabled() const {
+    return snapshot_buffer_ != nullptr;
+}
+
 sol::state& manager::get_lua() {
     return *lua_;
 }
@@ -142,6 +180,10 @@ void manager::read_files_() {
 
     addon_registry_ = std::make_unique<addon_registry>(
         get_lua(), get_localizer(), get_event_emitter(), get_root(), get_virtual_root());
+    addon_registry_->set_saved_variables_format(saved_variables_format_);
+
+    // Saved variables from the previous UI may still be written in the background
+    saved_variables_writer_.wait();
 
     for (const auto& directory : gui_directory_list_)
         addon_registry_->load_addon_directory(directory);
@@ -154,6 +196,21 @@ void manager::load_ui() {
     root_         = utils::make_owned<root>(*this);
     virtual_root_ = utils::make_owned<virtual_root>(*this, get_root().get_registry());
 
+    if (hot_reload_enabled_) {
+        // Start watching before reading files, so no modification is missed
+        try {
+            file_watcher_ = std::make_unique<utils::file_watcher>();
+            for (const auto& directory : gui_directory_list_)
+                file_watcher_->watch_directory(directory);
+            for (const auto& directory : localization_directory_list_)
+                file_watcher_->watch_directory(directory);
+        } catch (const utils::exception& e) {
+            gui::out << gui::warning << e.get_description() << std::endl;
+            gui::out << gui::warning << "gui::manager: Hot reload will be disabled." << std::endl;
+            file_watcher_ = nullptr;
+        }
+    }
+
     create_lua_();
     read_files_();
 
@@ -171,7 +228,10 @@ void manager::close_ui_now() {
         return;
 
     if (addon_registry_)
-        addon_registry_->save_variables();
+        addon_registry_->save_variables(saved_variables_writer_);
+
+    // Timers may refer to regions and to the Lua state
+    timer_scheduler_->clear();
 
     virtual_root_   = nullptr;
     root_           = nullptr;
@@ -180,6 +240,10 @@ void manager::close_ui_now() {
 
     localizer_->clear_translations();
 
+    // The snapshots keep materials alive, and must not render the closed UI
+    if (snapshot_buffer_)
+        snapshot_buffer_->clear();
+
     is_loaded_          = false;
     is_first_iteration_ = true;
     close_ui_flag_      = false;
@@ -193,14 +257,26 @@ void manager::reload_ui() {
 void manager::reload_ui_now() {
     gui::out << "Closing UI..." << std::endl;
     close_ui_now();
+
+    // Modified textures and fonts must be loaded again
+    for (const auto& file : modified_file_list_)
+        renderer_->release_resources(file);
+    modified_file_list_.clear();
+
     gui::out << "Done. Loading UI..." << std::endl;
     load_ui();
+    renderer_->release_unused_resources();
     // Call update again, otherwise we may call render() with no prior update() call.
     update_ui(0.0);
     gui::out << "Done." << std::endl;
 }
 
 void manager::render_ui() const {
+    if (snapshot_buffer_) {
+        snapshot_buffer_->submit(*renderer_);
+        return;
+    }
+
     renderer_->begin();
 
     root_->render();
@@ -212,7 +288,33 @@ bool manager::is_loaded() const {
     return is_loaded_;
 }
 
+void manager::update_hot_reload_() {
+    if (!hot_reload_enabled_ || !file_watcher_ || !addon_registry_)
+        return;
+
+    std::vector<std::string> file_list = file_watcher_->get_modified_files();
+    if (file_list.empty())
+        return;
+
+    if (!addon_registry_->reload_files(file_list)) {
+        modified_file_list_ = std::move(file_list);
+        reload_ui_flag_     = true;
+    }
+}
+
 void manager::update_ui(float delta) {
+    if (!close_ui_flag_ && !reload_ui_flag_)
+        update_hot_reload_();
+
+    if (snapshot_buffer_) {
+        render_snapshot& snapshot = snapshot_buffer_->get_back_snapshot();
+        snapshot.clear();
+        renderer_->begin_snapshot(snapshot);
+    }
+
+    DEBUG_LOG(" Update timers...");
+    timer_scheduler_->update(delta);
+
     DEBUG_LOG(" Update regions...");
     root_->update(delta);
 
@@ -224,6 +326,16 @@ void manager::update_ui(float delta) {
         root_->notify_hovered_frame_dirty();
     }
 
+    if (snapshot_buffer_) {
+        DEBUG_LOG(" Record render snapshot...");
+        renderer_->begin();
+        root_->render();
+        renderer_->end();
+
+        renderer_->end_snapshot();
+        snapshot_buffer_->swap();
+    }
+
     if (close_ui_flag_) {
         close_ui_now();
     } else if (reload_ui_flag_) {
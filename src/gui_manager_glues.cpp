@@ -1,4 +1,5 @@
 #include "lxgui/gui_addon_registry.hpp"
+#include "lxgui/gui_animation.hpp"
 #include "lxgui/gui_factory.hpp"
 #include "lxgui/gui_frame.hpp"
 #include "lxgui/gui_key_binder.hpp"
@@ -8,6 +9,7 @@
 #include "lxgui/gui_out.hpp"
 #include "lxgui/gui_region.hpp"
 #include "lxgui/gui_region_tpl.hpp"
+#include "lxgui/gui_timer_scheduler.hpp"
 #include "lxgui/gui_virtual_registry.hpp"
 #include "lxgui/gui_virtual_root.hpp"
 #include "lxgui/input_keys.hpp"
@@ -33,7 +35,7 @@ void manager::create_lua_() {
     lua_ = std::unique_ptr<sol::state>(new sol::state());
     lua_->open_libraries(
         sol::lib::base, sol::lib::math, sol::lib::table, sol::lib::io, sol::lib::os,
-        sol::lib::string, sol::lib::debug);
+        sol::lib::string, sol::lib::debug, sol::lib::coroutine);
 
     auto& lua = *lua_;
 
@@ -77,6 +79,52 @@ void manager::create_lua_() {
      */
     lua.set_function("delete_frame", [&](frame& frame) { frame.destroy(); });
 
+    /** Returns a frame from the frame pool, or creates a new one if none is available.
+     * This is equivalent to @{create_frame}, except that frames previously given back with
+     * @{release_frame} (with the same type and inheritance) are re-used. A re-used frame
+     * keeps the name it was first created with, which may differ from the requested name.
+     * @function acquire_frame
+     * @tparam string type The frame type
+     * @tparam string name The name of the frame, if a new frame needs to be created
+     * @tparam Frame parent The parent of the frame (optional)
+     * @tparam string inheritance Comma-separated list of templates (optional)
+     * @treturn Frame The frame
+     */
+    lua.set_function(
+        "acquire_frame",
+        [&](const std::string& type, const std::string& name, sol::optional<frame&> parent,
+            sol::optional<std::string> inheritance) -> sol::object {
+            frame_core_attributes attr;
+            attr.name        = name;
+            attr.object_type = type;
+            if (parent.has_value())
+                attr.parent = observer_from(&parent.value());
+            if (inheritance.has_value()) {
+                attr.inheritance =
+                    get_virtual_root().get_registry().get_virtual_region_list(inheritance.value());
+            }
+
+            utils::observer_ptr<frame> new_frame =
+                root_->get_frame_pool().acquire_frame(std::move(attr));
+
+            if (new_frame) {
+                new_frame->set_addon(get_addon_registry()->get_current_addon());
+                new_frame->notify_loaded();
+                return get_lua()[new_frame->get_name()];
+            } else
+                return sol::lua_nil;
+        });
+
+    /** Gives a frame back to the frame pool, so it can be re-used by @{acquire_frame}.
+     * The frame is hidden, removed from its parent, and its children, regions, scripts,
+     * and properties are reset. It must not be used after this call, until it is returned
+     * again by @{acquire_frame}.
+     * @function release_frame
+     * @tparam Frame frame The frame to release
+     */
+    lua.set_function(
+        "release_frame", [&](frame& frame) { root_->get_frame_pool().release_frame(frame); });
+
     /** @function register_key_binding
      */
     lua.set_function("register_key_binding", [&](std::string id, sol::protected_function function) {
@@ -116,9 +164,129 @@ void manager::create_lua_() {
     lua.set_function(
         "get_interface_scaling_factor", [&]() { return get_interface_scaling_factor(); });
 
+    auto report_lua_error = [this](const std::string& err) {
+        gui::out << gui::error << err << std::endl;
+        get_event_emitter().fire_event("LUA_ERROR", {err});
+    };
+
+    // Timers can be created from a coroutine (see wait()), which is suspended or finished when
+    // the timer fires; the function is therefore kept on the main Lua thread
+    auto make_timer_function = [report_lua_error](sol::main_protected_function function) {
+        return [report_lua_error, function = std::move(function)]() {
+            auto result = function();
+            if (!result.valid())
+                report_lua_error(result.get<sol::error>().what());
+        };
+    };
+
+    /** Calls a function once, after a delay.
+     * The function is called during the first update after the delay has elapsed. Unlike an
+     * "OnUpdate" script counting the elapsed time, a pending timer costs nothing per frame.
+     * All timers are cancelled when the UI is closed or re-loaded.
+     * @function run_after
+     * @tparam number delay The delay (in seconds)
+     * @tparam function func The function to call
+     * @treturn number The identifier of the timer, to use with @{cancel_timer}
+     */
+    lua.set_function(
+        "run_after", [&, make_timer_function](double delay, sol::main_protected_function func) {
+            return timer_scheduler_->run_after(delay, make_timer_function(std::move(func)));
+        });
+
+    /** Calls a function repeatedly, at a regular interval.
+     * The function is called at most once per update: intervals missed because of a slow
+     * update are skipped. With an interval of zero, the function is called on every update.
+     * @function run_every
+     * @tparam number interval The interval between two calls (in seconds)
+     * @tparam function func The function to call
+     * @treturn number The identifier of the timer, to use with @{cancel_timer}
+     */
+    lua.set_function(
+        "run_every", [&, make_timer_function](double interval, sol::main_protected_function func) {
+            return timer_scheduler_->run_every(interval, make_timer_function(std::move(func)));
+        });
+
+    /** Cancels a timer created with @{run_after} or @{run_every}.
+     * This can be called from the timer's own function.
+     * @function cancel_timer
+     * @tparam number id The identifier of the timer
+     * @treturn boolean 'true' if the timer was cancelled, 'false' if it was not scheduled
+     */
+    lua.set_function(
+        "cancel_timer", [&](timer_scheduler::timer_id id) { return timer_scheduler_->cancel(id); });
+
+    /** Runs a function as a coroutine, which can pause itself with @{wait}.
+     * The function starts immediately, and runs until it returns or calls @{wait}. Errors
+     * are reported in the same way as errors in scripts.
+     * @function run_coroutine
+     * @tparam function func The function to run
+     * @param ... Arguments given to the function
+     * @treturn thread The coroutine
+     */
+
+    /** Pauses the current coroutine for some time.
+     * This can only be called from a coroutine started with @{run_coroutine}. The coroutine
+     * is resumed by a timer (see @{run_after}), so waiting costs nothing per frame.
+     * @function wait
+     * @tparam number delay The delay (in seconds)
+     */
+
+    // These are written in Lua, since coroutines cannot yield across a C++ function call
+    sol::load_result coroutine_chunk = lua.load(
+        R"lua(
+        local run_after, report_error = ...
+        local create, resume, running, yield = coroutine.create, coroutine.resume,
+            coroutine.running, coroutine.yield
+
+        local function resume_checked(co, ...)
+            local ok, err = resume(co, ...)
+            if not ok then
+                report_error(tostring(err))
+            end
+        end
+
+        function run_coroutine(func, ...)
+            local co = create(func)
+            resume_checked(co, ...)
+            return co
+        end
+
+        function wait(delay)
+            local co, is_main = running()
+            if co == nil or is_main then
+                error("wait() must be called from a coroutine (see run_coroutine)", 2)
+            end
+
+            run_after(delay, function() resume_checked(co) end)
+            yield()
+        end
+        )lua",
+        "=lxgui_coroutines");
+
+    if (!coroutine_chunk.valid()) {
+        throw gui::exception(
+            "gui::manager", "cannot register coroutine functions: " +
+                                std::string(coroutine_chunk.get<sol::error>().what()));
+    }
+
+    sol::protected_function coroutine_function = coroutine_chunk;
+
+    auto coroutine_result = coroutine_function(
+        lua["run_after"].get<sol::protected_function>(),
+        [report_lua_error](const std::string& err) { report_lua_error(err); });
+
+    if (!coroutine_result.valid()) {
+        throw gui::exception(
+            "gui::manager", "cannot register coroutine functions: " +
+                                std::string(coroutine_result.get<sol::error>().what()));
+    }
+
     // Register localization functions
     localizer_->register_on_lua(lua);
 
+    // Register animation groups
+    animation_group::register_on_lua(lua);
+
     // Register all region types
     factory_->register_on_lua(lua);
 
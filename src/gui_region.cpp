@@ -1,6 +1,7 @@
 #include "lxgui/gui_region.hpp"
 
 #include "lxgui/gui_addon.hpp"
+#include "lxgui/gui_factory.hpp"
 #include "lxgui/gui_frame.hpp"
 #include "lxgui/gui_layered_region.hpp"
 #include "lxgui/gui_manager.hpp"
@@ -33,6 +34,8 @@ region::region(utils::control_block& block, manager& mgr, const region_core_attr
 }
 
 region::~region() {
+    get_manager().get_factory().notify_region_destroyed(*this);
+
     if (!is_virtual_) {
         // Tell this region's anchor parents that it is no longer anchored to them
         for (auto& a : anchor_list_) {
@@ -47,8 +50,7 @@ region::~region() {
         // Replace anchors pointing to this region by absolute anchors
         // (need to copy the anchored object list, because the objects will attempt to
         // modify it when un-anchored, which would invalidate our iteration)
-        std::vector<utils::observer_ptr<region>> temp_anchored_object_list =
-            std::move(anchored_object_list_);
+        anchored_object_list temp_anchored_object_list = std::move(anchored_object_list_);
         for (const auto& obj : temp_anchored_object_list) {
             if (!obj)
                 continue;
@@ -121,6 +123,16 @@ std::string region::serialize(const std::string& tab) const {
     str << tab << "  # Shown      : " << is_shown_ << "\n";
     str << tab << "  # Abs width  : " << dimensions_.x << "\n";
     str << tab << "  # Abs height : " << dimensions_.y << "\n";
+    if (!animation_group_list_.empty()) {
+        str << tab << "  # Animations :\n";
+        str << tab << "  |-###\n";
+        for (const auto& group : animation_group_list_) {
+            str << tab << "  |   # " << group->get_name() << " ("
+                << group->get_animations().size() << " animations"
+                << std::string(group->is_playing() ? ", playing" : "") << ")\n";
+        }
+        str << tab << "  |-###\n";
+    }
 
     return str.str();
 }
@@ -135,6 +147,11 @@ void region::copy_from(const region& obj) {
             this->set_anchor(a->get_data());
         }
     }
+
+    for (const auto& group : obj.animation_group_list_) {
+        if (auto new_group = this->create_animation_group(group->get_name()))
+            new_group->copy_from(*group);
+    }
 }
 
 const std::string& region::get_name() const {
@@ -169,10 +186,14 @@ float region::get_effective_alpha() const {
 void region::set_alpha(float alpha) {
     if (alpha_ != alpha) {
         alpha_ = alpha;
-        notify_renderer_need_redraw();
+        notify_alpha_changed_();
     }
 }
 
+void region::notify_alpha_changed_() {
+    notify_renderer_need_redraw();
+}
+
 void region::show() {
     if (is_shown_)
         return;
@@ -787,12 +808,122 @@ bool region::is_manually_inherited() const {
 
 void region::notify_renderer_need_redraw() {}
 
-const std::vector<utils::observer_ptr<region>>& region::get_anchored_objects() const {
+utils::observer_ptr<animation_group> region::create_animation_group(const std::string& name) {
+    if (auto existing = get_animation_group(name))
+        return existing;
+
+    animation_group_list_.push_back(utils::make_owned<animation_group>(*this, name));
+    return animation_group_list_.back();
+}
+
+utils::observer_ptr<animation_group> region::get_animation_group(const std::string& name) {
+    for (const auto& group : animation_group_list_) {
+        if (group->get_name() == name)
+            return group;
+    }
+
+    return nullptr;
+}
+
+utils::observer_ptr<const animation_group>
+region::get_animation_group(const std::string& name) const {
+    return const_cast<region*>(this)->get_animation_group(name);
+}
+
+void region::stop_animations() {
+    for (const auto& group : animation_group_list_)
+        group->stop();
+}
+
+const std::optional<matrix4f>& region::get_animation_transform() const {
+    return animation_transform_;
+}
+
+std::optional<color> region::get_animation_color_() const {
+    return std::nullopt;
+}
+
+void region::set_animation_color_(const color&) {}
+
+void region::set_animation_transform_(const std::optional<matrix4f>& transform) {
+    if (!transform.has_value() && !animation_transform_.has_value())
+        return;
+
+    animation_transform_ = transform;
+    notify_animation_transform_changed_();
+}
+
+void region::apply_animation_groups_() {
+    // Combine all the groups currently applied to this region, in order of creation
+    float                   alpha     = 1.0f;
+    bool                    has_alpha = false;
+    std::optional<color>    col;
+    std::optional<matrix4f> transform;
+
+    for (const auto& group : animation_group_list_) {
+        if (!group || !group->is_applied_)
+            continue;
+
+        if (group->has_alpha_) {
+            alpha *= group->alpha_;
+            has_alpha = true;
+        }
+
+        if (group->color_.has_value())
+            col = group->color_;
+
+        if (group->has_transform_) {
+            if (transform.has_value())
+                transform = transform.value() * group->transform_;
+            else
+                transform = group->transform_;
+        }
+    }
+
+    // Remember the state of the region before the first group modifies it, to restore it
+    // when no group modifies it anymore
+    if (has_alpha) {
+        if (!animation_base_alpha_.has_value())
+            animation_base_alpha_ = get_alpha();
+
+        set_alpha(animation_base_alpha_.value() * alpha);
+    } else if (animation_base_alpha_.has_value()) {
+        set_alpha(animation_base_alpha_.value());
+        animation_base_alpha_ = std::nullopt;
+    }
+
+    if (col.has_value()) {
+        if (!animation_base_color_.has_value())
+            animation_base_color_ = get_animation_color_();
+
+        // Regions without a color cannot have color animations
+        if (animation_base_color_.has_value())
+            set_animation_color_(col.value());
+    } else if (animation_base_color_.has_value()) {
+        set_animation_color_(animation_base_color_.value());
+        animation_base_color_ = std::nullopt;
+    }
+
+    set_animation_transform_(transform);
+}
+
+void region::notify_animation_transform_changed_() {
+    // The transformed region may be drawn outside of its borders: redraw the whole parent
+    if (parent_)
+        parent_->notify_renderer_need_redraw();
+}
+
+const region::anchored_object_list& region::get_anchored_objects() const {
     return anchored_object_list_;
 }
 
 void region::notify_loaded() {
     is_loaded_ = true;
+
+    for (const auto& group : animation_group_list_) {
+        if (group->is_auto_play())
+            group->play();
+    }
 }
 
 bool region::is_loaded() const {
@@ -185,6 +185,29 @@ void region::register_on_lua(sol::state& lua) {
      */
     type.set_function("clear_all_anchors", member_function<&region::clear_all_anchors>());
 
+    /** Creates a new animation group for this region.
+     * If a group already exists with this name, it is returned instead.
+     * @function create_animation_group
+     * @tparam string name The name of the group
+     * @treturn AnimationGroup The group
+     */
+    type.set_function(
+        "create_animation_group", member_function<&region::create_animation_group>());
+
+    /** Returns one of this region's animation groups.
+     * @function get_animation_group
+     * @tparam string name The name of the group
+     * @treturn AnimationGroup The group, or nil if none
+     */
+    type.set_function("get_animation_group", [](region& self, const std::string& name) {
+        return self.get_animation_group(name);
+    });
+
+    /** Stops all the animation groups of this region.
+     * @function stop_animations
+     */
+    type.set_function("stop_animations", member_function<&region::stop_animations>());
+
     /** @function get_bottom
      */
     type.set_function("get_bottom", member_function<&region::get_bottom>());
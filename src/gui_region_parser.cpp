@@ -124,10 +124,79 @@ void region::parse_anchor_node_(const layout_node& node) {
     }
 }
 
+void region::parse_animations_node_(const layout_node& node) {
+    const layout_node* animations_node = node.try_get_child("Animations");
+    if (!animations_node)
+        return;
+
+    for (const auto& group_node : animations_node->get_children()) {
+        if (group_node.get_name() != "AnimationGroup" && group_node.get_name() != "") {
+            gui::out << gui::warning << group_node.get_location() << ": "
+                     << "unexpected node '" << group_node.get_name() << "'; ignored."
+                     << std::endl;
+            continue;
+        }
+
+        const auto name = group_node.try_get_attribute_value<std::string>("name");
+        if (!name.has_value()) {
+            gui::out << gui::warning << group_node.get_location() << ": "
+                     << "AnimationGroup node must have a name; ignored." << std::endl;
+            continue;
+        }
+
+        auto group = create_animation_group(name.value());
+
+        if (const auto attr = group_node.try_get_attribute_value<animation_loop>("looping"))
+            group->set_looping(attr.value());
+        if (const auto attr = group_node.try_get_attribute_value<bool>("autoPlay"))
+            group->set_auto_play(attr.value());
+
+        for (const auto& anim_node : group_node.get_children()) {
+            animation   anim;
+            const auto& type = anim_node.get_name();
+            if (type == "Alpha") {
+                anim.type       = animation_type::alpha;
+                anim.from_alpha = anim_node.get_attribute_value_or<float>("fromAlpha", 1.0f);
+                anim.to_alpha   = anim_node.get_attribute_value_or<float>("toAlpha", 1.0f);
+            } else if (type == "Translation") {
+                anim.type   = animation_type::translation;
+                anim.offset = vector2f(
+                    anim_node.get_attribute_value_or<float>("offsetX", 0.0f),
+                    anim_node.get_attribute_value_or<float>("offsetY", 0.0f));
+            } else if (type == "Scale") {
+                anim.type       = animation_type::scale;
+                anim.from_scale = vector2f(
+                    anim_node.get_attribute_value_or<float>("fromScaleX", 1.0f),
+                    anim_node.get_attribute_value_or<float>("fromScaleY", 1.0f));
+                anim.to_scale = vector2f(
+                    anim_node.get_attribute_value_or<float>("toScaleX", 1.0f),
+                    anim_node.get_attribute_value_or<float>("toScaleY", 1.0f));
+            } else if (type == "Color") {
+                anim.type = animation_type::color;
+                if (const layout_node* color_node = anim_node.try_get_child("FromColor"))
+                    anim.from_color = parse_color_node_(*color_node);
+                if (const layout_node* color_node = anim_node.try_get_child("ToColor"))
+                    anim.to_color = parse_color_node_(*color_node);
+            } else {
+                gui::out << gui::warning << anim_node.get_location() << ": "
+                         << "unexpected node '" << type << "'; ignored." << std::endl;
+                continue;
+            }
+
+            anim.duration    = anim_node.get_attribute_value_or<float>("duration", 0.0f);
+            anim.start_delay = anim_node.get_attribute_value_or<float>("startDelay", 0.0f);
+            anim.curve       = anim_node.get_attribute_value_or<easing>("easing", easing::linear);
+
+            group->add_animation(anim);
+        }
+    }
+}
+
 void region::parse_layout(const layout_node& node) {
     parse_attributes_(node);
     parse_size_node_(node);
     parse_anchor_node_(node);
+    parse_animations_node_(node);
 }
 
 void region::parse_attributes_(const layout_node& node) {
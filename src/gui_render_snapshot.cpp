@@ -0,0 +1,182 @@
+#include "lxgui/gui_render_snapshot.hpp"
+
+#include "lxgui/gui_material.hpp"
+#include "lxgui/gui_renderer.hpp"
+
+#include <algorithm>
+
+namespace lxgui::gui {
+
+void render_snapshot::clear() {
+    command_list_.clear();
+    quad_list_.clear();
+    culled_frame_count_  = 0u;
+    culled_region_count_ = 0u;
+}
+
+bool render_snapshot::is_empty() const {
+    return command_list_.empty();
+}
+
+std::size_t render_snapshot::get_command_count() const {
+    return command_list_.size();
+}
+
+std::size_t render_snapshot::get_quad_count() const {
+    return quad_list_.size();
+}
+
+render_snapshot::command& render_snapshot::add_command_(command_type type) {
+    auto& cmd = command_list_.emplace_back();
+    cmd.type  = type;
+    return cmd;
+}
+
+void render_snapshot::add_quads_(
+    const material* mat, const std::vector<std::array<vertex, 4>>& quad_list) {
+    // The quads of the last command are always at the end of the list, and can be extended
+    if (!command_list_.empty()) {
+        auto& last = command_list_.back();
+        if (last.type == command_type::render_quads && last.mat.get() == mat) {
+            quad_list_.insert(quad_list_.end(), quad_list.begin(), quad_list.end());
+            last.num_quads += quad_list.size();
+            return;
+        }
+    }
+
+    auto& cmd = add_command_(command_type::render_quads);
+    if (mat)
+        cmd.mat = mat->shared_from_this();
+    cmd.first_quad = quad_list_.size();
+    cmd.num_quads  = quad_list.size();
+
+    quad_list_.insert(quad_list_.end(), quad_list.begin(), quad_list.end());
+}
+
+void render_snapshot::prepend_target_passes_(const render_snapshot& previous) {
+    // A pass which starts by clearing its target does not depend on earlier passes
+    auto is_full_pass = [](const std::vector<command>& list, std::size_t index) {
+        for (++index; index < list.size(); ++index) {
+            if (list[index].type == command_type::clear)
+                return true;
+            if (list[index].type != command_type::set_view)
+                return false;
+        }
+
+        return false;
+    };
+
+    std::vector<std::shared_ptr<render_target>> redrawn_list;
+    for (std::size_t index = 0u; index < command_list_.size(); ++index) {
+        const auto& cmd = command_list_[index];
+        if (cmd.type == command_type::begin && cmd.target && is_full_pass(command_list_, index))
+            redrawn_list.push_back(cmd.target);
+    }
+
+    std::vector<command>               command_list;
+    std::vector<std::array<vertex, 4>> quad_list;
+
+    bool is_copied = false;
+    for (const auto& cmd : previous.command_list_) {
+        if (cmd.type == command_type::begin) {
+            is_copied = cmd.target != nullptr &&
+                        std::find(redrawn_list.begin(), redrawn_list.end(), cmd.target) ==
+                            redrawn_list.end();
+        }
+
+        if (!is_copied)
+            continue;
+
+        auto& copy = command_list.emplace_back(cmd);
+        if (cmd.type == command_type::render_quads) {
+            const auto first = previous.quad_list_.begin() +
+                               static_cast<std::ptrdiff_t>(cmd.first_quad);
+            copy.first_quad  = quad_list.size();
+            quad_list.insert(
+                quad_list.end(), first, first + static_cast<std::ptrdiff_t>(cmd.num_quads));
+        }
+
+        if (cmd.type == command_type::end)
+            is_copied = false;
+    }
+
+    if (command_list.empty())
+        return;
+
+    for (auto& cmd : command_list_) {
+        if (cmd.type == command_type::render_quads)
+            cmd.first_quad += quad_list.size();
+    }
+
+    command_list.insert(command_list.end(), command_list_.begin(), command_list_.end());
+    quad_list.insert(quad_list.end(), quad_list_.begin(), quad_list_.end());
+
+    command_list_ = std::move(command_list);
+    quad_list_    = std::move(quad_list);
+}
+
+render_snapshot& render_snapshot_buffer::get_back_snapshot() {
+    // Only the update thread changes the front index, no need to lock
+    return snapshot_list_[1u - front_index_];
+}
+
+void render_snapshot_buffer::swap() {
+#if defined(LXGUI_ENABLE_MULTITHREADING)
+    std::unique_lock<std::mutex> lock(mutex_);
+    condition_.wait(lock, [&]() { return !is_submitting_; });
+#endif
+
+    if (has_front_ && !is_front_submitted_) {
+        snapshot_list_[1u - front_index_].prepend_target_passes_(snapshot_list_[front_index_]);
+    }
+
+    front_index_        = 1u - front_index_;
+    has_front_          = true;
+    is_front_submitted_ = false;
+}
+
+bool render_snapshot_buffer::submit(renderer& rdr) {
+    std::size_t index = 0u;
+
+    {
+#if defined(LXGUI_ENABLE_MULTITHREADING)
+        std::lock_guard<std::mutex> lock(mutex_);
+#endif
+        if (!has_front_)
+            return false;
+
+        index          = front_index_;
+        is_submitting_ = true;
+    }
+
+    rdr.submit_snapshot(snapshot_list_[index]);
+
+    {
+#if defined(LXGUI_ENABLE_MULTITHREADING)
+        std::lock_guard<std::mutex> lock(mutex_);
+#endif
+        is_submitting_      = false;
+        is_front_submitted_ = true;
+    }
+
+#if defined(LXGUI_ENABLE_MULTITHREADING)
+    condition_.notify_all();
+#endif
+
+    return true;
+}
+
+void render_snapshot_buffer::clear() {
+#if defined(LXGUI_ENABLE_MULTITHREADING)
+    std::unique_lock<std::mutex> lock(mutex_);
+    condition_.wait(lock, [&]() { return !is_submitting_; });
+#endif
+
+    for (auto& snapshot : snapshot_list_)
+        snapshot.clear();
+
+    has_front_          = false;
+    is_front_submitted_ = false;
+}
+
+} // namespace lxgui::gui
@@ -1,14 +1,50 @@
 #include "lxgui/gui_renderer.hpp"
 
 #include "lxgui/gui_atlas.hpp"
+#include "lxgui/gui_exception.hpp"
 #include "lxgui/gui_out.hpp"
 #include "lxgui/gui_quad.hpp"
+#include "lxgui/gui_render_snapshot.hpp"
 #include "lxgui/gui_render_target.hpp"
+#include "lxgui/utils_file_system.hpp"
 #include "lxgui/utils_string.hpp"
 
+#include <algorithm>
+
 namespace lxgui::gui {
 
+namespace {
+// The recording state is per thread, so that the same renderer can submit a snapshot on one
+// thread while the next snapshot is recorded on another thread
+struct snapshot_recorder {
+    const renderer*         owner    = nullptr;
+    render_snapshot*        snapshot = nullptr;
+    matrix4f                view     = matrix4f::identity;
+    std::optional<bounds2f> view_rect;
+};
+
+thread_local snapshot_recorder recorder;
+
+bounds2f get_view_rect(const matrix4f& view_matrix) {
+    // The visible area is the inverse projection of the normalized device coordinates
+    const matrix4f inverse_view = matrix4f::invert(view_matrix);
+    const vector2f corner1      = vector2f(-1.0f, -1.0f) * inverse_view;
+    const vector2f corner2      = vector2f(1.0f, 1.0f) * inverse_view;
+
+    return bounds2f(
+        std::min(corner1.x, corner2.x), std::max(corner1.x, corner2.x),
+        std::min(corner1.y, corner2.y), std::max(corner1.y, corner2.y));
+}
+} // namespace
+
 void renderer::begin(std::shared_ptr<render_target> target) {
+    if (auto* snapshot = get_recorded_snapshot_()) {
+        snapshot->add_command_(render_snapshot::command_type::begin).target = std::move(target);
+        recorder.view      = matrix4f::identity;
+        recorder.view_rect = std::nullopt;
+        return;
+    }
+
     if (is_quad_batching_enabled()) {
         current_material_ = nullptr;
 
@@ -31,14 +67,29 @@ void renderer::begin(std::shared_ptr<render_target> target) {
         }
     }
 
+    view_rect_             = std::nullopt;
+    current_render_target_ = target;
+
     begin_(std::move(target));
 }
 
 void renderer::end() {
+    if (auto* snapshot = get_recorded_snapshot_()) {
+        snapshot->add_command_(render_snapshot::command_type::end);
+        recorder.view_rect = std::nullopt;
+        return;
+    }
+
     if (is_quad_batching_enabled()) {
         flush_quad_batch();
     }
 
+    set_scissor(std::nullopt);
+    set_distance_field_threshold(std::nullopt);
+
+    view_rect_             = std::nullopt;
+    current_render_target_ = nullptr;
+
     end_();
 }
 
@@ -47,6 +98,11 @@ void renderer::reset_counters() {
     last_frame_vertex_count_ = vertex_count_;
     batch_count_             = 0;
     vertex_count_            = 0;
+
+    last_frame_culled_frame_count_  = culled_frame_count_;
+    last_frame_culled_region_count_ = culled_region_count_;
+    culled_frame_count_             = 0;
+    culled_region_count_            = 0;
 }
 
 std::size_t renderer::get_batch_count() const {
@@ -57,12 +113,102 @@ std::size_t renderer::get_vertex_count() const {
     return last_frame_vertex_count_;
 }
 
+std::size_t renderer::get_culled_frame_count() const {
+    return last_frame_culled_frame_count_;
+}
+
+std::size_t renderer::get_culled_region_count() const {
+    return last_frame_culled_region_count_;
+}
+
+void renderer::notify_culled_frame() {
+    if (auto* snapshot = get_recorded_snapshot_())
+        ++snapshot->culled_frame_count_;
+    else
+        ++culled_frame_count_;
+}
+
+void renderer::notify_culled_region() {
+    if (auto* snapshot = get_recorded_snapshot_())
+        ++snapshot->culled_region_count_;
+    else
+        ++culled_region_count_;
+}
+
+bool renderer::is_in_view(const bounds2f& rect) const {
+    const std::optional<bounds2f>& view_rect =
+        get_recorded_snapshot_() ? recorder.view_rect : view_rect_;
+
+    if (!view_rect.has_value())
+        return true;
+
+    return view_rect->overlaps(rect);
+}
+
 void renderer::set_view(const matrix4f& view_matrix) {
+    if (auto* snapshot = get_recorded_snapshot_()) {
+        snapshot->add_command_(render_snapshot::command_type::set_view).matrix = view_matrix;
+        recorder.view      = view_matrix;
+        recorder.view_rect = get_view_rect(view_matrix);
+        return;
+    }
+
     if (is_quad_batching_enabled()) {
         flush_quad_batch();
     }
 
     set_view_(view_matrix);
+
+    view_rect_ = get_view_rect(view_matrix);
+}
+
+matrix4f renderer::get_view() const {
+    if (get_recorded_snapshot_())
+        return recorder.view;
+
+    return get_view_();
+}
+
+void renderer::set_scissor(const std::optional<bounds2f>& rect) {
+    if (!is_scissor_supported())
+        return;
+
+    if (auto* snapshot = get_recorded_snapshot_()) {
+        snapshot->add_command_(render_snapshot::command_type::set_scissor).rect = rect;
+        return;
+    }
+
+    if (!rect.has_value() && !scissor_enabled_)
+        return;
+
+    if (is_quad_batching_enabled()) {
+        flush_quad_batch();
+    }
+
+    scissor_enabled_ = rect.has_value();
+    set_scissor_(rect);
+}
+
+void renderer::set_distance_field_threshold(const std::optional<float>& threshold) {
+    if (!is_distance_field_supported())
+        return;
+
+    if (auto* snapshot = get_recorded_snapshot_()) {
+        auto& cmd =
+            snapshot->add_command_(render_snapshot::command_type::set_distance_field_threshold);
+        cmd.threshold = threshold;
+        return;
+    }
+
+    if (threshold == distance_field_threshold_)
+        return;
+
+    if (is_quad_batching_enabled()) {
+        flush_quad_batch();
+    }
+
+    distance_field_threshold_ = threshold;
+    set_distance_field_threshold_(threshold);
 }
 
 void renderer::render_quad(const quad& q) {
@@ -91,6 +237,11 @@ void renderer::render_quads(
     if (quad_list.empty())
         return;
 
+    if (auto* snapshot = get_recorded_snapshot_()) {
+        snapshot->add_quads_(mat, quad_list);
+        return;
+    }
+
     if (!is_quad_batching_enabled()) {
         // Render immediately
         vertex_count_ += quad_list.size() * 6;
@@ -99,6 +250,11 @@ void renderer::render_quads(
         return;
     }
 
+    batch_quads_(mat, quad_list.data(), quad_list.size());
+}
+
+void renderer::batch_quads_(
+    const material* mat, const std::array<vertex, 4>* quads, std::size_t count) {
     if (!uses_same_texture_(mat, current_material_)) {
         // Render current batch and start a new one
         flush_quad_batch();
@@ -122,14 +278,14 @@ void renderer::render_quads(
         // To allow quads with no texture to enter the batch
         // with atlas textures, we just change their UV coordinates
         // to map to the first top-left pixel of the atlas, which is always white.
-        cache.data.reserve(cache.data.size() + quad_list.size());
-        for (const auto& orig_quad : quad_list) {
-            cache.data.push_back(orig_quad);
+        cache.data.reserve(cache.data.size() + count);
+        for (std::size_t i = 0; i < count; ++i) {
+            cache.data.push_back(quads[i]);
             auto& quad  = cache.data.back();
             quad[0].uvs = quad[1].uvs = quad[2].uvs = quad[3].uvs = vector2f(0.0f, 0.0f);
         }
     } else {
-        cache.data.insert(cache.data.end(), quad_list.begin(), quad_list.end());
+        cache.data.insert(cache.data.end(), quads, quads + count);
     }
 }
 
@@ -142,7 +298,7 @@ void renderer::flush_quad_batch() {
 
     if (cache.cache) {
         cache.cache->update(cache.data[0].data(), cache.data.size() * 4);
-        render_cache_(current_material_, *cache.cache, matrix4f::identity);
+        render_cache_(current_material_, *cache.cache, matrix4f::identity, color::white);
     } else {
         render_quads_(current_material_, cache.data);
     }
@@ -158,14 +314,21 @@ void renderer::flush_quad_batch() {
 }
 
 void renderer::render_cache(
-    const material* mat, const vertex_cache& cache, const matrix4f& model_transform) {
+    const material*     mat,
+    const vertex_cache& cache,
+    const matrix4f&     model_transform,
+    const color&        tint) {
+    if (get_recorded_snapshot_()) {
+        throw gui::exception("gui::renderer", "Vertex caches cannot be recorded in a snapshot.");
+    }
+
     if (is_quad_batching_enabled()) {
         flush_quad_batch();
     }
 
     vertex_count_ += cache.get_vertex_count();
 
-    render_cache_(mat, cache, model_transform);
+    render_cache_(mat, cache, model_transform, tint);
 
     ++batch_count_;
 }
@@ -180,6 +343,13 @@ void renderer::set_quad_batching_enabled(bool enabled) {
 
 std::shared_ptr<gui::material>
 renderer::create_material(const std::string& file_name, material::filter filt) {
+    std::shared_ptr<gui::material> tex = load_material_(file_name, filt);
+    retain_resource_(file_name, tex);
+    return tex;
+}
+
+std::shared_ptr<gui::material>
+renderer::load_material_(const std::string& file_name, material::filter filt) {
     std::string backed_name = utils::to_string(static_cast<std::size_t>(filt)) + '|' + file_name;
     auto        iter        = texture_list_.find(backed_name);
     if (iter != texture_list_.end()) {
@@ -191,7 +361,7 @@ renderer::create_material(const std::string& file_name, material::filter filt) {
 
     try {
         std::shared_ptr<gui::material> tex = create_material_(file_name, filt);
-        texture_list_[file_name]           = tex;
+        texture_list_[backed_name]         = tex;
         return tex;
     } catch (const std::exception& e) {
         gui::out << gui::warning << e.what() << std::endl;
@@ -230,16 +400,46 @@ std::shared_ptr<gui::font> renderer::create_font(
 
     auto iter = font_list_.find(font_name);
     if (iter != font_list_.end()) {
-        if (std::shared_ptr<gui::font> lock = iter->second.lock())
+        if (std::shared_ptr<gui::font> lock = iter->second.lock()) {
+            retain_resource_(font_file, lock);
             return lock;
-        else
+        } else {
             font_list_.erase(iter);
+        }
     }
 
     std::shared_ptr<gui::font> fnt =
         create_font_(font_file, size, outline, code_points, default_code_point);
 
     font_list_[font_name] = fnt;
+    retain_resource_(font_file, fnt);
+    return fnt;
+}
+
+std::shared_ptr<gui::font> renderer::create_distance_field_font(
+    const std::string&                   font_file,
+    const std::vector<code_point_range>& code_points,
+    char32_t                             default_code_point) {
+    std::string font_name = hash_font_parameters(
+        font_file, distance_field_font_size, 0u, code_points, default_code_point);
+    font_name += "|sdf";
+
+    auto iter = font_list_.find(font_name);
+    if (iter != font_list_.end()) {
+        if (std::shared_ptr<gui::font> lock = iter->second.lock()) {
+            retain_resource_(font_file, lock);
+            return lock;
+        } else {
+            font_list_.erase(iter);
+        }
+    }
+
+    std::shared_ptr<gui::font> fnt = create_distance_field_font_(
+        font_file, distance_field_font_size, distance_field_spread, code_points,
+        default_code_point);
+
+    font_list_[font_name] = fnt;
+    retain_resource_(font_file, fnt);
     return fnt;
 }
 
@@ -273,31 +473,58 @@ std::size_t renderer::get_texture_atlas_page_count() const {
 }
 
 bool renderer::is_vertex_cache_enabled() const {
-    return vertex_cache_enabled_ && is_vertex_cache_supported();
+    return vertex_cache_enabled_ && is_vertex_cache_supported() && !get_recorded_snapshot_();
 }
 
 void renderer::set_vertex_cache_enabled(bool enabled) {
     vertex_cache_enabled_ = enabled;
 }
 
+bool renderer::is_packed_vertex_enabled() const {
+    return packed_vertex_enabled_ && is_packed_vertex_supported();
+}
+
+void renderer::set_packed_vertex_enabled(bool enabled) {
+    if (packed_vertex_enabled_ == enabled)
+        return;
+
+    packed_vertex_enabled_ = enabled;
+
+    // Re-create the quad batching caches with the new layout on next begin()
+    for (auto& batcher : quad_cache_)
+        batcher.cache = nullptr;
+}
+
+bool renderer::is_distance_field_font_enabled() const {
+    return distance_field_font_enabled_ && is_distance_field_supported();
+}
+
+void renderer::set_distance_field_font_enabled(bool enabled) {
+    distance_field_font_enabled_ = enabled;
+}
+
 void renderer::auto_detect_settings() {
     vertex_cache_enabled_  = true;
     texture_atlas_enabled_ = true;
     quad_batching_enabled_ = true;
 }
 
-atlas& renderer::get_atlas_(const std::string& atlas_category, material::filter filt) {
+atlas& renderer::get_atlas_(
+    const std::string& atlas_category, material::filter filt, bool single_channel) {
     std::shared_ptr<gui::atlas> atlas;
 
     std::string baked_atlas_name =
         utils::to_string(static_cast<std::size_t>(filt)) + '|' + atlas_category;
+    if (single_channel)
+        baked_atlas_name += "|single_channel";
+
     auto iter = atlas_list_.find(baked_atlas_name);
     if (iter != atlas_list_.end()) {
         atlas = iter->second;
     }
 
     if (!atlas) {
-        atlas                         = create_atlas_(filt);
+        atlas                         = create_atlas_(filt, single_channel);
         atlas_list_[baked_atlas_name] = atlas;
     }
 
@@ -312,18 +539,19 @@ std::shared_ptr<material> renderer::create_atlas_material(
     auto& atlas = get_atlas_(atlas_category, filt);
 
     auto tex = atlas.fetch_material(file_name);
-    if (tex)
-        return tex;
-
-    tex = create_material(file_name, filt);
-    if (!tex)
-        return nullptr;
+    if (!tex) {
+        // Only the material returned to the caller is retained: the stand-alone material is not
+        // needed once copied into the atlas.
+        tex = load_material_(file_name, filt);
+        if (!tex)
+            return nullptr;
+
+        if (auto added_tex = atlas.add_material(file_name, *tex))
+            tex = std::move(added_tex);
+    }
 
-    auto added_tex = atlas.add_material(file_name, *tex);
-    if (added_tex)
-        return added_tex;
-    else
-        return tex;
+    retain_resource_(file_name, tex);
+    return tex;
 }
 
 std::shared_ptr<font> renderer::create_atlas_font(
@@ -336,14 +564,17 @@ std::shared_ptr<font> renderer::create_atlas_font(
     if (!is_texture_atlas_enabled())
         return create_font(font_file, size, outline, code_points, default_code_point);
 
-    auto& atlas = get_atlas_(atlas_category, material::filter::none);
+    auto& atlas =
+        get_atlas_(atlas_category, material::filter::none, is_single_channel_font_supported());
 
     const std::string font_name =
         hash_font_parameters(font_file, size, outline, code_points, default_code_point);
 
     auto fnt = atlas.fetch_font(font_name);
-    if (fnt)
+    if (fnt) {
+        retain_resource_(font_file, fnt);
         return fnt;
+    }
 
     fnt = create_font(font_file, size, outline, code_points, default_code_point);
     if (!fnt)
@@ -361,6 +592,125 @@ std::shared_ptr<material> renderer::create_material(std::shared_ptr<render_targe
     return create_material(std::move(target), rect);
 }
 
+bool renderer::is_resource_retention_enabled() const {
+    return resource_retention_enabled_;
+}
+
+void renderer::set_resource_retention_enabled(bool enabled) {
+    resource_retention_enabled_ = enabled;
+    if (!resource_retention_enabled_)
+        retained_resource_list_.clear();
+}
+
+void renderer::release_resources(const std::string& file_name) {
+    const std::string normalized_name = utils::normalize_path(file_name);
+    for (auto iter = retained_resource_list_.begin(); iter != retained_resource_list_.end();) {
+        if (iter->second.file_name == normalized_name)
+            iter = retained_resource_list_.erase(iter);
+        else
+            ++iter;
+    }
+}
+
+void renderer::release_unused_resources() {
+    for (auto iter = retained_resource_list_.begin(); iter != retained_resource_list_.end();) {
+        if (iter->second.resource.use_count() == 1)
+            iter = retained_resource_list_.erase(iter);
+        else
+            ++iter;
+    }
+}
+
+void renderer::retain_resource_(
+    const std::string& file_name, std::shared_ptr<const void> resource) {
+    if (!resource_retention_enabled_ || !resource)
+        return;
+
+    const void* key = resource.get();
+    retained_resource_list_.try_emplace(
+        key, retained_resource{utils::normalize_path(file_name), std::move(resource)});
+}
+
+void renderer::clear(const color& c) {
+    if (auto* snapshot = get_recorded_snapshot_()) {
+        snapshot->add_command_(render_snapshot::command_type::clear).tint = c;
+        return;
+    }
+
+    if (!current_render_target_)
+        return;
+
+    if (is_quad_batching_enabled()) {
+        flush_quad_batch();
+    }
+
+    current_render_target_->clear(c);
+}
+
+void renderer::begin_snapshot(render_snapshot& snapshot) {
+    if (recorder.snapshot) {
+        throw gui::exception(
+            "gui::renderer", "A snapshot is already being recorded on this thread.");
+    }
+
+    recorder.owner     = this;
+    recorder.snapshot  = &snapshot;
+    recorder.view      = matrix4f::identity;
+    recorder.view_rect = std::nullopt;
+}
+
+void renderer::end_snapshot() {
+    if (recorder.owner != this)
+        return;
+
+    recorder = snapshot_recorder{};
+}
+
+bool renderer::is_recording_snapshot() const {
+    return get_recorded_snapshot_() != nullptr;
+}
+
+render_snapshot* renderer::get_recorded_snapshot_() const {
+    return recorder.owner == this ? recorder.snapshot : nullptr;
+}
+
+void renderer::submit_snapshot(const render_snapshot& snapshot) {
+    using command_type = render_snapshot::command_type;
+
+    for (const auto& cmd : snapshot.command_list_) {
+        switch (cmd.type) {
+        case command_type::begin: begin(cmd.target); break;
+        case command_type::end: end(); break;
+        case command_type::clear: clear(cmd.tint); break;
+        case command_type::set_view: set_view(cmd.matrix); break;
+        case command_type::set_scissor: set_scissor(cmd.rect); break;
+        case command_type::set_distance_field_threshold:
+            set_distance_field_threshold(cmd.threshold);
+            break;
+        case command_type::render_quads: {
+            const auto* quads = snapshot.quad_list_.data() + cmd.first_quad;
+            if (is_quad_batching_enabled() && !get_recorded_snapshot_()) {
+                // Batch directly from the snapshot, without copying the quads first
+                batch_quads_(cmd.mat.get(), quads, cmd.num_quads);
+            } else {
+                render_quads(
+                    cmd.mat.get(),
+                    std::vector<std::array<vertex, 4>>(quads, quads + cmd.num_quads));
+            }
+            break;
+        }
+        }
+    }
+
+    if (auto* recorded = get_recorded_snapshot_()) {
+        recorded->culled_frame_count_  += snapshot.culled_frame_count_;
+        recorded->culled_region_count_ += snapshot.culled_region_count_;
+    } else {
+        culled_frame_count_  += snapshot.culled_frame_count_;
+        culled_region_count_ += snapshot.culled_region_count_;
+    }
+}
+
 void renderer::notify_window_resized(const vector2ui&) {}
 
 } // namespace lxgui::gui
@@ -11,6 +11,8 @@
 #include "lxgui/utils_range.hpp"
 #include "lxgui/utils_std.hpp"
 
+#include <cmath>
+
 // #define DEBUG_LOG(msg) gui::out << (msg) << std::endl
 #define DEBUG_LOG(msg)
 
@@ -21,6 +23,7 @@ root::root(utils::control_block& block, manager& mgr) :
     frame_container(mgr.get_factory(), object_registry_, observer_from_this()),
     manager_(mgr),
     renderer_(mgr.get_renderer()),
+    frame_pool_(mgr),
     world_input_dispatcher_(mgr.get_world_input_dispatcher()) {
     auto& window       = get_manager().get_window();
     screen_dimensions_ = window.get_dimensions();
@@ -111,6 +114,7 @@ root::root(utils::control_block& block, manager& mgr) :
 
 root::~root() {
     // Must be done before we destroy the registry
+    frame_pool_.clear();
     clear_frames_();
 }
 
@@ -157,6 +161,10 @@ void root::create_caching_render_target_() {
     screen_quad_.v[1].uvs = screen_quad_.mat->get_canvas_uv(vector2f(1, 0), true);
     screen_quad_.v[2].uvs = screen_quad_.mat->get_canvas_uv(vector2f(1, 1), true);
     screen_quad_.v[3].uvs = screen_quad_.mat->get_canvas_uv(vector2f(0, 1), true);
+
+    // The content of the strata caches must be composited again
+    for (auto& s : strata_list_)
+        s.redraw_flag = true;
 }
 
 void root::create_strata_cache_render_target_(strata_data& strata_obj) {
@@ -167,6 +175,8 @@ void root::create_strata_cache_render_target_(strata_data& strata_obj) {
 
     vector2f scaled_dimensions = get_target_dimensions();
 
+    strata_obj.redraw_flag = true;
+
     auto& q = strata_obj.target_quad;
 
     q.mat      = renderer_.create_material(strata_obj.target);
@@ -182,6 +192,9 @@ void root::create_strata_cache_render_target_(strata_data& strata_obj) {
 }
 
 void root::update(float delta) {
+    // Update all playing animations in one go
+    update_animations_(delta);
+
     // Update logics on root frames from parent to children.
     for (auto& obj : get_root_frames()) {
         obj.update(delta);
@@ -199,13 +212,32 @@ void root::update(float delta) {
     if (caching_enabled_) {
         DEBUG_LOG(" Redraw strata...");
 
+        redraw_stats_ = redraw_stats{};
+
         try {
+            if (!target_)
+                create_caching_render_target_();
+
+            const std::size_t screen_pixels =
+                static_cast<std::size_t>(screen_dimensions_.x) * screen_dimensions_.y;
+
+            std::optional<bounds2f> composite_rect;
             for (auto& s : strata_list_) {
-                if (s.redraw_flag) {
+                if (s.redraw_flag || s.has_damage) {
                     if (!s.target)
                         create_strata_cache_render_target_(s);
 
-                    if (s.target) {
+                    std::optional<bounds2f> scissor;
+                    if (!s.redraw_flag) {
+                        scissor = get_scissor_rect_(s.damage_rect);
+                        if (scissor.has_value()) {
+                            composite_rect = composite_rect.has_value()
+                                                 ? composite_rect->merge(s.damage_rect)
+                                                 : s.damage_rect;
+                        }
+                    }
+
+                    if (s.target && (s.redraw_flag || scissor.has_value())) {
                         renderer_.begin(s.target);
 
                         vector2f view = vector2f(s.target->get_canvas_dimensions()) /
@@ -213,22 +245,36 @@ void root::update(float delta) {
 
                         renderer_.set_view(matrix4f::view(view));
 
-                        s.target->clear(color::empty);
-                        render_strata_(s);
+                        if (s.redraw_flag) {
+                            renderer_.clear(color::empty);
+                            redraw_stats_.num_frames += render_strata_(s);
+                            redraw_stats_.num_strata_pixels += screen_pixels;
+                            ++redraw_stats_.num_full_strata;
+                        } else {
+                            renderer_.set_scissor(scissor);
+                            renderer_.clear(color::empty);
+                            redraw_stats_.num_frames += render_strata_(s, s.damage_rect);
+                            redraw_stats_.num_strata_pixels += static_cast<std::size_t>(
+                                scissor->width() * scissor->height());
+                            ++redraw_stats_.num_partial_strata;
+                        }
 
                         renderer_.end();
                     }
 
-                    redraw_flag = true;
+                    if (s.redraw_flag)
+                        redraw_flag = true;
                 }
 
                 s.redraw_flag = false;
+                s.has_damage  = false;
             }
 
-            if (!target_)
-                create_caching_render_target_();
+            std::optional<bounds2f> composite_scissor;
+            if (!redraw_flag && composite_rect.has_value())
+                composite_scissor = get_scissor_rect_(composite_rect.value());
 
-            if (redraw_flag && target_) {
+            if ((redraw_flag || composite_scissor.has_value()) && target_) {
                 renderer_.begin(target_);
 
                 vector2f view = vector2f(target_->get_canvas_dimensions()) /
@@ -236,7 +282,15 @@ void root::update(float delta) {
 
                 renderer_.set_view(matrix4f::view(view));
 
-                target_->clear(color::empty);
+                if (redraw_flag) {
+                    redraw_stats_.num_composite_pixels = screen_pixels;
+                } else {
+                    renderer_.set_scissor(composite_scissor);
+                    redraw_stats_.num_composite_pixels = static_cast<std::size_t>(
+                        composite_scissor->width() * composite_scissor->height());
+                }
+
+                renderer_.clear(color::empty);
 
                 for (auto& strata : strata_list_) {
                     renderer_.render_quad(strata.target_quad);
@@ -272,6 +326,46 @@ bool root::is_caching_enabled() const {
     return caching_enabled_;
 }
 
+void root::enable_partial_redraw(bool enable) {
+    partial_redraw_enabled_ = enable;
+}
+
+bool root::is_partial_redraw_enabled() const {
+    return partial_redraw_enabled_;
+}
+
+void root::notify_strata_rect_needs_redraw(strata strata_id, const bounds2f& rect) {
+    if (!partial_redraw_enabled_ || !renderer_.is_scissor_supported()) {
+        notify_strata_needs_redraw(strata_id);
+        return;
+    }
+
+    auto& strata_obj = strata_list_[static_cast<std::size_t>(strata_id)];
+    if (strata_obj.redraw_flag)
+        return;
+
+    strata_obj.damage_rect = strata_obj.has_damage ? strata_obj.damage_rect.merge(rect) : rect;
+    strata_obj.has_damage  = true;
+}
+
+std::optional<bounds2f> root::get_scissor_rect_(const bounds2f& rect) const {
+    // Convert to pixels, rounding outwards, with one extra pixel for texture filtering
+    const float scale = get_manager().get_interface_scaling_factor();
+    bounds2f    pixel_rect(
+        std::floor(rect.left * scale) - 1.0f, std::ceil(rect.right * scale) + 1.0f,
+        std::floor(rect.top * scale) - 1.0f, std::ceil(rect.bottom * scale) + 1.0f);
+
+    pixel_rect.left   = std::max(pixel_rect.left, 0.0f);
+    pixel_rect.top    = std::max(pixel_rect.top, 0.0f);
+    pixel_rect.right  = std::min(pixel_rect.right, static_cast<float>(screen_dimensions_.x));
+    pixel_rect.bottom = std::min(pixel_rect.bottom, static_cast<float>(screen_dimensions_.y));
+
+    if (pixel_rect.width() <= 0.0f || pixel_rect.height() <= 0.0f)
+        return std::nullopt;
+
+    return pixel_rect;
+}
+
 void root::notify_scaling_factor_updated() {
     for (auto& obj : get_root_frames()) {
         obj.notify_scaling_factor_updated();
@@ -286,12 +380,41 @@ void root::notify_scaling_factor_updated() {
     }
 }
 
+void root::register_animation_group(utils::observer_ptr<animation_group> group) {
+    animation_group_list_.push_back(std::move(group));
+}
+
+std::size_t root::get_num_playing_animation_groups() const {
+    return animation_group_list_.size();
+}
+
+void root::update_animations_(float delta) {
+    // NB: animations may trigger callbacks which can play new animations (appended to the
+    // list) or destroy regions, hence the iteration by index and copy of the pointer
+    for (std::size_t i = 0; i < animation_group_list_.size();) {
+        auto group = animation_group_list_[i];
+        if (!group || !group->is_playing() || group->is_paused()) {
+            if (group)
+                group->is_registered_ = false;
+
+            if (i + 1 != animation_group_list_.size())
+                animation_group_list_[i] = std::move(animation_group_list_.back());
+            animation_group_list_.pop_back();
+            continue;
+        }
+
+        group->update(delta);
+        ++i;
+    }
+}
+
 void root::update_hovered_frame_() {
     const auto mouse_pos = get_manager().get_input_dispatcher().get_mouse_position();
 
-    utils::observer_ptr<frame> hovered_frame = find_topmost_frame([&](const frame& obj) {
-        return obj.is_in_region(mouse_pos) && obj.is_mouse_move_enabled();
-    });
+    utils::observer_ptr<frame> hovered_frame =
+        find_topmost_frame(mouse_pos, flag_mouse_move, [&](const frame& obj) {
+            return obj.is_in_region(mouse_pos) && obj.is_mouse_move_enabled();
+        });
 
     set_hovered_frame_(std::move(hovered_frame), mouse_pos);
 }
@@ -609,9 +732,10 @@ bool root::on_mouse_moved_(const input::mouse_moved_data& args) {
 }
 
 bool root::on_mouse_wheel_(const input::mouse_wheel_data& args) {
-    utils::observer_ptr<frame> hovered_frame = find_topmost_frame([&](const frame& obj) {
-        return obj.is_in_region(args.position) && obj.is_mouse_wheel_enabled();
-    });
+    utils::observer_ptr<frame> hovered_frame =
+        find_topmost_frame(args.position, flag_mouse_wheel, [&](const frame& obj) {
+            return obj.is_in_region(args.position) && obj.is_mouse_wheel_enabled();
+        });
 
     if (hovered_frame) {
         event_data data;
@@ -627,9 +751,10 @@ bool root::on_mouse_wheel_(const input::mouse_wheel_data& args) {
 }
 
 bool root::on_drag_start_(const input::mouse_drag_start_data& args) {
-    utils::observer_ptr<frame> hovered_frame = find_topmost_frame([&](const frame& obj) {
-        return obj.is_in_region(args.position) && obj.is_mouse_click_enabled();
-    });
+    utils::observer_ptr<frame> hovered_frame =
+        find_topmost_frame(args.position, flag_mouse_click, [&](const frame& obj) {
+            return obj.is_in_region(args.position) && obj.is_mouse_click_enabled();
+        });
 
     if (!hovered_frame) {
         // Forward to the world
@@ -666,9 +791,10 @@ bool root::on_drag_stop_(const input::mouse_drag_stop_data& args) {
         dragged_frame_ = nullptr;
     }
 
-    utils::observer_ptr<frame> hovered_frame = find_topmost_frame([&](const frame& obj) {
-        return obj.is_in_region(args.position) && obj.is_mouse_click_enabled();
-    });
+    utils::observer_ptr<frame> hovered_frame =
+        find_topmost_frame(args.position, flag_mouse_click, [&](const frame& obj) {
+            return obj.is_in_region(args.position) && obj.is_mouse_click_enabled();
+        });
 
     if (!hovered_frame) {
         // Forward to the world
@@ -704,33 +830,14 @@ bool root::on_text_entered_(const input::text_entered_data& args) {
     return false;
 }
 
-std::string
-get_key_name(input::key key_id, bool is_shift_pressed, bool is_ctrl_pressed, bool is_alt_pressed) {
-    std::string name;
-
-    if (key_id != input::key::k_lcontrol && key_id != input::key::k_rcontrol &&
-        key_id != input::key::k_lshift && key_id != input::key::k_rshift &&
-        key_id != input::key::k_lmenu && key_id != input::key::k_rmenu) {
-        if (is_ctrl_pressed)
-            name = "Ctrl-";
-        if (is_alt_pressed)
-            name.append("Alt-");
-        if (is_shift_pressed)
-            name.append("Shift-");
-    }
-
-    name.append(input::get_key_codename(key_id));
-
-    return name;
-}
-
 bool root::on_key_state_changed_(input::key key_id, bool is_down, bool is_repeat) {
     const auto& input_dispatcher = get_manager().get_input_dispatcher();
     bool        is_shift_pressed = input_dispatcher.shift_is_pressed();
     bool        is_ctrl_pressed  = input_dispatcher.ctrl_is_pressed();
     bool        is_alt_pressed   = input_dispatcher.alt_is_pressed();
 
-    std::string key_name = get_key_name(key_id, is_shift_pressed, is_ctrl_pressed, is_alt_pressed);
+    const input::key_chord chord =
+        input::make_key_chord(key_id, is_shift_pressed, is_ctrl_pressed, is_alt_pressed);
 
     // First, give priority to the focused frame
     utils::observer_ptr<frame> topmost_frame = get_focused_frame();
@@ -738,7 +845,7 @@ bool root::on_key_state_changed_(input::key key_id, bool is_down, bool is_repeat
     // If no focused frame with keyboard enabled, look top-down for a frame that captures this key
     if (!topmost_frame || !topmost_frame->is_keyboard_enabled()) {
         topmost_frame = find_topmost_frame([&](const frame& frame) {
-            return frame.is_keyboard_enabled() && frame.is_key_capture_enabled(key_name);
+            return frame.is_keyboard_enabled() && frame.is_key_capture_enabled(chord);
         });
     }
 
@@ -749,7 +856,7 @@ bool root::on_key_state_changed_(input::key key_id, bool is_down, bool is_repeat
         data.add(is_shift_pressed);
         data.add(is_ctrl_pressed);
         data.add(is_alt_pressed);
-        data.add(key_name);
+        data.add(input::get_key_chord_codename(chord));
 
         if (is_down) {
             if (is_repeat) {
@@ -767,10 +874,8 @@ bool root::on_key_state_changed_(input::key key_id, bool is_down, bool is_repeat
     if (is_down && !is_repeat) {
         // If no frame is found, try the key_binder
         try {
-            if (get_key_binder().on_key_down(
-                    key_id, is_shift_pressed, is_ctrl_pressed, is_alt_pressed)) {
+            if (get_key_binder().on_key_down(chord))
                 return true;
-            }
         } catch (const std::exception& e) {
             std::string err = e.what();
             gui::out << gui::error << err << std::endl;
@@ -790,9 +895,10 @@ bool root::on_mouse_button_state_changed_(
     bool                was_dragged,
     const vector2f&     mouse_pos) {
 
-    utils::observer_ptr<frame> hovered_frame = find_topmost_frame([&](const frame& frame) {
-        return frame.is_in_region(mouse_pos) && frame.is_mouse_click_enabled();
-    });
+    utils::observer_ptr<frame> hovered_frame =
+        find_topmost_frame(mouse_pos, flag_mouse_click, [&](const frame& frame) {
+            return frame.is_in_region(mouse_pos) && frame.is_mouse_click_enabled();
+        });
 
     if (is_down && !is_double_click) {
         if (!hovered_frame || hovered_frame != get_focused_frame())
@@ -0,0 +1,493 @@
+#include "lxgui/gui_saved_variables.hpp"
+
+#include "lxgui/gui_exception.hpp"
+#include "lxgui/gui_out.hpp"
+#include "lxgui/utils_file_system.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <lxgui/extern_sol2_state.hpp>
+#include <string_view>
+
+namespace lxgui::gui {
+
+namespace {
+
+// Binary format: a header, followed by a list of (name, value) pairs until the end of the file.
+// Each value starts with a tag byte. Tables list their (key, value) pairs, and end with the
+// table_end tag. Integers are stored as little-endian unsigned LEB128 (lengths) or 8 bytes
+// (Lua integers and numbers).
+constexpr char         binary_magic[4] = {'L', 'X', 'S', 'V'};
+constexpr std::uint8_t binary_version  = 1u;
+constexpr std::uint8_t tag_nil         = 0u;
+constexpr std::uint8_t tag_false       = 1u;
+constexpr std::uint8_t tag_true        = 2u;
+constexpr std::uint8_t tag_integer     = 3u;
+constexpr std::uint8_t tag_number      = 4u;
+constexpr std::uint8_t tag_string      = 5u;
+constexpr std::uint8_t tag_table       = 6u;
+constexpr std::uint8_t tag_table_end   = 7u;
+
+// Protects the C++ stack against deeply nested (or malicious) tables
+constexpr std::size_t max_table_depth = 200u;
+
+constexpr std::string_view indent_unit = "    ";
+
+bool is_integer(lua_State* lua [[maybe_unused]], int index [[maybe_unused]]) noexcept {
+#if LUA_VERSION_NUM >= 503
+    return lua_isinteger(lua, index) != 0;
+#else
+    return false;
+#endif
+}
+
+/// Walks Lua values, and writes them in either format.
+class value_writer {
+public:
+    value_writer(lua_State* lua, saved_variables_format format, std::string& output) :
+        lua_(lua), format_(format), output_(output) {}
+
+    void write_variable(const std::string& name) {
+        variable_ = &name;
+
+        lua_getglobal(lua_, name.c_str());
+        const int index = lua_gettop(lua_);
+
+        if (format_ == saved_variables_format::lua) {
+            output_ += name;
+            output_ += " = ";
+            if (!write_value_(index, 0u))
+                output_ += "nil";
+            output_ += '\n';
+        } else {
+            write_binary_string_(name.data(), name.size());
+            if (!write_value_(index, 0u))
+                output_ += static_cast<char>(tag_nil);
+        }
+
+        lua_pop(lua_, 1);
+    }
+
+private:
+    // Returns 'false' and writes nothing if the value cannot be saved.
+    bool write_value_(int index, std::size_t depth) {
+        switch (lua_type(lua_, index)) {
+        case LUA_TNIL:
+            if (format_ == saved_variables_format::lua)
+                output_ += "nil";
+            else
+                output_ += static_cast<char>(tag_nil);
+            return true;
+        case LUA_TBOOLEAN: {
+            const bool value = lua_toboolean(lua_, index) != 0;
+            if (format_ == saved_variables_format::lua)
+                output_ += value ? "true" : "false";
+            else
+                output_ += static_cast<char>(value ? tag_true : tag_false);
+            return true;
+        }
+        case LUA_TNUMBER: write_number_(index); return true;
+        case LUA_TSTRING: {
+            std::size_t length = 0u;
+            const char* value  = lua_tolstring(lua_, index, &length);
+            if (format_ == saved_variables_format::lua)
+                write_lua_string_(value, length);
+            else {
+                output_ += static_cast<char>(tag_string);
+                write_binary_string_(value, length);
+            }
+            return true;
+        }
+        case LUA_TTABLE: return write_table_(index, depth);
+        default:
+            gui::out << gui::warning << "gui::saved_variables: In \"" << *variable_
+                     << "\": cannot save a value of type '" << luaL_typename(lua_, index)
+                     << "', skipped." << std::endl;
+            return false;
+        }
+    }
+
+    bool write_table_(int index, std::size_t depth) {
+        const void* pointer = lua_topointer(lua_, index);
+        for (const void* parent : table_stack_) {
+            if (parent == pointer) {
+                gui::out << gui::warning << "gui::saved_variables: In \"" << *variable_
+                         << "\": a table contains itself, the cyclic reference is skipped."
+                         << std::endl;
+                return false;
+            }
+        }
+
+        if (depth >= max_table_depth || !lua_checkstack(lua_, 3)) {
+            gui::out << gui::warning << "gui::saved_variables: In \"" << *variable_
+                     << "\": tables are nested too deeply, skipped." << std::endl;
+            return false;
+        }
+
+        table_stack_.push_back(pointer);
+
+        const bool is_lua = format_ == saved_variables_format::lua;
+        output_ += is_lua ? '{' : static_cast<char>(tag_table);
+
+        bool empty = true;
+        lua_pushnil(lua_);
+        while (lua_next(lua_, index) != 0) {
+            const int key   = lua_gettop(lua_) - 1;
+            const int value = key + 1;
+
+            const std::size_t entry_start = output_.size();
+            if (is_lua) {
+                output_ += empty ? "\n" : "";
+                for (std::size_t i = 0; i <= depth; ++i)
+                    output_ += indent_unit;
+                output_ += '[';
+            }
+
+            bool written = write_value_(key, depth + 1);
+            if (written) {
+                if (is_lua)
+                    output_ += "] = ";
+                written = write_value_(value, depth + 1);
+            }
+
+            if (written) {
+                if (is_lua)
+                    output_ += ",\n";
+                empty = false;
+            } else {
+                // Drop the partially written entry
+                output_.resize(entry_start);
+            }
+
+            lua_pop(lua_, 1);
+        }
+
+        if (is_lua) {
+            if (!empty) {
+                for (std::size_t i = 0; i < depth; ++i)
+                    output_ += indent_unit;
+            }
+            output_ += '}';
+        } else {
+            output_ += static_cast<char>(tag_table_end);
+        }
+
+        table_stack_.pop_back();
+        return true;
+    }
+
+    void write_number_(int index) {
+        if (is_integer(lua_, index)) {
+            const auto value = static_cast<std::int64_t>(lua_tointeger(lua_, index));
+            if (format_ == saved_variables_format::lua)
+                output_ += std::to_string(value);
+            else {
+                output_ += static_cast<char>(tag_integer);
+                write_binary_fixed_(static_cast<std::uint64_t>(value));
+            }
+            return;
+        }
+
+        const double value = static_cast<double>(lua_tonumber(lua_, index));
+        if (format_ == saved_variables_format::binary) {
+            std::uint64_t bits = 0u;
+            std::memcpy(&bits, &value, sizeof(bits));
+            output_ += static_cast<char>(tag_number);
+            write_binary_fixed_(bits);
+            return;
+        }
+
+        if (std::isnan(value)) {
+            output_ += "(0/0)";
+        } else if (std::isinf(value)) {
+            output_ += value > 0.0 ? "(1/0)" : "(-1/0)";
+        } else {
+            // 17 significant digits are enough to read back the exact same double
+            char buffer[32];
+            std::snprintf(buffer, sizeof(buffer), "%.17g", value);
+            output_ += buffer;
+#if LUA_VERSION_NUM >= 503
+            // Keep the float sub-type when reading back
+            if (std::strpbrk(buffer, ".e") == nullptr)
+                output_ += ".0";
+#endif
+        }
+    }
+
+    void write_lua_string_(const char* value, std::size_t length) {
+        output_ += '"';
+        for (std::size_t i = 0; i < length; ++i) {
+            const unsigned char c = static_cast<unsigned char>(value[i]);
+            switch (c) {
+            case '"': output_ += "\\\""; break;
+            case '\\': output_ += "\\\\"; break;
+            case '\n': output_ += "\\n"; break;
+            case '\r': output_ += "\\r"; break;
+            case '\t': output_ += "\\t"; break;
+            default:
+                if (c < 32u || c == 127u) {
+                    // Always three digits, so a following digit is not read as part of it
+                    char buffer[8];
+                    std::snprintf(buffer, sizeof(buffer), "\\%03u", static_cast<unsigned>(c));
+                    output_ += buffer;
+                } else {
+                    output_ += static_cast<char>(c);
+                }
+                break;
+            }
+        }
+        output_ += '"';
+    }
+
+    void write_binary_string_(const char* value, std::size_t length) {
+        std::size_t remaining = length;
+        do {
+            std::uint8_t byte = static_cast<std::uint8_t>(remaining & 0x7Fu);
+            remaining >>= 7u;
+            if (remaining != 0u)
+                byte |= 0x80u;
+            output_ += static_cast<char>(byte);
+        } while (remaining != 0u);
+
+        output_.append(value, length);
+    }
+
+    void write_binary_fixed_(std::uint64_t value) {
+        for (std::size_t i = 0; i < 8u; ++i)
+            output_ += static_cast<char>((value >> (8u * i)) & 0xFFu);
+    }
+
+    lua_State*               lua_ = nullptr;
+    saved_variables_format   format_;
+    std::string&             output_;
+    const std::string*       variable_ = nullptr;
+    std::vector<const void*> table_stack_;
+};
+
+/// Reads values from a binary saved variables buffer, and pushes them on the Lua stack.
+class binary_reader {
+public:
+    binary_reader(lua_State* lua, std::string_view data, const std::string& file_name) :
+        lua_(lua), data_(data), file_name_(file_name) {}
+
+    void read() {
+        // The values read so far are removed from the stack if the file turns out to be invalid
+        const int top = lua_gettop(lua_);
+
+        try {
+            read_variables_(top);
+        } catch (...) {
+            lua_settop(lua_, top);
+            throw;
+        }
+    }
+
+private:
+    void read_variables_(int top) {
+        if (data_.size() < sizeof(binary_magic) + 1u ||
+            std::memcmp(data_.data(), binary_magic, sizeof(binary_magic)) != 0) {
+            error_("not a saved variables file");
+        }
+
+        position_ = sizeof(binary_magic);
+        if (read_byte_() != binary_version)
+            error_("unsupported version");
+
+        // Read all the variables first, as name/value pairs on the stack, so that a corrupted
+        // file does not set any variable
+        while (position_ < data_.size()) {
+            if (!lua_checkstack(lua_, 2))
+                error_("not enough Lua stack space");
+
+            const std::string name = read_string_();
+            lua_pushlstring(lua_, name.data(), name.size());
+            read_value_(read_byte_(), 0u);
+        }
+
+        // Set them in file order, so that if a name appears twice, the last value is kept
+        for (int index = top + 1; index < lua_gettop(lua_); index += 2) {
+            lua_pushvalue(lua_, index + 1);
+            lua_setglobal(lua_, lua_tostring(lua_, index));
+        }
+
+        lua_settop(lua_, top);
+    }
+
+    [[noreturn]] void error_(const std::string& message) const {
+        throw gui::exception(
+            "gui::saved_variables", "Cannot load \"" + file_name_ + "\": " + message + ".");
+    }
+
+    std::uint8_t read_byte_() {
+        if (position_ >= data_.size())
+            error_("unexpected end of file");
+
+        return static_cast<std::uint8_t>(data_[position_++]);
+    }
+
+    std::uint64_t read_fixed_() {
+        std::uint64_t value = 0u;
+        for (std::size_t i = 0; i < 8u; ++i)
+            value |= static_cast<std::uint64_t>(read_byte_()) << (8u * i);
+
+        return value;
+    }
+
+    std::string read_string_() {
+        std::size_t  length = 0u;
+        std::size_t  shift  = 0u;
+        std::uint8_t byte   = 0u;
+        do {
+            if (shift >= 64u)
+                error_("invalid string length");
+
+            byte = read_byte_();
+            length |= static_cast<std::size_t>(byte & 0x7Fu) << shift;
+            shift += 7u;
+        } while ((byte & 0x80u) != 0u);
+
+        if (length > data_.size() - position_)
+            error_("unexpected end of file");
+
+        std::string value{data_.substr(position_, length)};
+        position_ += length;
+        return value;
+    }
+
+    // Pushes exactly one value on the stack.
+    void read_value_(std::uint8_t tag, std::size_t depth) {
+        if (!lua_checkstack(lua_, 3))
+            error_("not enough Lua stack space");
+
+        switch (tag) {
+        case tag_nil: lua_pushnil(lua_); break;
+        case tag_false: lua_pushboolean(lua_, 0); break;
+        case tag_true: lua_pushboolean(lua_, 1); break;
+        case tag_integer: {
+            const auto value = static_cast<std::int64_t>(read_fixed_());
+#if LUA_VERSION_NUM >= 503
+            lua_pushinteger(lua_, static_cast<lua_Integer>(value));
+#else
+            lua_pushnumber(lua_, static_cast<lua_Number>(value));
+#endif
+            break;
+        }
+        case tag_number: {
+            const std::uint64_t bits  = read_fixed_();
+            double              value = 0.0;
+            std::memcpy(&value, &bits, sizeof(value));
+            lua_pushnumber(lua_, static_cast<lua_Number>(value));
+            break;
+        }
+        case tag_string: {
+            const std::string value = read_string_();
+            lua_pushlstring(lua_, value.data(), value.size());
+            break;
+        }
+        case tag_table: {
+            if (depth >= max_table_depth)
+                error_("tables are nested too deeply");
+
+            lua_newtable(lua_);
+            const int table = lua_gettop(lua_);
+            for (std::uint8_t key_tag = read_byte_(); key_tag != tag_table_end;
+                 key_tag              = read_byte_()) {
+                if (key_tag == tag_nil)
+                    error_("nil table key");
+
+                read_value_(key_tag, depth + 1);
+                if (key_tag == tag_number && std::isnan(lua_tonumber(lua_, -1)))
+                    error_("NaN table key");
+
+                read_value_(read_byte_(), depth + 1);
+                lua_rawset(lua_, table);
+            }
+            break;
+        }
+        default: error_("unknown value type"); break;
+        }
+    }
+
+    lua_State*         lua_ = nullptr;
+    std::string_view   data_;
+    const std::string& file_name_;
+    std::size_t        position_ = 0u;
+};
+
+} // namespace
+
+const char* get_saved_variables_extension(saved_variables_format format) noexcept {
+    switch (format) {
+    case saved_variables_format::binary: return ".dat";
+    case saved_variables_format::lua:
+    default: return ".lua";
+    }
+}
+
+void serialize_saved_variables(
+    sol::state&                     lua,
+    const std::vector<std::string>& variable_list,
+    saved_variables_format          format,
+    std::string&                    output) {
+
+    if (format == saved_variables_format::binary && output.empty()) {
+        output.append(binary_magic, sizeof(binary_magic));
+        output += static_cast<char>(binary_version);
+    }
+
+    value_writer writer(lua.lua_state(), format, output);
+    for (const auto& variable : variable_list)
+        writer.write_variable(variable);
+}
+
+void load_binary_saved_variables(sol::state& lua, const std::string& file_name) {
+    const auto content = utils::read_file(file_name);
+    if (!content.has_value())
+        throw gui::exception("gui::saved_variables", "Cannot open \"" + file_name + "\".");
+
+    binary_reader(lua.lua_state(), content->get_view(), file_name).read();
+}
+
+saved_variables_writer::~saved_variables_writer() {
+    wait();
+}
+
+void saved_variables_writer::write(std::vector<file> file_list) {
+    wait();
+
+#if defined(LXGUI_ENABLE_MULTITHREADING)
+    thread_ = std::thread(
+        [this, file_list = std::move(file_list)]() { write_files_(file_list); });
+#else
+    write_files_(file_list);
+#endif
+}
+
+void saved_variables_writer::wait() {
+#if defined(LXGUI_ENABLE_MULTITHREADING)
+    if (thread_.joinable())
+        thread_.join();
+#endif
+
+    for (const auto& error : error_list_)
+        gui::out << gui::error << "gui::saved_variables_writer: " << error << std::endl;
+
+    error_list_.clear();
+}
+
+void saved_variables_writer::write_files_(const std::vector<file>& file_list) {
+    for (const auto& f : file_list) {
+        std::ofstream stream(f.name, std::ios::binary);
+        if (stream.is_open())
+            stream.write(f.content.data(), static_cast<std::streamsize>(f.content.size()));
+
+        // Only read by wait(), after the thread is joined
+        if (!stream.is_open() || !stream)
+            error_list_.push_back("Unable to write \"" + f.name + "\".");
+    }
+}
+
+} // namespace lxgui::gui
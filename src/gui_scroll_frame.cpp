@@ -256,7 +256,7 @@ void scroll_frame::render_scroll_strata_list_() {
 
     renderer.set_view(matrix4f::translation(-get_borders().top_left()) * matrix4f::view(view));
 
-    scroll_render_target_->clear(color::empty);
+    renderer.clear(color::empty);
 
     for (const auto& s : strata_list_) {
         render_strata_(s);
@@ -26,6 +26,13 @@ slider::slider(utils::control_block& block, manager& mgr, const frame_core_attri
 
     enable_mouse();
     enable_drag(input::mouse_button::left);
+
+    // The hit test is customized by this class, which could not be known by the base constructor
+    notify_frame_data_changed_();
+}
+
+bool slider::has_custom_hit_test_() const {
+    return true;
 }
 
 std::string slider::serialize(const std::string& tab) const {
@@ -11,6 +11,8 @@
 #include "lxgui/utils.hpp"
 #include "lxgui/utils_range.hpp"
 
+#include <algorithm>
+#include <iterator>
 #include <map>
 
 // #define DEBUG_LOG(msg) gui::out << (msg) << std::endl
@@ -280,13 +282,35 @@ float get_string_width(const text& txt, const std::vector<item>& content) {
 /** \endcond
  */
 
+struct text::line_glyphs {
+    std::vector<std::array<vertex, 4>> quads;
+    std::vector<std::array<vertex, 4>> outline_quads;
+    std::vector<quad>                  icons;
+};
+
+struct text::paragraph_layout {
+    utils::ustring            content;
+    std::vector<parser::line> lines;
+    bool                      is_laid_out = false;
+    bool                      is_last     = false;
+
+    // Glyphs of each line, placed horizontally; the vertical position is added when the
+    // lines are assembled, so that glyphs survive edits of the paragraphs above
+    std::vector<line_glyphs> glyphs;
+    std::vector<color>       begin_color_stack;
+    std::vector<color>       end_color_stack;
+    bool                     has_glyphs = false;
+};
+
 text::text(
     renderer& rdr, std::shared_ptr<const font> fnt, std::shared_ptr<const font> outline_font) :
     renderer_(rdr), font_(std::move(fnt)), outline_font_(std::move(outline_font)) {}
 
+text::~text() = default;
+
 float text::get_line_height() const {
     if (font_)
-        return font_->get_size() * scaling_factor_;
+        return font_->get_size() * get_glyph_scale_();
     else
         return 0.0;
 }
@@ -303,13 +327,84 @@ float text::get_scaling_factor() const {
     return scaling_factor_;
 }
 
+void text::set_font_size(float size) {
+    if (font_size_ == size)
+        return;
+
+    font_size_ = size;
+    notify_cache_dirty_();
+}
+
+float text::get_font_size() const {
+    return font_size_;
+}
+
+void text::set_outline_thickness(float thickness) {
+    // No need to update the cache: the outline is drawn from the same glyphs
+    outline_thickness_ = thickness;
+}
+
+float text::get_outline_thickness() const {
+    return outline_thickness_;
+}
+
 void text::set_text(const utils::ustring& content) {
     if (unicode_text_ == content)
         return;
 
     unicode_text_ = content;
 
-    notify_cache_dirty_();
+    // Only the content changed: paragraphs which are left untouched keep their layout
+    update_cache_flag_          = true;
+    update_paragraph_list_flag_ = true;
+}
+
+void text::replace_text(std::size_t pos, std::size_t count, const utils::ustring& content) {
+    pos   = std::min(pos, unicode_text_.size());
+    count = std::min(count, unicode_text_.size() - pos);
+    if (count == 0u && content.empty())
+        return;
+
+    unicode_text_.replace(pos, count, content);
+    update_cache_flag_ = true;
+
+    // If the paragraphs are not in sync with the text, they will be split from the full text
+    if (update_paragraph_list_flag_)
+        return;
+
+    // Find the paragraphs containing the first and the last replaced characters
+    std::size_t first       = 0u;
+    std::size_t first_start = 0u;
+    while (first_start + paragraph_list_[first].content.size() < pos) {
+        first_start += paragraph_list_[first].content.size() + 1u;
+        ++first;
+    }
+
+    std::size_t last       = first;
+    std::size_t last_start = first_start;
+    while (last_start + paragraph_list_[last].content.size() < pos + count) {
+        last_start += paragraph_list_[last].content.size() + 1u;
+        ++last;
+    }
+
+    // Only these paragraphs are split again, and will need a new layout
+    utils::ustring edited = paragraph_list_[first].content.substr(0u, pos - first_start);
+    edited += content;
+    edited += paragraph_list_[last].content.substr(pos + count - last_start);
+
+    std::vector<paragraph_layout> edited_list;
+    for (auto line : utils::cut_each(edited, U"\n")) {
+        paragraph_layout paragraph;
+        paragraph.content = line;
+        edited_list.push_back(std::move(paragraph));
+    }
+
+    paragraph_list_.erase(
+        paragraph_list_.begin() + static_cast<std::ptrdiff_t>(first),
+        paragraph_list_.begin() + static_cast<std::ptrdiff_t>(last + 1u));
+    paragraph_list_.insert(
+        paragraph_list_.begin() + static_cast<std::ptrdiff_t>(first),
+        std::make_move_iterator(edited_list.begin()), std::make_move_iterator(edited_list.end()));
 }
 
 const utils::ustring& text::get_text() const {
@@ -320,10 +415,10 @@ void text::set_color(const color& c, bool force_color) {
     if (color_ == c && force_color_ == force_color)
         return;
 
+    // No need to update the vertex cache: the color is applied as a tint when rendering,
+    // unless the text has color tags (see update_vertex_cache_())
     color_       = c;
     force_color_ = force_color;
-
-    notify_vertex_cache_dirty_();
 }
 
 const color& text::get_color() const {
@@ -334,9 +429,8 @@ void text::set_alpha(float alpha) {
     if (alpha == alpha_)
         return;
 
+    // No need to update the vertex cache: the alpha is applied as a tint when rendering
     alpha_ = alpha;
-
-    notify_vertex_cache_dirty_();
 }
 
 float text::get_alpha() const {
@@ -424,13 +518,13 @@ float text::get_character_width(char32_t c) const {
     if (!font_)
         return 0.0f;
     else if (c == U'\t')
-        return 4.0f * font_->get_character_width(U' ') * scaling_factor_;
+        return 4.0f * font_->get_character_width(U' ') * get_glyph_scale_();
     else
-        return font_->get_character_width(c) * scaling_factor_;
+        return font_->get_character_width(c) * get_glyph_scale_();
 }
 
 float text::get_character_kerning(char32_t c1, char32_t c2) const {
-    return font_->get_character_kerning(c1, c2) * scaling_factor_;
+    return font_->get_character_kerning(c1, c2) * get_glyph_scale_();
 }
 
 void text::set_alignment_x(alignment_x align_x) {
@@ -530,6 +624,7 @@ void text::set_formatting_enabled(bool formatting) {
 
     formatting_enabled_ = formatting;
 
+    notify_cache_dirty_();
     notify_vertex_cache_dirty_();
 }
 
@@ -542,7 +637,9 @@ bool text::get_use_vertex_cache() const {
 }
 
 bool text::use_vertex_cache_() const {
-    return renderer_.is_vertex_cache_supported() && use_vertex_cache_flag_;
+    // Vertex caches cannot be recorded in snapshots
+    return renderer_.is_vertex_cache_supported() && use_vertex_cache_flag_ &&
+           !renderer_.is_recording_snapshot();
 }
 
 void text::render(const matrix4f& transform) const {
@@ -559,15 +656,12 @@ void text::render(const matrix4f& transform) const {
     if (outline_font_) {
         if (const auto mat = outline_font_->get_texture().lock()) {
             if (use_vertex_cache && outline_vertex_cache_) {
-                renderer_.render_cache(mat.get(), *outline_vertex_cache_, transform);
+                renderer_.render_cache(
+                    mat.get(), *outline_vertex_cache_, transform, color(1.0f, 1.0f, 1.0f, alpha_));
             } else {
                 std::vector<std::array<vertex, 4>> quads_copy = outline_quad_list_;
-                for (auto& quad : quads_copy) {
-                    for (std::size_t i = 0; i < 4; ++i) {
-                        quad[i].pos = quad[i].pos * transform;
-                        quad[i].col.a *= alpha_;
-                    }
-                }
+                transform_quads(quads_copy, transform);
+                multiply_quads_alpha(quads_copy, alpha_);
 
                 renderer_.render_quads(mat.get(), quads_copy);
             }
@@ -575,38 +669,79 @@ void text::render(const matrix4f& transform) const {
     }
 
     if (const auto mat = font_->get_texture().lock()) {
-        if (use_vertex_cache && vertex_cache_) {
-            renderer_.render_cache(mat.get(), *vertex_cache_, transform);
-        } else {
-            std::vector<std::array<vertex, 4>> quads_copy = quad_list_;
-            for (auto& quad : quads_copy) {
-                for (std::size_t i = 0; i < 4; ++i) {
-                    quad[i].pos = quad[i].pos * transform;
-
-                    if (!formatting_enabled_ || force_color_ || quad[i].col == color::empty) {
-                        quad[i].col = color_;
-                    }
-
-                    quad[i].col.a *= alpha_;
-                }
+        const float spread = font_->get_distance_field_spread();
+        if (spread > 0.0f) {
+            if (outline_thickness_ > 0.0f) {
+                // The outline is rendered from the same glyphs, cut further from their edge
+                const float font_scale =
+                    font_size_ > 0.0f ? static_cast<float>(font_->get_size()) / font_size_ : 1.0f;
+                const float thickness = outline_thickness_ * font_scale;
+                renderer_.set_distance_field_threshold(
+                    std::max(0.5f - 0.5f * thickness / spread, 0.0f));
+                render_glyphs_(*mat, transform, use_vertex_cache, color::black);
             }
 
-            renderer_.render_quads(mat.get(), quads_copy);
+            renderer_.set_distance_field_threshold(0.5f);
         }
 
+        render_glyphs_(*mat, transform, use_vertex_cache, std::nullopt);
+
+        if (spread > 0.0f)
+            renderer_.set_distance_field_threshold(std::nullopt);
+
         for (auto quad : icons_list_) {
-            for (std::size_t i = 0; i < 4; ++i) {
-                quad.v[i].pos = quad.v[i].pos * transform;
-                quad.v[i].col.a *= alpha_;
-            }
+            transform_vertices(quad.v.data(), quad.v.size(), transform);
+            multiply_vertices_alpha(quad.v.data(), quad.v.size(), alpha_);
 
             renderer_.render_quad(quad);
         }
     }
 }
 
+void text::render_glyphs_(
+    const material&             mat,
+    const matrix4f&             transform,
+    bool                        use_vertex_cache,
+    const std::optional<color>& outline_color) const {
+    if (use_vertex_cache && vertex_cache_) {
+        // Without color tags, the cache is white and the text color goes in the tint.
+        // With color tags, the text color is baked in the cache, unless it is forced,
+        // in which case a separate all-white cache is used.
+        const vertex_cache* cache = vertex_cache_.get();
+        color               tint  = color::white;
+        if (outline_color.has_value())
+            tint = outline_color.value();
+        else if (!has_color_tags_ || force_color_)
+            tint = color_;
+        if (has_color_tags_ && force_color_ && !outline_color.has_value())
+            cache = forced_vertex_cache_.get();
+
+        tint.a *= alpha_;
+        renderer_.render_cache(&mat, *cache, transform, tint);
+    } else {
+        const bool  force         = force_color_ || outline_color.has_value();
+        const color default_color = outline_color.value_or(color_);
+
+        std::vector<std::array<vertex, 4>> quads_copy = quad_list_;
+        for (auto& quad : quads_copy) {
+            for (std::size_t i = 0; i < 4; ++i) {
+                if (!formatting_enabled_ || force || quad[i].col == color::empty) {
+                    quad[i].col = default_color;
+                }
+            }
+        }
+
+        transform_quads(quads_copy, transform);
+        multiply_quads_alpha(quads_copy, alpha_);
+
+        renderer_.render_quads(&mat, quads_copy);
+    }
+}
+
 void text::notify_cache_dirty_() const {
-    update_cache_flag_ = true;
+    update_cache_flag_          = true;
+    update_paragraph_list_flag_ = true;
+    paragraph_list_.clear();
 }
 
 void text::notify_vertex_cache_dirty_() const {
@@ -617,12 +752,20 @@ float text::round_to_pixel_(float value, utils::rounding_method method) const {
     return utils::round(value, scaling_factor_, method);
 }
 
+float text::get_glyph_scale_() const {
+    // Distance field fonts can be rendered at any size
+    if (font_size_ > 0.0f && font_ && font_->get_distance_field_spread() > 0.0f)
+        return scaling_factor_ * font_size_ / static_cast<float>(font_->get_size());
+
+    return scaling_factor_;
+}
+
 void text::update_() const {
     if (!font_ || !update_cache_flag_)
         return;
 
     // Update the line list, read format tags, do word wrapping, ...
-    std::vector<parser::line> line_list;
+    std::vector<const parser::line*> line_list;
 
     DEBUG_LOG("     Get max line nbr");
     std::size_t max_line_nbr = 0;
@@ -638,200 +781,25 @@ void text::update_() const {
         max_line_nbr = std::numeric_limits<std::size_t>::max();
 
     if (max_line_nbr != 0) {
-        auto manual_line_list = utils::cut_each(unicode_text_, U"\n");
-        for (auto iter_manual : utils::range::iterator(manual_line_list)) {
-            DEBUG_LOG("     Line: '" + utils::unicode_to_utf8(*iterManual) + "'");
-
-            // Parse the line
-            std::vector<parser::item> parsed_content =
-                parser::parse_string(renderer_, *iter_manual, formatting_enabled_);
-
-            // Make a temporary line array
-            std::vector<parser::line> lines;
+        update_paragraph_list_();
 
-            auto         iter_line_begin = parsed_content.begin();
-            parser::line line;
-            line.width = 0.0f;
-
-            bool done = false;
-            for (auto iter_char1 = parsed_content.begin(); iter_char1 != parsed_content.end();
-                 ++iter_char1) {
-                DEBUG_LOG("      Get width");
-                line.width += parser::get_full_advance(*this, iter_char1, iter_line_begin);
-                line.content.push_back(*iter_char1);
-
-                if (round_to_pixel_(line.width - box_width_) > 0) {
-                    DEBUG_LOG(
-                        "      Box break " + utils::to_string(line.width) + " > " +
-                        utils::to_string(box_width_));
-
-                    // Whoops, the line is too long...
-                    auto iter_space = std::find_if(
-                        line.content.begin(), line.content.end(), &parser::is_whitespace);
-
-                    if (iter_space != line.content.end() && word_wrap_enabled_) {
-                        DEBUG_LOG("       Spaced");
-                        // There are several words on this line, we'll
-                        // be able to put the last one on the next line
-                        auto                      iter_char2 = iter_char1 + 1;
-                        std::vector<parser::item> erased_content;
-                        std::size_t               chars_to_erase  = 0;
-                        float                     last_word_width = 0.0f;
-                        bool                      last_was_word   = false;
-                        while (line.width > box_width_ && iter_char2 != iter_line_begin) {
-                            --iter_char2;
-
-                            if (parser::is_whitespace(*iter_char2)) {
-                                if (!last_was_word || remove_starting_spaces_ ||
-                                    line.width - last_word_width > box_width_) {
-                                    last_word_width += parser::get_full_advance(
-                                        *this, iter_char2, iter_line_begin);
-                                    erased_content.insert(erased_content.begin(), *iter_char2);
-                                    ++chars_to_erase;
-
-                                    line.width -= last_word_width;
-                                    last_word_width = 0.0f;
-                                } else
-                                    break;
-                            } else {
-                                last_word_width +=
-                                    parser::get_full_advance(*this, iter_char2, iter_line_begin);
-                                erased_content.insert(erased_content.begin(), *iter_char2);
-                                ++chars_to_erase;
-
-                                last_was_word = true;
-                            }
-                        }
-
-                        if (remove_starting_spaces_) {
-                            while (iter_char2 != iter_char1 + 1 &&
-                                   parser::is_whitespace(*iter_char2)) {
-                                --chars_to_erase;
-                                erased_content.erase(erased_content.begin());
-                                ++iter_char2;
-                            }
-                        }
-
-                        line.width -= last_word_width;
-                        line.content.erase(line.content.end() - chars_to_erase, line.content.end());
-                        lines.push_back(line);
-
-                        line.width      = parser::get_string_width(*this, erased_content);
-                        line.content    = erased_content;
-                        iter_line_begin = iter_char1 - (line.content.size() - 1u);
-                    } else {
-                        DEBUG_LOG("       Single word");
-                        // There is only one word on this line, or word
-                        // wrap is disabled. Anyway, this line is just
-                        // too long for the text box: our only option
-                        // is to truncate it.
-                        if (ellipsis_enabled_) {
-                            DEBUG_LOG("       Ellipsis");
-                            // FIXME: this doesn't account for kerning between the "..." and prev
-                            // char
-                            float       word_width     = get_string_width(U"...");
-                            auto        iter_char2     = iter_char1 + 1;
-                            std::size_t chars_to_erase = 0;
-                            while (line.width + word_width > box_width_ &&
-                                   iter_char2 != iter_line_begin) {
-                                --iter_char2;
-                                line.width -=
-                                    parser::get_full_advance(*this, iter_char2, iter_line_begin);
-                                ++chars_to_erase;
-                            }
-
-                            DEBUG_LOG(
-                                "       Char to erase: " + utils::to_string(chars_to_erase) +
-                                " / " + utils::to_string(line.content.size()));
-
-                            line.content.erase(
-                                line.content.end() - chars_to_erase, line.content.end());
-                            line.content.push_back(U'.');
-                            line.content.push_back(U'.');
-                            line.content.push_back(U'.');
-                            line.width += word_width;
-                        } else {
-                            DEBUG_LOG("       Truncate");
-                            auto        iter_char2     = iter_char1 + 1;
-                            std::size_t chars_to_erase = 0;
-                            while (line.width > box_width_ && iter_char2 != iter_line_begin) {
-                                --iter_char2;
-                                line.width -=
-                                    parser::get_full_advance(*this, iter_char2, iter_line_begin);
-                                ++chars_to_erase;
-                            }
-
-                            line.content.erase(
-                                line.content.end() - chars_to_erase, line.content.end());
-                        }
-
-                        if (!word_wrap_enabled_) {
-                            DEBUG_LOG("       Display single line");
-                            // Word wrap is disabled, so we can only display one line anyway.
-                            line_list.push_back(line);
-                            done = true;
-                            break;
-                        }
-
-                        // Add the line
-                        lines.push_back(line);
-                        line.width = 0.0f;
-                        line.content.clear();
-
-                        DEBUG_LOG("       Continue");
-
-                        // Skip all following content (which we cannot display) until next
-                        // whitespace
-                        auto iter_temp = iter_char1;
-                        iter_char1 =
-                            std::find_if(iter_char1, parsed_content.end(), &parser::is_whitespace);
-
-                        if (iter_char1 == parsed_content.end())
-                            break;
-
-                        // Apply the format tags that were cut
-                        for (; iter_temp != iter_char1; ++iter_temp) {
-                            std::visit(
-                                [&](const auto& value) {
-                                    using type = std::decay_t<decltype(value)>;
-                                    if constexpr (std::is_same_v<type, parser::format>) {
-                                        line.content.push_back(value);
-                                    }
-                                },
-                                *iter_temp);
-                        }
-
-                        // Look for the next word
-                        iter_char1 =
-                            std::find_if(iter_char1, parsed_content.end(), &parser::is_word);
-                        if (iter_char1 != parsed_content.end())
-                            break;
-
-                        --iter_char1;
-                        iter_line_begin = iter_char1;
-                    }
-                }
-            }
-
-            if (done)
-                break;
-
-            DEBUG_LOG("     End");
-
-            lines.push_back(line);
+        for (auto& paragraph : paragraph_list_) {
+            // Only lay out what is displayed; the rest is laid out once it becomes visible
+            if (!paragraph.is_laid_out)
+                layout_paragraph_(paragraph);
 
             // Add the maximum number of line to this text
-            for (auto& l : lines) {
+            bool done = paragraph.is_last;
+            for (const auto& l : paragraph.lines) {
                 if (line_list.size() == max_line_nbr) {
                     done = true;
                     break;
                 }
-                line_list.push_back(std::move(l));
+                line_list.push_back(&l);
             }
 
             if (done)
                 break;
-            DEBUG_LOG("     .");
         }
     }
 
@@ -840,12 +808,13 @@ void text::update_() const {
     quad_list_.clear();
     outline_quad_list_.clear();
     icons_list_.clear();
+    line_first_letter_list_.clear();
 
     if (!line_list.empty()) {
         if (box_width_ == 0.0f || std::isinf(box_width_)) {
             width_ = 0.0f;
-            for (const auto& line : line_list)
-                width_ = std::max(width_, line.width);
+            for (const auto* line : line_list)
+                width_ = std::max(width_, line->width);
         } else
             width_ = box_width_;
 
@@ -882,92 +851,46 @@ void text::update_() const {
         y  = round_to_pixel_(y);
 
         std::vector<color> color_stack;
+        std::size_t        num_lines = 0u;
 
-        for (const auto& line : line_list) {
-            float x = 0.0f;
-            switch (align_x_) {
-            case alignment_x::left: x = 0.0f; break;
-            case alignment_x::center: x = -line.width * 0.5f; break;
-            case alignment_x::right: x = -line.width; break;
-            }
-
-            x = round_to_pixel_(x) + x0;
-
-            for (auto iter_char : utils::range::iterator(line.content)) {
-                const auto advance = parser::get_advance(*this, iter_char, line.content.begin());
+        for (auto& paragraph : paragraph_list_) {
+            if (num_lines == line_list.size())
+                break;
 
-                x += advance.first;
+            // Glyphs are kept until the paragraph, or the colors it starts with, change
+            if (!paragraph.has_glyphs || paragraph.begin_color_stack != color_stack)
+                build_paragraph_glyphs_(paragraph, color_stack, x0);
 
-                std::visit(
-                    [&](const auto& value) {
-                        using type = std::decay_t<decltype(value)>;
-                        if constexpr (std::is_same_v<type, parser::format>) {
-                            switch (value.action) {
-                            case parser::color_action::set: color_stack.push_back(value.col); break;
-                            case parser::color_action::reset: color_stack.pop_back(); break;
-                            default: break;
-                            }
-                        } else if constexpr (std::is_same_v<type, parser::texture>) {
-                            float tex_width = 0.0f, tex_height = 0.0f;
-                            if (std::isnan(value.width)) {
-                                tex_width  = get_line_height();
-                                tex_height = get_line_height();
-                            } else {
-                                tex_width  = value.width * get_scaling_factor();
-                                tex_height = value.height * get_scaling_factor();
-                            }
+            color_stack = paragraph.end_color_stack;
 
-                            tex_width  = round_to_pixel_(tex_width);
-                            tex_height = round_to_pixel_(tex_height);
-
-                            quad icon;
-                            icon.mat      = value.mat;
-                            icon.v[0].pos = vector2f(0.0f, 0.0f);
-                            icon.v[1].pos = vector2f(tex_width, 0.0f);
-                            icon.v[2].pos = vector2f(tex_width, tex_height);
-                            icon.v[3].pos = vector2f(0.0f, tex_height);
-                            if (icon.mat) {
-                                icon.v[0].uvs = icon.mat->get_canvas_uv(vector2f(0.0f, 0.0f), true);
-                                icon.v[1].uvs = icon.mat->get_canvas_uv(vector2f(1.0f, 0.0f), true);
-                                icon.v[2].uvs = icon.mat->get_canvas_uv(vector2f(1.0f, 1.0f), true);
-                                icon.v[3].uvs = icon.mat->get_canvas_uv(vector2f(0.0f, 1.0f), true);
-                            }
+            for (const auto& glyphs : paragraph.glyphs) {
+                if (num_lines == line_list.size())
+                    break;
 
-                            for (std::size_t i = 0; i < 4; ++i) {
-                                icon.v[i].pos += vector2f(round_to_pixel_(x), round_to_pixel_(y));
-                            }
+                ++num_lines;
+                line_first_letter_list_.push_back(quad_list_.size());
 
-                            icons_list_.push_back(icon);
-                        } else if constexpr (std::is_same_v<type, char32_t>) {
-                            if (outline_font_) {
-                                std::array<vertex, 4> vertex_list =
-                                    create_outline_letter_quad_(value);
-                                for (std::size_t i = 0; i < 4; ++i) {
-                                    vertex_list[i].pos +=
-                                        vector2f(round_to_pixel_(x), round_to_pixel_(y));
-                                    vertex_list[i].col = color::black;
-                                }
-
-                                outline_quad_list_.push_back(vertex_list);
-                            }
+                const float line_y = round_to_pixel_(y);
+                for (auto vertex_list : glyphs.quads) {
+                    for (std::size_t i = 0; i < 4; ++i)
+                        vertex_list[i].pos.y += line_y;
+                    quad_list_.push_back(vertex_list);
+                }
 
-                            std::array<vertex, 4> vertex_list = create_letter_quad_(value);
-                            for (std::size_t i = 0; i < 4; ++i) {
-                                vertex_list[i].pos +=
-                                    vector2f(round_to_pixel_(x), round_to_pixel_(y));
-                                vertex_list[i].col =
-                                    color_stack.empty() ? color::empty : color_stack.back();
-                            }
+                for (auto vertex_list : glyphs.outline_quads) {
+                    for (std::size_t i = 0; i < 4; ++i)
+                        vertex_list[i].pos.y += line_y;
+                    outline_quad_list_.push_back(vertex_list);
+                }
 
-                            quad_list_.push_back(vertex_list);
-                        }
-                    },
-                    *iter_char);
+                for (auto icon : glyphs.icons) {
+                    for (std::size_t i = 0; i < 4; ++i)
+                        icon.v[i].pos.y += line_y;
+                    icons_list_.push_back(icon);
+                }
 
-                x += advance.second;
+                y += get_line_height() * line_spacing_;
             }
-
-            y += get_line_height() * line_spacing_;
         }
     } else {
         width_  = 0.0f;
@@ -979,45 +902,384 @@ void text::update_() const {
     notify_vertex_cache_dirty_();
 }
 
-void text::update_vertex_cache_() const {
-    if (!update_vertex_cache_flag_)
+void text::update_paragraph_list_() const {
+    if (!update_paragraph_list_flag_)
         return;
 
-    if (!vertex_cache_)
-        vertex_cache_ = renderer_.create_vertex_cache(vertex_cache::type::quads);
+    update_paragraph_list_flag_ = false;
+
+    auto manual_line_list = utils::cut_each(unicode_text_, U"\n");
+
+    // Keep the layout of the paragraphs which have not changed since the last update. Edits
+    // usually touch a single paragraph, so only compare the start and the end of the text.
+    const std::size_t old_count = paragraph_list_.size();
+    const std::size_t new_count = manual_line_list.size();
+
+    std::size_t num_prefix = 0u;
+    while (num_prefix < old_count && num_prefix < new_count &&
+           paragraph_list_[num_prefix].content == manual_line_list[num_prefix]) {
+        ++num_prefix;
+    }
+
+    std::size_t num_suffix = 0u;
+    while (num_suffix < old_count - num_prefix && num_suffix < new_count - num_prefix &&
+           paragraph_list_[old_count - 1u - num_suffix].content ==
+               manual_line_list[new_count - 1u - num_suffix]) {
+        ++num_suffix;
+    }
+
+    if (num_prefix == old_count && num_prefix == new_count)
+        return;
+
+    std::vector<paragraph_layout> new_list;
+    new_list.reserve(new_count);
+
+    for (std::size_t i = 0u; i < num_prefix; ++i)
+        new_list.push_back(std::move(paragraph_list_[i]));
+
+    for (std::size_t i = num_prefix; i < new_count - num_suffix; ++i) {
+        paragraph_layout paragraph;
+        paragraph.content = manual_line_list[i];
+        new_list.push_back(std::move(paragraph));
+    }
+
+    for (std::size_t i = old_count - num_suffix; i < old_count; ++i)
+        new_list.push_back(std::move(paragraph_list_[i]));
+
+    paragraph_list_ = std::move(new_list);
+}
+
+void text::layout_paragraph_(paragraph_layout& paragraph) const {
+    DEBUG_LOG("     Line: '" + utils::unicode_to_utf8(paragraph.content) + "'");
+
+    // Parse the line
+    std::vector<parser::item> parsed_content =
+        parser::parse_string(renderer_, paragraph.content, formatting_enabled_);
+
+    auto& lines = paragraph.lines;
+    lines.clear();
+    paragraph.is_last     = false;
+    paragraph.is_laid_out = true;
+    paragraph.has_glyphs  = false;
+
+    auto         iter_line_begin = parsed_content.begin();
+    parser::line line;
+    line.width = 0.0f;
+
+    for (auto iter_char1 = parsed_content.begin(); iter_char1 != parsed_content.end();
+         ++iter_char1) {
+        DEBUG_LOG("      Get width");
+        line.width += parser::get_full_advance(*this, iter_char1, iter_line_begin);
+        line.content.push_back(*iter_char1);
+
+        if (round_to_pixel_(line.width - box_width_) > 0) {
+            DEBUG_LOG(
+                "      Box break " + utils::to_string(line.width) + " > " +
+                utils::to_string(box_width_));
+
+            // Whoops, the line is too long...
+            auto iter_space =
+                std::find_if(line.content.begin(), line.content.end(), &parser::is_whitespace);
+
+            if (iter_space != line.content.end() && word_wrap_enabled_) {
+                DEBUG_LOG("       Spaced");
+                // There are several words on this line, we'll
+                // be able to put the last one on the next line
+                auto                      iter_char2 = iter_char1 + 1;
+                std::vector<parser::item> erased_content;
+                std::size_t               chars_to_erase  = 0;
+                float                     last_word_width = 0.0f;
+                bool                      last_was_word   = false;
+                while (line.width > box_width_ && iter_char2 != iter_line_begin) {
+                    --iter_char2;
+
+                    if (parser::is_whitespace(*iter_char2)) {
+                        if (!last_was_word || remove_starting_spaces_ ||
+                            line.width - last_word_width > box_width_) {
+                            last_word_width +=
+                                parser::get_full_advance(*this, iter_char2, iter_line_begin);
+                            erased_content.insert(erased_content.begin(), *iter_char2);
+                            ++chars_to_erase;
+
+                            line.width -= last_word_width;
+                            last_word_width = 0.0f;
+                        } else
+                            break;
+                    } else {
+                        last_word_width +=
+                            parser::get_full_advance(*this, iter_char2, iter_line_begin);
+                        erased_content.insert(erased_content.begin(), *iter_char2);
+                        ++chars_to_erase;
+
+                        last_was_word = true;
+                    }
+                }
+
+                if (remove_starting_spaces_) {
+                    while (iter_char2 != iter_char1 + 1 && parser::is_whitespace(*iter_char2)) {
+                        --chars_to_erase;
+                        erased_content.erase(erased_content.begin());
+                        ++iter_char2;
+                    }
+                }
+
+                line.width -= last_word_width;
+                line.content.erase(line.content.end() - chars_to_erase, line.content.end());
+                lines.push_back(line);
+
+                line.width      = parser::get_string_width(*this, erased_content);
+                line.content    = erased_content;
+                iter_line_begin = iter_char1 - (line.content.size() - 1u);
+            } else {
+                DEBUG_LOG("       Single word");
+                // There is only one word on this line, or word
+                // wrap is disabled. Anyway, this line is just
+                // too long for the text box: our only option
+                // is to truncate it.
+                if (ellipsis_enabled_) {
+                    DEBUG_LOG("       Ellipsis");
+                    // FIXME: this doesn't account for kerning between the "..." and prev
+                    // char
+                    float       word_width     = get_string_width(U"...");
+                    auto        iter_char2     = iter_char1 + 1;
+                    std::size_t chars_to_erase = 0;
+                    while (line.width + word_width > box_width_ && iter_char2 != iter_line_begin) {
+                        --iter_char2;
+                        line.width -= parser::get_full_advance(*this, iter_char2, iter_line_begin);
+                        ++chars_to_erase;
+                    }
+
+                    DEBUG_LOG(
+                        "       Char to erase: " + utils::to_string(chars_to_erase) + " / " +
+                        utils::to_string(line.content.size()));
+
+                    line.content.erase(line.content.end() - chars_to_erase, line.content.end());
+                    line.content.push_back(U'.');
+                    line.content.push_back(U'.');
+                    line.content.push_back(U'.');
+                    line.width += word_width;
+                } else {
+                    DEBUG_LOG("       Truncate");
+                    auto        iter_char2     = iter_char1 + 1;
+                    std::size_t chars_to_erase = 0;
+                    while (line.width > box_width_ && iter_char2 != iter_line_begin) {
+                        --iter_char2;
+                        line.width -= parser::get_full_advance(*this, iter_char2, iter_line_begin);
+                        ++chars_to_erase;
+                    }
+
+                    line.content.erase(line.content.end() - chars_to_erase, line.content.end());
+                }
+
+                if (!word_wrap_enabled_) {
+                    DEBUG_LOG("       Display single line");
+                    // Word wrap is disabled, so we can only display one line anyway.
+                    lines.push_back(line);
+                    paragraph.is_last = true;
+                    break;
+                }
+
+                // Add the line
+                lines.push_back(line);
+                line.width = 0.0f;
+                line.content.clear();
+
+                DEBUG_LOG("       Continue");
+
+                // Skip all following content (which we cannot display) until next
+                // whitespace
+                auto iter_temp = iter_char1;
+                iter_char1 = std::find_if(iter_char1, parsed_content.end(), &parser::is_whitespace);
+
+                if (iter_char1 == parsed_content.end())
+                    break;
+
+                // Apply the format tags that were cut
+                for (; iter_temp != iter_char1; ++iter_temp) {
+                    std::visit(
+                        [&](const auto& value) {
+                            using type = std::decay_t<decltype(value)>;
+                            if constexpr (std::is_same_v<type, parser::format>) {
+                                line.content.push_back(value);
+                            }
+                        },
+                        *iter_temp);
+                }
+
+                // Look for the next word
+                iter_char1 = std::find_if(iter_char1, parsed_content.end(), &parser::is_word);
+                if (iter_char1 != parsed_content.end())
+                    break;
+
+                --iter_char1;
+                iter_line_begin = iter_char1;
+            }
+        }
+    }
 
+    if (paragraph.is_last)
+        return;
+
+    lines.push_back(line);
+}
+
+void text::build_paragraph_glyphs_(
+    paragraph_layout& paragraph, const std::vector<color>& begin_color_stack, float x0) const {
+    std::vector<color> color_stack = begin_color_stack;
+
+    paragraph.glyphs.clear();
+    for (const auto& line : paragraph.lines) {
+        auto& glyphs = paragraph.glyphs.emplace_back();
+
+        float x = 0.0f;
+        switch (align_x_) {
+        case alignment_x::left: x = 0.0f; break;
+        case alignment_x::center: x = -line.width * 0.5f; break;
+        case alignment_x::right: x = -line.width; break;
+        }
+
+        x = round_to_pixel_(x) + x0;
+
+        for (auto iter_char : utils::range::iterator(line.content)) {
+            const auto advance = parser::get_advance(*this, iter_char, line.content.begin());
+
+            x += advance.first;
+
+            std::visit(
+                [&](const auto& value) {
+                    using type = std::decay_t<decltype(value)>;
+                    if constexpr (std::is_same_v<type, parser::format>) {
+                        switch (value.action) {
+                        case parser::color_action::set: color_stack.push_back(value.col); break;
+                        case parser::color_action::reset: color_stack.pop_back(); break;
+                        default: break;
+                        }
+                    } else if constexpr (std::is_same_v<type, parser::texture>) {
+                        float tex_width = 0.0f, tex_height = 0.0f;
+                        if (std::isnan(value.width)) {
+                            tex_width  = get_line_height();
+                            tex_height = get_line_height();
+                        } else {
+                            tex_width  = value.width * get_scaling_factor();
+                            tex_height = value.height * get_scaling_factor();
+                        }
+
+                        tex_width  = round_to_pixel_(tex_width);
+                        tex_height = round_to_pixel_(tex_height);
+
+                        quad icon;
+                        icon.mat      = value.mat;
+                        icon.v[0].pos = vector2f(0.0f, 0.0f);
+                        icon.v[1].pos = vector2f(tex_width, 0.0f);
+                        icon.v[2].pos = vector2f(tex_width, tex_height);
+                        icon.v[3].pos = vector2f(0.0f, tex_height);
+                        if (icon.mat) {
+                            icon.v[0].uvs = icon.mat->get_canvas_uv(vector2f(0.0f, 0.0f), true);
+                            icon.v[1].uvs = icon.mat->get_canvas_uv(vector2f(1.0f, 0.0f), true);
+                            icon.v[2].uvs = icon.mat->get_canvas_uv(vector2f(1.0f, 1.0f), true);
+                            icon.v[3].uvs = icon.mat->get_canvas_uv(vector2f(0.0f, 1.0f), true);
+                        }
+
+                        for (std::size_t i = 0; i < 4; ++i) {
+                            icon.v[i].pos.x += round_to_pixel_(x);
+                        }
+
+                        glyphs.icons.push_back(icon);
+                    } else if constexpr (std::is_same_v<type, char32_t>) {
+                        if (outline_font_) {
+                            std::array<vertex, 4> vertex_list = create_outline_letter_quad_(value);
+                            for (std::size_t i = 0; i < 4; ++i) {
+                                vertex_list[i].pos.x += round_to_pixel_(x);
+                                vertex_list[i].col = color::black;
+                            }
+
+                            glyphs.outline_quads.push_back(vertex_list);
+                        }
+
+                        std::array<vertex, 4> vertex_list = create_letter_quad_(value);
+                        for (std::size_t i = 0; i < 4; ++i) {
+                            vertex_list[i].pos.x += round_to_pixel_(x);
+                            vertex_list[i].col =
+                                color_stack.empty() ? color::empty : color_stack.back();
+                        }
+
+                        glyphs.quads.push_back(vertex_list);
+                    }
+                },
+                *iter_char);
+
+            x += advance.second;
+        }
+    }
+
+    paragraph.begin_color_stack = begin_color_stack;
+    paragraph.end_color_stack   = std::move(color_stack);
+    paragraph.has_glyphs        = true;
+}
+
+void text::fill_vertex_cache_(vertex_cache& cache, const color& default_color, bool force) const {
     std::vector<std::array<vertex, 4>> quads_copy = quad_list_;
     for (auto& quad : quads_copy) {
         for (std::size_t i = 0; i < 4; ++i) {
-            if (!formatting_enabled_ || force_color_ || quad[i].col == color::empty) {
-                quad[i].col = color_;
+            if (!formatting_enabled_ || force || quad[i].col == color::empty) {
+                quad[i].col = default_color;
             }
-
-            quad[i].col.a *= alpha_;
         }
     }
 
-    vertex_cache_->update(quads_copy[0].data(), quads_copy.size() * 4);
-
-    if (outline_font_) {
-        if (!outline_vertex_cache_)
-            outline_vertex_cache_ = renderer_.create_vertex_cache(vertex_cache::type::quads);
+    cache.update(quads_copy[0].data(), quads_copy.size() * 4);
+}
 
-        std::vector<std::array<vertex, 4>> outline_quads_copy = outline_quad_list_;
-        for (auto& quad : outline_quads_copy) {
-            for (std::size_t i = 0; i < 4; ++i) {
-                quad[i].col.a *= alpha_;
+void text::update_vertex_cache_() const {
+    // Color and alpha are applied as a tint when rendering the caches, so they only need
+    // updating when the glyphs change. The exception is text with color tags: the text
+    // color only applies to glyphs without a color tag, so it must be baked in the cache.
+    if (update_vertex_cache_flag_) {
+        has_color_tags_ = false;
+        if (formatting_enabled_) {
+            for (const auto& quad : quad_list_) {
+                if (quad[0].col != color::empty) {
+                    has_color_tags_ = true;
+                    break;
+                }
             }
         }
 
-        outline_vertex_cache_->update(outline_quads_copy[0].data(), outline_quads_copy.size() * 4);
+        if (!vertex_cache_)
+            vertex_cache_ = renderer_.create_vertex_cache(vertex_cache::type::quads);
+
+        vertex_cache_color_ = has_color_tags_ ? color_ : color::white;
+        fill_vertex_cache_(*vertex_cache_, vertex_cache_color_, false);
+
+        update_forced_vertex_cache_flag_ = has_color_tags_;
+
+        if (outline_font_) {
+            if (!outline_vertex_cache_)
+                outline_vertex_cache_ = renderer_.create_vertex_cache(vertex_cache::type::quads);
+
+            outline_vertex_cache_->update(
+                outline_quad_list_[0].data(), outline_quad_list_.size() * 4);
+        }
+
+        update_vertex_cache_flag_ = false;
+    } else if (has_color_tags_ && !force_color_ && vertex_cache_color_ != color_) {
+        vertex_cache_color_ = color_;
+        fill_vertex_cache_(*vertex_cache_, vertex_cache_color_, false);
     }
 
-    update_vertex_cache_flag_ = false;
+    if (has_color_tags_ && force_color_ && update_forced_vertex_cache_flag_) {
+        // Forced color (e.g., for shadows): all glyphs are white, and colored by the tint
+        if (!forced_vertex_cache_) {
+            forced_vertex_cache_ = renderer_.create_vertex_cache(vertex_cache::type::quads);
+        }
+
+        fill_vertex_cache_(*forced_vertex_cache_, color::white, true);
+        update_forced_vertex_cache_flag_ = false;
+    }
 }
 
 std::array<vertex, 4> text::create_letter_quad_(const gui::font& font, char32_t c) const {
-    bounds2f quad = font.get_character_bounds(c) * scaling_factor_;
+    bounds2f quad = font.get_character_bounds(c) * get_glyph_scale_();
 
     std::array<vertex, 4> vertex_list;
     vertex_list[0].pos = quad.top_left();
@@ -1064,4 +1326,15 @@ const std::array<vertex, 4>& text::get_letter_quad(std::size_t index) const {
     return quad_list_[index];
 }
 
+std::size_t text::get_letter_line(std::size_t index) const {
+    update_();
+
+    if (index >= quad_list_.size())
+        throw gui::exception("text", "Trying to access letter at invalid index.");
+
+    auto iter = std::upper_bound(
+        line_first_letter_list_.begin(), line_first_letter_list_.end(), index);
+    return static_cast<std::size_t>(iter - line_first_letter_list_.begin()) - 1u;
+}
+
 } // namespace lxgui::gui
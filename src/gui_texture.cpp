@@ -67,8 +67,7 @@ void texture::render() const {
 
     if (alpha != 1.0f) {
         quad blended_quad = quad_;
-        for (std::size_t i = 0; i < 4; ++i)
-            blended_quad.v[i].col.a *= alpha;
+        multiply_vertices_alpha(blended_quad.v.data(), blended_quad.v.size(), alpha);
 
         renderer_.render_quad(blended_quad);
     } else {
@@ -389,6 +388,14 @@ void texture::set_vertex_color(const color& c, std::size_t index) {
     notify_renderer_need_redraw();
 }
 
+std::optional<color> texture::get_animation_color_() const {
+    return quad_.v[0].col;
+}
+
+void texture::set_animation_color_(const color& c) {
+    set_vertex_color(c);
+}
+
 void texture::update_borders_() {
     base::update_borders_();
 
@@ -0,0 +1,131 @@
+#include "lxgui/gui_timer_scheduler.hpp"
+
+#include "lxgui/gui_out.hpp"
+
+#include <algorithm>
+
+namespace lxgui::gui {
+
+namespace {
+template<typename T>
+bool is_later(const T& entry1, const T& entry2) {
+    // Timers due at the same time are called in order of creation
+    return entry1.time > entry2.time || (entry1.time == entry2.time && entry1.id > entry2.id);
+}
+} // namespace
+
+timer_scheduler::timer_id timer_scheduler::run_after(double delay, function_type function) {
+    timer data;
+    data.function = std::move(function);
+
+    return add_timer_(time_ + std::max(delay, 0.0), std::move(data));
+}
+
+timer_scheduler::timer_id timer_scheduler::run_every(double interval, function_type function) {
+    timer data;
+    data.function     = std::move(function);
+    data.interval     = std::max(interval, 0.0);
+    data.is_repeating = true;
+
+    const double first_time = time_ + data.interval;
+    return add_timer_(first_time, std::move(data));
+}
+
+timer_scheduler::timer_id timer_scheduler::add_timer_(double time, timer data) {
+    const timer_id id = next_id_;
+    ++next_id_;
+
+    timer_list_.emplace(id, std::move(data));
+    push_(time, id);
+
+    return id;
+}
+
+void timer_scheduler::push_(double time, timer_id id) {
+    heap_.push_back(heap_entry{time, id});
+    std::push_heap(heap_.begin(), heap_.end(), &is_later<heap_entry>);
+}
+
+bool timer_scheduler::cancel(timer_id id) {
+    if (timer_list_.erase(id) == 0u)
+        return false;
+
+    // Entries of cancelled timers are skipped when they are due; only remove them from the
+    // heap when they make up most of it, e.g., after cancelling many long timers
+    if (heap_.size() > 2u * timer_list_.size() + 64u) {
+        heap_.erase(
+            std::remove_if(
+                heap_.begin(), heap_.end(),
+                [&](const heap_entry& entry) {
+                    return timer_list_.find(entry.id) == timer_list_.end();
+                }),
+            heap_.end());
+
+        std::make_heap(heap_.begin(), heap_.end(), &is_later<heap_entry>);
+    }
+
+    return true;
+}
+
+void timer_scheduler::clear() {
+    timer_list_.clear();
+    heap_.clear();
+}
+
+bool timer_scheduler::is_scheduled(timer_id id) const {
+    return timer_list_.find(id) != timer_list_.end();
+}
+
+std::size_t timer_scheduler::get_timer_count() const {
+    return timer_list_.size();
+}
+
+double timer_scheduler::get_time() const {
+    return time_;
+}
+
+void timer_scheduler::update(double delta) {
+    time_ += delta;
+
+    if (heap_.empty() || heap_.front().time > time_)
+        return;
+
+    // Take all the due timers first, so that timers created or re-scheduled by the functions
+    // are only called on the next update. NB: the list is moved out in case a function
+    // updates this scheduler recursively.
+    std::vector<heap_entry> due_list = std::move(due_list_);
+    due_list.clear();
+
+    while (!heap_.empty() && heap_.front().time <= time_) {
+        std::pop_heap(heap_.begin(), heap_.end(), &is_later<heap_entry>);
+        due_list.push_back(heap_.back());
+        heap_.pop_back();
+    }
+
+    for (const auto& entry : due_list) {
+        auto iter = timer_list_.find(entry.id);
+        if (iter == timer_list_.end())
+            continue;
+
+        // The function is moved or copied out of the list, as it may cancel its own timer
+        function_type function;
+        if (iter->second.is_repeating) {
+            // Skip the intervals which were missed, rather than calling the function repeatedly
+            push_(std::max(entry.time + iter->second.interval, time_), entry.id);
+            function = iter->second.function;
+        } else {
+            function = std::move(iter->second.function);
+            timer_list_.erase(iter);
+        }
+
+        try {
+            function();
+        } catch (const std::exception& e) {
+            gui::out << gui::error << "gui::timer_scheduler: " << e.what() << std::endl;
+        }
+    }
+
+    due_list_ = std::move(due_list);
+}
+
+} // namespace lxgui::gui
@@ -0,0 +1,238 @@
+#include "lxgui/gui_translation_table.hpp"
+
+#include "lxgui/gui_exception.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <numeric>
+#include <unordered_set>
+
+namespace lxgui::gui {
+
+namespace {
+
+constexpr char          file_magic[4]      = {'L', 'X', 'T', 'R'};
+constexpr std::uint32_t file_version       = 1u;
+constexpr std::uint32_t file_byte_order    = 0x01020304u;
+constexpr std::uint32_t max_displacement   = 1u << 24u;
+constexpr std::size_t   header_field_count = 5u;
+
+std::uint64_t hash_key(std::string_view key, std::uint32_t seed) noexcept {
+    // FNV-1a, seeded, followed by the MurmurHash3 finalizer for better avalanche
+    std::uint64_t hash = 14695981039346656037ull ^ (seed * 0x9e3779b97f4a7c15ull);
+    for (char c : key) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ull;
+    }
+
+    hash ^= hash >> 33u;
+    hash *= 0xff51afd7ed558ccdull;
+    hash ^= hash >> 33u;
+    hash *= 0xc4ceb9fe1a85ec53ull;
+    hash ^= hash >> 33u;
+    return hash;
+}
+
+template<typename T>
+void write_raw(std::ofstream& stream, const T& value) {
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template<typename T>
+void read_raw(std::string_view& data, T& value, const std::string& file_name) {
+    if (data.size() < sizeof(T))
+        throw gui::exception("gui::translation_table", "unexpected end of file in " + file_name);
+
+    std::memcpy(&value, data.data(), sizeof(T));
+    data.remove_prefix(sizeof(T));
+}
+
+} // namespace
+
+translation_table::translation_table(const std::string& file_name) {
+    auto content = utils::read_file(file_name);
+    if (!content.has_value())
+        throw gui::exception("gui::translation_table", "could not open " + file_name);
+
+    content_              = std::move(content.value());
+    std::string_view data = content_.get_view();
+
+    char magic[4];
+    read_raw(data, magic, file_name);
+    if (std::memcmp(magic, file_magic, sizeof(magic)) != 0)
+        throw gui::exception("gui::translation_table", file_name + " is not a translation table");
+
+    std::uint32_t header[header_field_count];
+    read_raw(data, header, file_name);
+
+    const auto [version, byte_order, bucket_count, slot_count, pool_size] = header;
+    if (version != file_version) {
+        throw gui::exception(
+            "gui::translation_table",
+            "unsupported version " + std::to_string(version) + " in " + file_name);
+    }
+
+    if (byte_order != file_byte_order) {
+        throw gui::exception(
+            "gui::translation_table", file_name + " was created on a different architecture");
+    }
+
+    const std::size_t expected_size = bucket_count * sizeof(std::uint32_t) +
+                                      slot_count * sizeof(slot_data) +
+                                      static_cast<std::size_t>(pool_size);
+    if (data.size() != expected_size || (bucket_count == 0u && slot_count != 0u))
+        throw gui::exception("gui::translation_table", "corrupted file " + file_name);
+
+    displacements_.resize(bucket_count);
+    std::memcpy(displacements_.data(), data.data(), bucket_count * sizeof(std::uint32_t));
+    data.remove_prefix(bucket_count * sizeof(std::uint32_t));
+
+    slots_.resize(slot_count);
+    std::memcpy(slots_.data(), data.data(), slot_count * sizeof(slot_data));
+    data.remove_prefix(slot_count * sizeof(slot_data));
+
+    pool_ = data;
+
+    for (const auto& slot : slots_) {
+        if (static_cast<std::size_t>(slot.key_offset) + slot.key_size > pool_.size() ||
+            static_cast<std::size_t>(slot.value_offset) + slot.value_size > pool_.size()) {
+            throw gui::exception("gui::translation_table", "corrupted file " + file_name);
+        }
+    }
+}
+
+std::size_t translation_table::get_entry_count() const {
+    return slots_.size();
+}
+
+std::string_view translation_table::get_key(std::size_t slot) const {
+    const auto& data = slots_[slot];
+    return pool_.substr(data.key_offset, data.key_size);
+}
+
+std::string_view translation_table::get_value(std::size_t slot) const {
+    const auto& data = slots_[slot];
+    return pool_.substr(data.value_offset, data.value_size);
+}
+
+std::optional<std::size_t> translation_table::find(std::string_view key) const {
+    if (slots_.empty())
+        return std::nullopt;
+
+    const std::size_t   bucket       = hash_key(key, 0u) % displacements_.size();
+    const std::uint32_t displacement = displacements_[bucket];
+    if (displacement == 0u)
+        return std::nullopt;
+
+    const std::size_t slot = hash_key(key, displacement) % slots_.size();
+    if (get_key(slot) != key)
+        return std::nullopt;
+
+    return slot;
+}
+
+void translation_table::save(const std::string& file_name, const std::vector<entry>& entries) {
+    const std::size_t entry_count = entries.size();
+
+    std::unordered_set<std::string_view> unique_keys;
+    for (const auto& [key, value] : entries) {
+        if (!unique_keys.insert(key).second)
+            throw gui::exception("gui::translation_table", "duplicate key '" + key + "'");
+    }
+
+    // Hash and displace: keys are first distributed into buckets, then each bucket (largest
+    // first) searches for a displacement that sends all its keys into free slots.
+    const std::size_t bucket_count = std::max<std::size_t>(entry_count, 1u);
+    const std::size_t slot_count   = entry_count;
+
+    std::vector<std::vector<std::size_t>> buckets(bucket_count);
+    for (std::size_t i = 0; i < entry_count; ++i)
+        buckets[hash_key(entries[i].first, 0u) % bucket_count].push_back(i);
+
+    std::vector<std::size_t> bucket_order(bucket_count);
+    std::iota(bucket_order.begin(), bucket_order.end(), 0u);
+    std::stable_sort(bucket_order.begin(), bucket_order.end(), [&](auto b1, auto b2) {
+        return buckets[b1].size() > buckets[b2].size();
+    });
+
+    std::vector<std::uint32_t> displacements(bucket_count, 0u);
+    std::vector<std::size_t>   entry_of_slot(slot_count, entry_count);
+    std::vector<std::size_t>   bucket_slots;
+
+    for (std::size_t bucket : bucket_order) {
+        const auto& bucket_entries = buckets[bucket];
+        if (bucket_entries.empty())
+            break;
+
+        for (std::uint32_t displacement = 1u;; ++displacement) {
+            if (displacement == max_displacement) {
+                throw gui::exception(
+                    "gui::translation_table",
+                    "could not build perfect hash index for " + file_name);
+            }
+
+            bucket_slots.clear();
+            bool success = true;
+            for (std::size_t entry_id : bucket_entries) {
+                const std::size_t slot =
+                    hash_key(entries[entry_id].first, displacement) % slot_count;
+                if (entry_of_slot[slot] != entry_count ||
+                    std::find(bucket_slots.begin(), bucket_slots.end(), slot) !=
+                        bucket_slots.end()) {
+                    success = false;
+                    break;
+                }
+
+                bucket_slots.push_back(slot);
+            }
+
+            if (!success)
+                continue;
+
+            for (std::size_t i = 0; i < bucket_entries.size(); ++i)
+                entry_of_slot[bucket_slots[i]] = bucket_entries[i];
+
+            displacements[bucket] = displacement;
+            break;
+        }
+    }
+
+    std::string            pool;
+    std::vector<slot_data> slots(slot_count);
+    for (std::size_t slot = 0; slot < slot_count; ++slot) {
+        const auto& [key, value] = entries[entry_of_slot[slot]];
+        if (pool.size() + key.size() + value.size() > std::numeric_limits<std::uint32_t>::max())
+            throw gui::exception("gui::translation_table", "too much data for " + file_name);
+
+        auto& data        = slots[slot];
+        data.key_offset   = static_cast<std::uint32_t>(pool.size());
+        data.key_size     = static_cast<std::uint32_t>(key.size());
+        pool += key;
+        data.value_offset = static_cast<std::uint32_t>(pool.size());
+        data.value_size   = static_cast<std::uint32_t>(value.size());
+        pool += value;
+    }
+
+    std::ofstream file(file_name, std::ios::binary);
+    if (!file.is_open())
+        throw gui::exception("gui::translation_table", "could not open " + file_name);
+
+    file.write(file_magic, sizeof(file_magic));
+    write_raw(file, file_version);
+    write_raw(file, file_byte_order);
+    write_raw(file, static_cast<std::uint32_t>(bucket_count));
+    write_raw(file, static_cast<std::uint32_t>(slot_count));
+    write_raw(file, static_cast<std::uint32_t>(pool.size()));
+    file.write(
+        reinterpret_cast<const char*>(displacements.data()),
+        displacements.size() * sizeof(std::uint32_t));
+    file.write(reinterpret_cast<const char*>(slots.data()), slots.size() * sizeof(slot_data));
+    file.write(pool.data(), pool.size());
+
+    if (!file)
+        throw gui::exception("gui::translation_table", "could not write " + file_name);
+}
+
+} // namespace lxgui::gui
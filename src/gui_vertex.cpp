@@ -0,0 +1,144 @@
+#include "lxgui/gui_vertex.hpp"
+
+#include "lxgui/gui_matrix4.hpp"
+
+#include <algorithm>
+#include <cstddef>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    define LXGUI_VERTEX_SSE2
+#    include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#    define LXGUI_VERTEX_NEON
+#    include <arm_neon.h>
+#endif
+
+namespace lxgui::gui {
+
+// The kernels below load positions and colors directly from memory
+static_assert(sizeof(vector2f) == 2 * sizeof(float), "unexpected vector2f layout");
+static_assert(sizeof(color) == 4 * sizeof(float), "unexpected color layout");
+static_assert(offsetof(vertex, pos) == 0, "unexpected vertex layout");
+static_assert(offsetof(vertex, col) == 4 * sizeof(float), "unexpected vertex layout");
+static_assert(sizeof(packed_vertex) == 16u, "unexpected packed_vertex layout");
+
+namespace {
+
+bool is_affine(const matrix4f& m) noexcept {
+    return m(0, 3) == 0.0f && m(1, 3) == 0.0f && m(3, 3) == 1.0f;
+}
+
+void transform_vertices_affine(vertex* vertex_list, std::size_t count, const matrix4f& m) noexcept {
+    std::size_t i = 0;
+
+#if defined(LXGUI_VERTEX_SSE2)
+    // Two vertices per iteration: (x0, y0, x1, y1)
+    const __m128 cx = _mm_setr_ps(m(0, 0), m(0, 1), m(0, 0), m(0, 1));
+    const __m128 cy = _mm_setr_ps(m(1, 0), m(1, 1), m(1, 0), m(1, 1));
+    const __m128 ct = _mm_setr_ps(m(3, 0), m(3, 1), m(3, 0), m(3, 1));
+
+    for (; i + 2u <= count; i += 2u) {
+        float* p0 = &vertex_list[i].pos.x;
+        float* p1 = &vertex_list[i + 1u].pos.x;
+
+        __m128 p = _mm_setzero_ps();
+        p        = _mm_loadl_pi(p, reinterpret_cast<const __m64*>(p0));
+        p        = _mm_loadh_pi(p, reinterpret_cast<const __m64*>(p1));
+
+        const __m128 x = _mm_shuffle_ps(p, p, _MM_SHUFFLE(2, 2, 0, 0));
+        const __m128 y = _mm_shuffle_ps(p, p, _MM_SHUFFLE(3, 3, 1, 1));
+        const __m128 r = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, cx), _mm_mul_ps(y, cy)), ct);
+
+        _mm_storel_pi(reinterpret_cast<__m64*>(p0), r);
+        _mm_storeh_pi(reinterpret_cast<__m64*>(p1), r);
+    }
+#elif defined(LXGUI_VERTEX_NEON)
+    const float32x2_t cx = {m(0, 0), m(0, 1)};
+    const float32x2_t cy = {m(1, 0), m(1, 1)};
+    const float32x2_t ct = {m(3, 0), m(3, 1)};
+
+    for (; i < count; ++i) {
+        float*            p0 = &vertex_list[i].pos.x;
+        const float32x2_t p  = vld1_f32(p0);
+        float32x2_t       r  = vmla_n_f32(ct, cx, vget_lane_f32(p, 0));
+        r                    = vmla_n_f32(r, cy, vget_lane_f32(p, 1));
+        vst1_f32(p0, r);
+    }
+#endif
+
+    for (; i < count; ++i) {
+        vector2f& p = vertex_list[i].pos;
+        p           = vector2f(
+            m(0, 0) * p.x + m(1, 0) * p.y + m(3, 0), m(0, 1) * p.x + m(1, 1) * p.y + m(3, 1));
+    }
+}
+
+color32::chanel pack_color_channel(float c) noexcept {
+    return static_cast<color32::chanel>(std::clamp(c, 0.0f, 1.0f) * 255.0f + 0.5f);
+}
+
+} // namespace
+
+void transform_vertices(
+    vertex* vertex_list, std::size_t count, const matrix4f& transform) noexcept {
+    if (!is_affine(transform)) {
+        // Projective transform; rare, keep it simple
+        for (std::size_t i = 0; i < count; ++i)
+            vertex_list[i].pos = vertex_list[i].pos * transform;
+
+        return;
+    }
+
+    transform_vertices_affine(vertex_list, count, transform);
+}
+
+void tint_vertices(vertex* vertex_list, std::size_t count, const color& tint) noexcept {
+    std::size_t i = 0;
+
+#if defined(LXGUI_VERTEX_SSE2)
+    const __m128 t = _mm_setr_ps(tint.r, tint.g, tint.b, tint.a);
+    for (; i < count; ++i) {
+        float* c = &vertex_list[i].col.r;
+        _mm_storeu_ps(c, _mm_mul_ps(_mm_loadu_ps(c), t));
+    }
+#elif defined(LXGUI_VERTEX_NEON)
+    const float32x4_t t = {tint.r, tint.g, tint.b, tint.a};
+    for (; i < count; ++i) {
+        float* c = &vertex_list[i].col.r;
+        vst1q_f32(c, vmulq_f32(vld1q_f32(c), t));
+    }
+#endif
+
+    for (; i < count; ++i)
+        vertex_list[i].col *= tint;
+}
+
+void multiply_vertices_alpha(vertex* vertex_list, std::size_t count, float alpha) noexcept {
+    if (alpha == 1.0f)
+        return;
+
+    tint_vertices(vertex_list, count, color(1.0f, 1.0f, 1.0f, alpha));
+}
+
+bool pack_vertices(
+    const vertex* vertex_list, std::size_t count, packed_vertex* packed_list) noexcept {
+    for (std::size_t i = 0; i < count; ++i) {
+        const vertex&  v = vertex_list[i];
+        packed_vertex& p = packed_list[i];
+
+        if (!(v.uvs.x >= 0.0f && v.uvs.x <= 1.0f && v.uvs.y >= 0.0f && v.uvs.y <= 1.0f))
+            return false;
+
+        p.pos    = v.pos;
+        p.uvs[0] = static_cast<std::uint16_t>(v.uvs.x * 65535.0f + 0.5f);
+        p.uvs[1] = static_cast<std::uint16_t>(v.uvs.y * 65535.0f + 0.5f);
+        p.col.r  = pack_color_channel(v.col.r);
+        p.col.g  = pack_color_channel(v.col.g);
+        p.col.b  = pack_color_channel(v.col.b);
+        p.col.a  = pack_color_channel(v.col.a);
+    }
+
+    return true;
+}
+
+} // namespace lxgui::gui
@@ -1,11 +1,25 @@
 #include "lxgui/gui_virtual_registry.hpp"
 
+#include "lxgui/gui_frame.hpp"
 #include "lxgui/gui_out.hpp"
 #include "lxgui/gui_region.hpp"
 #include "lxgui/utils_string.hpp"
 
 namespace lxgui::gui {
 
+namespace {
+
+bool has_destroyed_base(const std::vector<utils::observer_ptr<const region>>& base_list) {
+    for (const auto& base : base_list) {
+        if (!base)
+            return true;
+    }
+
+    return false;
+}
+
+} // namespace
+
 virtual_registry::virtual_registry(const registry& object_registry) :
     object_registry_(&object_registry) {}
 
@@ -36,4 +50,45 @@ virtual_registry::get_virtual_region_list(std::string_view names) const {
     return inheritance;
 }
 
+utils::observer_ptr<const frame>
+virtual_registry::get_flattened_template(const std::string& key) const {
+    auto iter = flattened_list_.find(key);
+    if (iter == flattened_list_.end() || !iter->second.flattened ||
+        has_destroyed_base(iter->second.base_list)) {
+        return nullptr;
+    }
+
+    return iter->second.flattened;
+}
+
+void virtual_registry::set_flattened_template(
+    std::string                                    key,
+    utils::observer_ptr<frame>                     flattened,
+    std::vector<utils::observer_ptr<const region>> base_list) {
+    flattened_list_[std::move(key)] =
+        flattened_template{std::move(flattened), std::move(base_list)};
+}
+
+std::vector<utils::observer_ptr<frame>> virtual_registry::remove_outdated_flattened_templates() {
+    std::vector<utils::observer_ptr<frame>> outdated_list;
+
+    for (auto iter = flattened_list_.begin(); iter != flattened_list_.end();) {
+        if (iter->second.flattened && !has_destroyed_base(iter->second.base_list)) {
+            ++iter;
+            continue;
+        }
+
+        if (iter->second.flattened)
+            outdated_list.push_back(std::move(iter->second.flattened));
+
+        iter = flattened_list_.erase(iter);
+    }
+
+    return outdated_list;
+}
+
+void virtual_registry::clear_flattened_templates() {
+    flattened_list_.clear();
+}
+
 } // namespace lxgui::gui
@@ -11,6 +11,9 @@ virtual_root::virtual_root(manager& mgr, registry& non_virtual_registry) :
     object_registry_(non_virtual_registry) {}
 
 virtual_root::~virtual_root() {
+    // The flattened templates are destroyed with the other frames
+    object_registry_.clear_flattened_templates();
+
     // Must be done before we destroy the registry
     clear_frames_();
 }
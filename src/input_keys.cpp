@@ -4,6 +4,27 @@
 
 namespace lxgui::input {
 
+namespace {
+
+constexpr std::uint16_t chord_key_mask   = 0x00FFu;
+constexpr std::uint16_t chord_shift_flag = 0x0100u;
+constexpr std::uint16_t chord_ctrl_flag  = 0x0200u;
+constexpr std::uint16_t chord_alt_flag   = 0x0400u;
+
+bool is_modifier_key(key key_id) {
+    switch (key_id) {
+    case key::k_lcontrol:
+    case key::k_rcontrol:
+    case key::k_lshift:
+    case key::k_rshift:
+    case key::k_lmenu:
+    case key::k_rmenu: return true;
+    default: return false;
+    }
+}
+
+} // namespace
+
 std::string_view get_mouse_button_codename(mouse_button button_id) {
     switch (button_id) {
     case mouse_button::left: return "LeftButton";
@@ -383,4 +404,66 @@ std::string_view get_localizable_key_name(key key_id) {
     }
 }
 
+key_chord
+make_key_chord(key key_id, bool shift_is_pressed, bool ctrl_is_pressed, bool alt_is_pressed) {
+    std::uint16_t code = static_cast<std::uint16_t>(key_id);
+    if (!is_modifier_key(key_id)) {
+        if (shift_is_pressed)
+            code |= chord_shift_flag;
+        if (ctrl_is_pressed)
+            code |= chord_ctrl_flag;
+        if (alt_is_pressed)
+            code |= chord_alt_flag;
+    }
+
+    return static_cast<key_chord>(code);
+}
+
+key get_key_chord_key(key_chord chord) {
+    return static_cast<key>(static_cast<std::uint16_t>(chord) & chord_key_mask);
+}
+
+std::string get_key_chord_codename(key_chord chord) {
+    const std::uint16_t code = static_cast<std::uint16_t>(chord);
+
+    std::string name;
+    if ((code & chord_ctrl_flag) != 0u)
+        name = "Ctrl-";
+    if ((code & chord_alt_flag) != 0u)
+        name.append("Alt-");
+    if ((code & chord_shift_flag) != 0u)
+        name.append("Shift-");
+
+    name.append(get_key_codename(get_key_chord_key(chord)));
+
+    return name;
+}
+
+std::optional<key_chord> get_key_chord_from_codename(std::string_view chord_name) {
+    bool shift_is_pressed = false;
+    bool ctrl_is_pressed  = false;
+    bool alt_is_pressed   = false;
+
+    // NB: Do not split on '-', since this is also the name of a key
+    auto consume_modifier = [&](std::string_view modifier, bool& is_pressed) {
+        if (chord_name.size() <= modifier.size() ||
+            chord_name.substr(0, modifier.size()) != modifier)
+            return false;
+
+        chord_name.remove_prefix(modifier.size());
+        is_pressed = true;
+        return true;
+    };
+
+    while (consume_modifier("Shift-", shift_is_pressed) ||
+           consume_modifier("Ctrl-", ctrl_is_pressed) || consume_modifier("Alt-", alt_is_pressed)) {
+    }
+
+    const key key_id = get_key_from_codename(chord_name);
+    if (key_id == key::k_unassigned)
+        return std::nullopt;
+
+    return make_key_chord(key_id, shift_is_pressed, ctrl_is_pressed, alt_is_pressed);
+}
+
 } // namespace lxgui::input
@@ -1,60 +1,558 @@
 #include "lxgui/utils_file_system.hpp"
 
+#include "lxgui/utils_exception.hpp"
 #include "lxgui/utils_std.hpp"
 #include "lxgui/utils_string.hpp"
 
+#include <algorithm>
+#include <cstdint>
 #include <filesystem>
+#include <fstream>
+#include <iterator>
+
+#if defined(LXGUI_ENABLE_MULTITHREADING)
+#    include <mutex>
+#    include <shared_mutex>
+#endif
+
+#if defined(LXGUI_PLATFORM_WINDOWS)
+#    if !defined(WIN32_LEAN_AND_MEAN)
+#        define WIN32_LEAN_AND_MEAN
+#    endif
+#    if !defined(NOMINMAX)
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+#elif !defined(LXGUI_COMPILER_EMSCRIPTEN)
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
 
 namespace lxgui::utils {
 
-bool file_exists(const std::string& file) {
-    return std::filesystem::exists(file) && std::filesystem::is_regular_file(file);
+namespace {
+
+// Archive layout (all integers are little-endian):
+//  - magic "LXPK", version (u32), number of files (u32)
+//  - for each file: path length (u32), path (UTF-8), offset (u64), size (u64)
+//  - content of each file, at the offset given in the index
+constexpr std::string_view archive_magic     = "LXPK";
+constexpr std::uint32_t    archive_version   = 1u;
+constexpr std::uint64_t    archive_alignment = 16u;
+
+/// A file mapped in memory, read-only.
+class mapped_file {
+public:
+    explicit mapped_file(const std::string& file_name) {
+#if defined(LXGUI_PLATFORM_WINDOWS)
+        HANDLE file = CreateFileW(
+            std::filesystem::u8path(file_name).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            throw utils::exception("utils::mapped_file", "cannot open \"" + file_name + "\".");
+
+        LARGE_INTEGER file_size;
+        if (GetFileSizeEx(file, &file_size)) {
+            size_ = static_cast<std::size_t>(file_size.QuadPart);
+            if (size_ != 0u) {
+                // The view keeps the mapping and the file open
+                HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+                if (mapping) {
+                    data_ = static_cast<const char*>(
+                        MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+                    CloseHandle(mapping);
+                }
+            }
+        }
+
+        CloseHandle(file);
+#elif defined(LXGUI_COMPILER_EMSCRIPTEN)
+        // No memory mapping in the browser; read the whole file once instead
+        std::ifstream file(file_name, std::ios::binary);
+        if (!file.is_open())
+            throw utils::exception("utils::mapped_file", "cannot open \"" + file_name + "\".");
+
+        buffer_.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        data_ = buffer_.data();
+        size_ = buffer_.size();
+#else
+        const int file = open(file_name.c_str(), O_RDONLY);
+        if (file < 0)
+            throw utils::exception("utils::mapped_file", "cannot open \"" + file_name + "\".");
+
+        struct stat info;
+        if (fstat(file, &info) == 0) {
+            size_ = static_cast<std::size_t>(info.st_size);
+            if (size_ != 0u) {
+                // The mapping keeps the file open
+                void* data = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, file, 0);
+                if (data != MAP_FAILED)
+                    data_ = static_cast<const char*>(data);
+            }
+        }
+
+        close(file);
+#endif
+
+        if (size_ != 0u && data_ == nullptr)
+            throw utils::exception("utils::mapped_file", "cannot map \"" + file_name + "\".");
+    }
+
+    ~mapped_file() {
+#if defined(LXGUI_PLATFORM_WINDOWS)
+        if (data_ != nullptr)
+            UnmapViewOfFile(data_);
+#elif !defined(LXGUI_COMPILER_EMSCRIPTEN)
+        if (data_ != nullptr)
+            munmap(const_cast<char*>(data_), size_);
+#endif
+    }
+
+    // Non-copiable, non-movable
+    mapped_file(const mapped_file&)            = delete;
+    mapped_file(mapped_file&&)                 = delete;
+    mapped_file& operator=(const mapped_file&) = delete;
+    mapped_file& operator=(mapped_file&&)      = delete;
+
+    std::string_view get_view() const noexcept {
+        return std::string_view(data_, size_);
+    }
+
+private:
+    const char* data_ = nullptr;
+    std::size_t size_ = 0u;
+#if defined(LXGUI_COMPILER_EMSCRIPTEN)
+    std::string buffer_;
+#endif
+};
+
+struct archive_entry {
+    std::string path;
+    std::size_t offset = 0u;
+    std::size_t size   = 0u;
+};
+
+struct archive {
+    std::string                        mount_point;
+    std::shared_ptr<const mapped_file> file;
+    std::vector<archive_entry>         entry_list; // sorted by path
+};
+
+std::vector<archive>& get_archive_list() {
+    static std::vector<archive> archive_list;
+    return archive_list;
 }
 
-string_vector get_directory_list(const std::string& rel_path) {
-    string_vector dir_list;
-    for (const auto& entry : std::filesystem::directory_iterator(rel_path)) {
-        if (entry.is_directory())
-            dir_list.push_back(entry.path().filename().u8string());
+#if defined(LXGUI_ENABLE_MULTITHREADING)
+// Files are read from worker threads (e.g., when parsing layout files in parallel), while
+// archives can be mounted from any thread: reads share this lock, and mounts take it alone
+std::shared_mutex& get_archive_mutex() {
+    static std::shared_mutex mutex;
+    return mutex;
+}
+#endif
+
+bool has_prefix(std::string_view str, std::string_view prefix) noexcept {
+    return str.size() >= prefix.size() && str.substr(0, prefix.size()) == prefix;
+}
+
+std::optional<std::string_view>
+get_path_in_archive(const archive& a, std::string_view path) noexcept {
+    if (a.mount_point.empty())
+        return path;
+
+    if (!has_prefix(path, a.mount_point))
+        return std::nullopt;
+
+    if (path.size() == a.mount_point.size())
+        return std::string_view{};
+
+    if (path[a.mount_point.size()] != '/')
+        return std::nullopt;
+
+    return path.substr(a.mount_point.size() + 1u);
+}
+
+std::optional<file_content> read_file_from_archives(const std::string& file) {
+#if defined(LXGUI_ENABLE_MULTITHREADING)
+    std::shared_lock<std::shared_mutex> lock(get_archive_mutex());
+#endif
+
+    const auto& archive_list = get_archive_list();
+    if (archive_list.empty())
+        return std::nullopt;
+
+    const std::string path = normalize_path(file);
+    for (auto iter = archive_list.rbegin(); iter != archive_list.rend(); ++iter) {
+        const auto local_path = get_path_in_archive(*iter, path);
+        if (!local_path.has_value())
+            continue;
+
+        auto entry = std::lower_bound(
+            iter->entry_list.begin(), iter->entry_list.end(), local_path.value(),
+            [](const archive_entry& e, std::string_view p) { return e.path < p; });
+
+        if (entry != iter->entry_list.end() && entry->path == local_path.value()) {
+            return file_content(
+                iter->file, iter->file->get_view().substr(entry->offset, entry->size));
+        }
     }
 
-    return dir_list;
+    return std::nullopt;
 }
 
-string_vector get_file_list(const std::string& rel_path, bool with_path) {
+bool list_archive_directory(
+    const std::string& rel_path, string_vector& dir_list, string_vector& file_list) {
+#if defined(LXGUI_ENABLE_MULTITHREADING)
+    std::shared_lock<std::shared_mutex> lock(get_archive_mutex());
+#endif
+
+    const auto& archive_list = get_archive_list();
+    if (archive_list.empty())
+        return false;
+
+    auto add_unique = [](string_vector& list, std::string_view name) {
+        if (utils::find(list, name) == list.end())
+            list.emplace_back(name);
+    };
+
+    const std::string path  = normalize_path(rel_path);
+    bool              found = false;
+    for (auto iter = archive_list.rbegin(); iter != archive_list.rend(); ++iter) {
+        const auto local_path = get_path_in_archive(*iter, path);
+        if (!local_path.has_value()) {
+            // The archive may be mounted in a sub-directory
+            std::string_view mount = iter->mount_point;
+            if (path.empty() || (has_prefix(mount, path) && mount.size() > path.size() &&
+                                 mount[path.size()] == '/')) {
+                mount = path.empty() ? mount : mount.substr(path.size() + 1u);
+                add_unique(dir_list, mount.substr(0, mount.find('/')));
+                found = true;
+            }
+
+            continue;
+        }
+
+        std::string prefix{local_path.value()};
+        if (!prefix.empty())
+            prefix += '/';
+
+        auto entry = std::lower_bound(
+            iter->entry_list.begin(), iter->entry_list.end(), prefix,
+            [](const archive_entry& e, const std::string& p) { return e.path < p; });
+
+        for (; entry != iter->entry_list.end() && has_prefix(entry->path, prefix); ++entry) {
+            const std::string_view name  = std::string_view(entry->path).substr(prefix.size());
+            const std::size_t      slash = name.find('/');
+            if (slash == name.npos)
+                add_unique(file_list, name);
+            else
+                add_unique(dir_list, name.substr(0, slash));
+
+            found = true;
+        }
+    }
+
+    return found;
+}
+
+string_vector list_files(
+    const std::string& rel_path, bool with_path, const string_vector& extension_list) {
+    auto has_extension = [&](const std::string& name) {
+        return extension_list.empty() ||
+               utils::find(extension_list, get_file_extension(name)) != extension_list.end();
+    };
+
+    string_vector dir_list;
+    string_vector archive_file_list;
+    const bool    in_archive = list_archive_directory(rel_path, dir_list, archive_file_list);
+
     string_vector file_list;
+    string_vector name_list;
+    for (const auto& name : archive_file_list) {
+        if (!has_extension(name))
+            continue;
+
+        if (with_path) {
+            const auto file_path = std::filesystem::u8path(rel_path) / name;
+            file_list.push_back(file_path.relative_path().u8string());
+        } else {
+            file_list.push_back(name);
+        }
+
+        name_list.push_back(name);
+    }
+
+    if (in_archive && !std::filesystem::is_directory(rel_path))
+        return file_list;
+
     for (const auto& entry : std::filesystem::directory_iterator(rel_path)) {
         if (entry.is_regular_file()) {
+            const std::string name = entry.path().filename().u8string();
+            if (!has_extension(name) || utils::find(name_list, name) != name_list.end())
+                continue;
+
             if (with_path)
                 file_list.push_back(entry.path().relative_path().u8string());
             else
-                file_list.push_back(entry.path().filename().u8string());
+                file_list.push_back(name);
         }
     }
 
     return file_list;
 }
 
+bool read_u32(std::string_view& data, std::uint32_t& value) noexcept {
+    if (data.size() < 4u)
+        return false;
+
+    value = 0u;
+    for (std::size_t i = 0u; i < 4u; ++i)
+        value |= static_cast<std::uint32_t>(static_cast<unsigned char>(data[i])) << (8u * i);
+
+    data.remove_prefix(4u);
+    return true;
+}
+
+bool read_u64(std::string_view& data, std::uint64_t& value) noexcept {
+    if (data.size() < 8u)
+        return false;
+
+    value = 0u;
+    for (std::size_t i = 0u; i < 8u; ++i)
+        value |= static_cast<std::uint64_t>(static_cast<unsigned char>(data[i])) << (8u * i);
+
+    data.remove_prefix(8u);
+    return true;
+}
+
+void write_u32(std::ostream& output, std::uint32_t value) {
+    for (std::size_t i = 0u; i < 4u; ++i)
+        output.put(static_cast<char>((value >> (8u * i)) & 0xFFu));
+}
+
+void write_u64(std::ostream& output, std::uint64_t value) {
+    for (std::size_t i = 0u; i < 8u; ++i)
+        output.put(static_cast<char>((value >> (8u * i)) & 0xFFu));
+}
+
+} // namespace
+
+file_content::file_content(std::string content) {
+    auto owned = std::make_shared<const std::string>(std::move(content));
+    view_      = *owned;
+    owner_     = std::move(owned);
+}
+
+file_content::file_content(std::shared_ptr<const void> owner, std::string_view content) noexcept :
+    owner_(std::move(owner)), view_(content) {}
+
+void mount_archive(const std::string& archive_file, const std::string& mount_point) {
+    auto file = std::make_shared<const mapped_file>(archive_file);
+
+    auto error = [&](const std::string& message) {
+        return utils::exception("utils::mount_archive", "\"" + archive_file + "\": " + message);
+    };
+
+    const std::string_view content = file->get_view();
+    std::string_view       data    = content;
+    if (!has_prefix(data, archive_magic))
+        throw error("not an archive.");
+
+    data.remove_prefix(archive_magic.size());
+
+    std::uint32_t version = 0u;
+    std::uint32_t count   = 0u;
+    if (!read_u32(data, version) || !read_u32(data, count))
+        throw error("truncated index.");
+    if (version != archive_version)
+        throw error("unsupported archive version (" + std::to_string(version) + ").");
+
+    archive a;
+    a.mount_point = normalize_path(mount_point);
+    a.file        = file;
+    a.entry_list.reserve(std::min<std::size_t>(count, data.size() / 20u));
+
+    for (std::uint32_t i = 0u; i < count; ++i) {
+        std::uint32_t path_size = 0u;
+        if (!read_u32(data, path_size) || data.size() < path_size)
+            throw error("truncated index.");
+
+        std::string path{data.substr(0, path_size)};
+        data.remove_prefix(path_size);
+
+        std::uint64_t offset = 0u;
+        std::uint64_t size   = 0u;
+        if (!read_u64(data, offset) || !read_u64(data, size))
+            throw error("truncated index.");
+        if (offset > content.size() || size > content.size() - offset)
+            throw error("file \"" + path + "\" is out of bounds.");
+
+        a.entry_list.push_back(
+            {std::move(path), static_cast<std::size_t>(offset), static_cast<std::size_t>(size)});
+    }
+
+    std::sort(
+        a.entry_list.begin(), a.entry_list.end(),
+        [](const archive_entry& e1, const archive_entry& e2) { return e1.path < e2.path; });
+
+#if defined(LXGUI_ENABLE_MULTITHREADING)
+    std::unique_lock<std::shared_mutex> lock(get_archive_mutex());
+#endif
+
+    get_archive_list().push_back(std::move(a));
+}
+
+void unmount_archives() {
+#if defined(LXGUI_ENABLE_MULTITHREADING)
+    std::unique_lock<std::shared_mutex> lock(get_archive_mutex());
+#endif
+
+    get_archive_list().clear();
+}
+
+std::size_t pack_archive(const std::string& directory, const std::string& archive_file) {
+    const auto root = std::filesystem::u8path(directory);
+    if (!std::filesystem::is_directory(root)) {
+        throw utils::exception(
+            "utils::pack_archive", "\"" + directory + "\" is not a directory.");
+    }
+
+    struct packed_file {
+        std::string           path;
+        std::filesystem::path source;
+        std::uint64_t         offset = 0u;
+        std::uint64_t         size   = 0u;
+    };
+
+    std::vector<packed_file> file_list;
+    for (const auto& entry : std::filesystem::recursive_directory_iterator(root)) {
+        if (entry.is_regular_file()) {
+            packed_file f;
+            f.path   = entry.path().lexically_relative(root).generic_u8string();
+            f.source = entry.path();
+            f.size   = entry.file_size();
+            file_list.push_back(std::move(f));
+        }
+    }
+
+    std::sort(
+        file_list.begin(), file_list.end(),
+        [](const packed_file& f1, const packed_file& f2) { return f1.path < f2.path; });
+
+    // The content starts after the index
+    std::uint64_t offset = archive_magic.size() + 4u + 4u;
+    for (const auto& f : file_list)
+        offset += 4u + f.path.size() + 8u + 8u;
+
+    for (auto& f : file_list) {
+        offset   = (offset + archive_alignment - 1u) / archive_alignment * archive_alignment;
+        f.offset = offset;
+        offset += f.size;
+    }
+
+    std::ofstream output(archive_file, std::ios::binary);
+    if (!output.is_open()) {
+        throw utils::exception(
+            "utils::pack_archive", "cannot open \"" + archive_file + "\" for writing.");
+    }
+
+    output.write(archive_magic.data(), static_cast<std::streamsize>(archive_magic.size()));
+    write_u32(output, archive_version);
+    write_u32(output, static_cast<std::uint32_t>(file_list.size()));
+
+    for (const auto& f : file_list) {
+        write_u32(output, static_cast<std::uint32_t>(f.path.size()));
+        output.write(f.path.data(), static_cast<std::streamsize>(f.path.size()));
+        write_u64(output, f.offset);
+        write_u64(output, f.size);
+    }
+
+    std::string buffer;
+    for (const auto& f : file_list) {
+        while (static_cast<std::uint64_t>(output.tellp()) < f.offset)
+            output.put('\0');
+
+        std::ifstream input(f.source, std::ios::binary);
+        buffer.resize(static_cast<std::size_t>(f.size));
+        if (!input.read(buffer.data(), static_cast<std::streamsize>(buffer.size()))) {
+            throw utils::exception(
+                "utils::pack_archive", "cannot read \"" + f.source.u8string() + "\".");
+        }
+
+        output.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    }
+
+    if (!output) {
+        throw utils::exception(
+            "utils::pack_archive", "cannot write to \"" + archive_file + "\".");
+    }
+
+    return file_list.size();
+}
+
+std::optional<file_content> read_file(const std::string& file) {
+    if (auto content = read_file_from_archives(file))
+        return content;
+
+    std::ifstream stream(file, std::ios::binary | std::ios::ate);
+    if (!stream.is_open())
+        return std::nullopt;
+
+    const auto size = stream.tellg();
+    if (size < 0)
+        return std::nullopt;
+
+    std::string content(static_cast<std::size_t>(size), '\0');
+    stream.seekg(0, std::ios::beg);
+    if (!stream.read(content.data(), size))
+        return std::nullopt;
+
+    return file_content(std::move(content));
+}
+
+bool file_exists(const std::string& file) {
+    if (read_file_from_archives(file).has_value())
+        return true;
+
+    return std::filesystem::exists(file) && std::filesystem::is_regular_file(file);
+}
+
+string_vector get_directory_list(const std::string& rel_path) {
+    string_vector dir_list;
+    string_vector file_list;
+    const bool    in_archive = list_archive_directory(rel_path, dir_list, file_list);
+    if (in_archive && !std::filesystem::is_directory(rel_path))
+        return dir_list;
+
+    for (const auto& entry : std::filesystem::directory_iterator(rel_path)) {
+        if (entry.is_directory()) {
+            std::string name = entry.path().filename().u8string();
+            if (utils::find(dir_list, name) == dir_list.end())
+                dir_list.push_back(std::move(name));
+        }
+    }
+
+    return dir_list;
+}
+
+string_vector get_file_list(const std::string& rel_path, bool with_path) {
+    return list_files(rel_path, with_path, {});
+}
+
 string_vector
 get_file_list(const std::string& rel_path, bool with_path, const std::string& extensions) {
     auto extension_list = utils::cut(extensions, ",");
     for (auto& extension : extension_list)
         extension = utils::trim(extension, ' ');
 
-    string_vector file_list;
-    for (const auto& entry : std::filesystem::directory_iterator(rel_path)) {
-        if (entry.is_regular_file()) {
-            if (utils::find(extension_list, entry.path().extension().u8string()) !=
-                extension_list.end()) {
-                if (with_path)
-                    file_list.push_back(entry.path().relative_path().u8string());
-                else
-                    file_list.push_back(entry.path().filename().u8string());
-            }
-        }
-    }
+    string_vector extension_string_list;
+    for (const auto& extension : extension_list)
+        extension_string_list.emplace_back(extension);
 
-    return file_list;
+    return list_files(rel_path, with_path, extension_string_list);
 }
 
 bool make_directory(const std::string& path) {
@@ -62,6 +560,17 @@ bool make_directory(const std::string& path) {
     return std::filesystem::exists(path) && std::filesystem::is_directory(path);
 }
 
+std::string normalize_path(const std::string& path) {
+    std::string normalized = std::filesystem::u8path(path).lexically_normal().generic_u8string();
+    if (normalized == ".")
+        normalized.clear();
+
+    while (!normalized.empty() && normalized.back() == '/')
+        normalized.pop_back();
+
+    return normalized;
+}
+
 std::string get_file_extension(const std::string& file) {
     return std::filesystem::path(file).extension().u8string();
 }
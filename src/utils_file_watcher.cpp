@@ -0,0 +1,135 @@
+#include "lxgui/utils_file_watcher.hpp"
+
+#include "lxgui/utils_exception.hpp"
+#include "lxgui/utils_file_system.hpp"
+#include "lxgui/utils_std.hpp"
+
+#include <filesystem>
+
+#if defined(LXGUI_PLATFORM_LINUX)
+#    include <sys/inotify.h>
+#    include <unistd.h>
+#endif
+
+namespace lxgui::utils {
+
+#if defined(LXGUI_PLATFORM_LINUX)
+
+file_watcher::file_watcher() {
+    inotify_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (inotify_ < 0)
+        throw utils::exception("utils::file_watcher", "cannot initialize inotify.");
+}
+
+file_watcher::~file_watcher() {
+    close(inotify_);
+}
+
+void file_watcher::watch_directory(const std::string& directory) {
+    std::error_code error;
+    if (!std::filesystem::is_directory(directory, error))
+        return;
+
+    add_watch_(normalize_path(directory));
+    for (const auto& entry : std::filesystem::recursive_directory_iterator(directory, error)) {
+        if (entry.is_directory(error))
+            add_watch_(entry.path().generic_u8string());
+    }
+}
+
+void file_watcher::add_watch_(const std::string& directory) {
+    // Files are reported once fully written (editors which write to a temporary file, then
+    // rename it, trigger IN_MOVED_TO instead). New directories are watched too.
+    const int watch = inotify_add_watch(
+        inotify_, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE | IN_ONLYDIR);
+    if (watch >= 0)
+        watch_list_[watch] = directory;
+}
+
+std::vector<std::string> file_watcher::get_modified_files() {
+    std::vector<std::string> modified_list;
+
+    alignas(inotify_event) char buffer[4096];
+    while (true) {
+        const ssize_t length = read(inotify_, buffer, sizeof(buffer));
+        if (length <= 0)
+            break;
+
+        for (const char* ptr = buffer; ptr < buffer + length;) {
+            const auto* event = reinterpret_cast<const inotify_event*>(ptr);
+            ptr += sizeof(inotify_event) + event->len;
+
+            auto iter = watch_list_.find(event->wd);
+            if (iter == watch_list_.end() || event->len == 0u)
+                continue;
+
+            std::string path = iter->second + "/" + event->name;
+            if ((event->mask & IN_ISDIR) != 0u) {
+                watch_directory(path);
+                continue;
+            }
+
+            // Wait until the file is written
+            if ((event->mask & IN_CREATE) != 0u)
+                continue;
+
+            if (utils::find(modified_list, path) == modified_list.end())
+                modified_list.push_back(std::move(path));
+        }
+    }
+
+    return modified_list;
+}
+
+#else
+
+file_watcher::file_watcher() : last_scan_(std::chrono::steady_clock::now()) {}
+
+file_watcher::~file_watcher() = default;
+
+void file_watcher::watch_directory(const std::string& directory) {
+    directory_list_.push_back(directory);
+    scan_(directory, nullptr);
+}
+
+void file_watcher::scan_(const std::string& directory, std::vector<std::string>* modified_list) {
+    std::error_code error;
+    if (!std::filesystem::is_directory(directory, error))
+        return;
+
+    for (const auto& entry : std::filesystem::recursive_directory_iterator(directory, error)) {
+        if (!entry.is_regular_file(error))
+            continue;
+
+        const auto time = entry.last_write_time(error);
+        if (error)
+            continue;
+
+        std::string path      = entry.path().generic_u8string();
+        auto [iter, inserted] = time_list_.try_emplace(path, time);
+        if (!inserted && iter->second == time)
+            continue;
+
+        iter->second = time;
+        if (modified_list && utils::find(*modified_list, path) == modified_list->end())
+            modified_list->push_back(std::move(path));
+    }
+}
+
+std::vector<std::string> file_watcher::get_modified_files() {
+    const auto now = std::chrono::steady_clock::now();
+    if (std::chrono::duration<float>(now - last_scan_).count() < polling_interval)
+        return {};
+
+    last_scan_ = now;
+
+    std::vector<std::string> modified_list;
+    for (const auto& directory : directory_list_)
+        scan_(directory, &modified_list);
+
+    return modified_list;
+}
+
+#endif
+
+} // namespace lxgui::utils
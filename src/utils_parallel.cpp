@@ -0,0 +1,174 @@
+#include "lxgui/utils_parallel.hpp"
+
+#if defined(LXGUI_ENABLE_MULTITHREADING)
+#    include <algorithm>
+#    include <atomic>
+#    include <condition_variable>
+#    include <exception>
+#    include <mutex>
+#    include <thread>
+#    include <vector>
+#endif
+
+namespace lxgui::utils {
+
+#if defined(LXGUI_ENABLE_MULTITHREADING)
+namespace {
+
+// Set for the threads taking part in a parallel_for() call, to run nested calls sequentially
+thread_local bool is_in_parallel_for = false;
+
+/// Threads started once, and waiting for parallel_for() calls to process indices.
+class worker_pool {
+public:
+    explicit worker_pool(std::size_t thread_count) {
+        thread_list_.reserve(thread_count);
+        for (std::size_t i = 0u; i < thread_count; ++i)
+            thread_list_.emplace_back([this]() { work_(); });
+    }
+
+    ~worker_pool() {
+        {
+            std::scoped_lock lock(mutex_);
+            is_stopping_ = true;
+        }
+
+        job_condition_.notify_all();
+
+        for (auto& thread : thread_list_)
+            thread.join();
+    }
+
+    // Non-copiable, non-movable
+    worker_pool(const worker_pool&)            = delete;
+    worker_pool(worker_pool&&)                 = delete;
+    worker_pool& operator=(const worker_pool&) = delete;
+    worker_pool& operator=(worker_pool&&)      = delete;
+
+    std::size_t get_thread_count() const noexcept {
+        return thread_list_.size();
+    }
+
+    bool try_run(std::size_t count, const std::function<void(std::size_t)>& function) {
+        // The pool processes one call at a time; concurrent calls run on their own thread
+        std::unique_lock<std::mutex> job_lock(job_mutex_, std::try_to_lock);
+        if (!job_lock.owns_lock())
+            return false;
+
+        {
+            std::scoped_lock lock(mutex_);
+            function_     = &function;
+            count_        = count;
+            next_index_   = 0u;
+            busy_workers_ = thread_list_.size();
+            ++job_id_;
+        }
+
+        job_condition_.notify_all();
+
+        process_();
+
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            done_condition_.wait(lock, [&]() { return busy_workers_ == 0u; });
+            function_ = nullptr;
+        }
+
+        if (first_exception_) {
+            std::exception_ptr exception = std::move(first_exception_);
+            first_exception_             = nullptr;
+            std::rethrow_exception(exception);
+        }
+
+        return true;
+    }
+
+private:
+    void work_() {
+        std::size_t last_job_id = 0u;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                job_condition_.wait(lock, [&]() { return is_stopping_ || job_id_ != last_job_id; });
+                if (is_stopping_)
+                    return;
+
+                last_job_id = job_id_;
+            }
+
+            process_();
+
+            {
+                std::scoped_lock lock(mutex_);
+                --busy_workers_;
+            }
+
+            done_condition_.notify_one();
+        }
+    }
+
+    void process_() {
+        is_in_parallel_for = true;
+
+        std::size_t index = 0u;
+        while ((index = next_index_.fetch_add(1u)) < count_) {
+            try {
+                (*function_)(index);
+            } catch (...) {
+                std::scoped_lock lock(exception_mutex_);
+                if (!first_exception_)
+                    first_exception_ = std::current_exception();
+            }
+        }
+
+        is_in_parallel_for = false;
+    }
+
+    std::vector<std::thread> thread_list_;
+
+    std::mutex              job_mutex_;
+    std::mutex              mutex_;
+    std::condition_variable job_condition_;
+    std::condition_variable done_condition_;
+    bool                    is_stopping_  = false;
+    std::size_t             job_id_       = 0u;
+    std::size_t             busy_workers_ = 0u;
+
+    const std::function<void(std::size_t)>* function_   = nullptr;
+    std::size_t                             count_      = 0u;
+    std::atomic<std::size_t>                next_index_ = 0u;
+
+    std::mutex         exception_mutex_;
+    std::exception_ptr first_exception_;
+};
+
+worker_pool& get_worker_pool() {
+    // The calling thread takes part in the work, so one thread fewer is needed
+    static worker_pool pool(get_worker_thread_count() - 1u);
+    return pool;
+}
+
+} // namespace
+#endif
+
+std::size_t get_worker_thread_count() noexcept {
+#if defined(LXGUI_ENABLE_MULTITHREADING)
+    return std::max<std::size_t>(1u, std::thread::hardware_concurrency());
+#else
+    return 1u;
+#endif
+}
+
+void parallel_for(std::size_t count, const std::function<void(std::size_t)>& function) {
+#if defined(LXGUI_ENABLE_MULTITHREADING)
+    if (count > 1u && !is_in_parallel_for && get_worker_thread_count() > 1u) {
+        if (get_worker_pool().try_run(count, function))
+            return;
+    }
+#endif
+
+    for (std::size_t index = 0u; index < count; ++index)
+        function(index);
+}
+
+} // namespace lxgui::utils
@@ -0,0 +1,126 @@
+#include "lxgui/utils_pool_allocator.hpp"
+
+#include <algorithm>
+#include <array>
+#include <new>
+
+#if defined(LXGUI_ENABLE_MULTITHREADING)
+#    include <mutex>
+#endif
+
+namespace lxgui::utils {
+
+namespace {
+
+constexpr std::size_t block_granularity = 16u;
+constexpr std::size_t size_class_count  = max_pooled_size / block_granularity;
+constexpr std::size_t chunk_size        = 4096u;
+
+struct free_block {
+    free_block* next = nullptr;
+};
+
+// Each size class has its own free list and lock, so that allocations of different sizes
+// (e.g., list nodes and signal slots) do not contend with each other
+struct size_class_pool {
+    free_block*       free_list = nullptr;
+    memory_pool_stats stats;
+
+#if defined(LXGUI_ENABLE_MULTITHREADING)
+    std::mutex mutex;
+#endif
+};
+
+using pool_list = std::array<size_class_pool, size_class_count>;
+
+pool_list& get_pool_list() {
+    // Never destroyed, since blocks may be given back by static objects destroyed later
+    static pool_list* list = new pool_list();
+    return *list;
+}
+
+std::size_t get_size_class(std::size_t size) {
+    return size == 0u ? 0u : (size - 1u) / block_granularity;
+}
+
+void fill_free_list(size_class_pool& pool, std::size_t size_class) {
+    const std::size_t block_size = (size_class + 1u) * block_granularity;
+    const std::size_t count      = std::max<std::size_t>(chunk_size / block_size, 8u);
+
+    auto* chunk = static_cast<std::byte*>(::operator new(count * block_size));
+    ++pool.stats.system_allocations;
+    pool.stats.reserved_bytes += count * block_size;
+
+    for (std::size_t i = count; i > 0u; --i) {
+        auto* block    = reinterpret_cast<free_block*>(chunk + (i - 1u) * block_size);
+        block->next    = pool.free_list;
+        pool.free_list = block;
+    }
+}
+
+} // namespace
+
+namespace memory_pool_impl {
+
+void* allocate(std::size_t size) {
+    const std::size_t size_class = get_size_class(size);
+
+    auto& pool = get_pool_list()[size_class];
+#if defined(LXGUI_ENABLE_MULTITHREADING)
+    std::lock_guard<std::mutex> lock(pool.mutex);
+#endif
+
+    if (!pool.free_list)
+        fill_free_list(pool, size_class);
+
+    free_block* block = pool.free_list;
+    pool.free_list    = block->next;
+    ++pool.stats.allocations;
+
+    return block;
+}
+
+void deallocate(void* ptr, std::size_t size) noexcept {
+    if (!ptr)
+        return;
+
+    auto& pool = get_pool_list()[get_size_class(size)];
+#if defined(LXGUI_ENABLE_MULTITHREADING)
+    std::lock_guard<std::mutex> lock(pool.mutex);
+#endif
+
+    pool.free_list = new (ptr) free_block{pool.free_list};
+    ++pool.stats.deallocations;
+}
+
+} // namespace memory_pool_impl
+
+memory_pool_stats get_memory_pool_stats() {
+    memory_pool_stats total;
+    for (auto& pool : get_pool_list()) {
+#if defined(LXGUI_ENABLE_MULTITHREADING)
+        std::lock_guard<std::mutex> lock(pool.mutex);
+#endif
+
+        total.allocations += pool.stats.allocations;
+        total.deallocations += pool.stats.deallocations;
+        total.system_allocations += pool.stats.system_allocations;
+        total.reserved_bytes += pool.stats.reserved_bytes;
+    }
+
+    return total;
+}
+
+void reset_memory_pool_stats() {
+    for (auto& pool : get_pool_list()) {
+#if defined(LXGUI_ENABLE_MULTITHREADING)
+        std::lock_guard<std::mutex> lock(pool.mutex);
+#endif
+
+        pool.stats.allocations        = pool.stats.get_live_count();
+        pool.stats.deallocations      = 0u;
+        pool.stats.system_allocations = 0u;
+    }
+}
+
+} // namespace lxgui::utils
@@ -6,12 +6,16 @@
 #include "lxgui/gui_font_string.hpp"
 #include "lxgui/gui_localizer.hpp"
 #include "lxgui/gui_manager.hpp"
+#include "lxgui/gui_matrix4.hpp"
 #include "lxgui/gui_out.hpp"
+#include "lxgui/gui_renderer.hpp"
 #include "lxgui/gui_root.hpp"
 #include "lxgui/gui_scroll_frame.hpp"
 #include "lxgui/gui_slider.hpp"
 #include "lxgui/gui_status_bar.hpp"
 #include "lxgui/gui_texture.hpp"
+#include "lxgui/gui_vertex.hpp"
+#include "lxgui/gui_vertex_cache.hpp"
 #include "lxgui/input_dispatcher.hpp"
 #include "lxgui/input_world_dispatcher.hpp"
 #include "lxgui/utils_file_system.hpp"
@@ -74,7 +78,9 @@
 #include <chrono>
 #include <cstdint>
 #include <fstream>
+#include <functional>
 #include <thread>
+#include <vector>
 
 using namespace lxgui;
 using timing_clock = std::chrono::high_resolution_clock;
@@ -220,6 +226,170 @@ void main_loop(void* type_erased_data) {
 #endif
 }
 
+double elapsed_microseconds(timing_clock::time_point start) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(timing_clock::now() - start)
+               .count() /
+           1e3;
+}
+
+void run_frame_benchmark(gui::manager& manager, std::size_t frame_count) {
+    // Create a grid of small textured frames, with mouse input enabled
+    const std::size_t   columns = 100u;
+    const gui::vector2f size(8.0f, 8.0f);
+
+    std::vector<utils::observer_ptr<gui::frame>> frame_list;
+    frame_list.reserve(frame_count);
+
+    for (std::size_t i = 0; i < frame_count; ++i) {
+        auto obj = manager.get_root().create_root_frame<gui::frame>(
+            "BenchmarkFrame" + utils::to_string(i));
+        obj->set_anchor(
+            gui::point::top_left,
+            gui::vector2f((i % columns) * size.x, (i / columns % columns) * size.y));
+        obj->set_dimensions(size);
+        obj->set_level(static_cast<int>(i / (columns * columns)));
+        obj->enable_mouse();
+
+        auto tex = obj->create_layered_region<gui::texture>(gui::layer::artwork, "$parentTexture");
+        tex->set_all_anchors(obj);
+        tex->set_solid_color(gui::color((i % 7) / 7.0f, (i % 5) / 5.0f, (i % 3) / 3.0f));
+        tex->notify_loaded();
+
+        obj->notify_loaded();
+        frame_list.push_back(std::move(obj));
+    }
+
+    const std::size_t iterations = 100u;
+    manager.update_ui(0.0f);
+
+    // Update and render
+    auto start = timing_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i)
+        manager.update_ui(0.016f);
+    const double update_time = elapsed_microseconds(start) / iterations;
+
+    start = timing_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i)
+        manager.render_ui();
+    const double render_time = elapsed_microseconds(start) / iterations;
+
+    // Hit tests: scanning the packed frame data, or calling the predicate for every frame
+    const gui::vector2f position(size.x * columns / 2.0f + 1.0f, size.y * 50.0f + 1.0f);
+    const std::function<bool(const gui::frame&)> predicate = [&](const gui::frame& obj) {
+        return obj.is_in_region(position) && obj.is_mouse_click_enabled();
+    };
+
+    gui::root&  root    = manager.get_root();
+    std::size_t matches = 0u;
+
+    start = timing_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        if (root.find_topmost_frame(position, gui::frame_renderer::flag_mouse_click, predicate))
+            ++matches;
+    }
+    const double packed_hit_time = elapsed_microseconds(start) / iterations;
+
+    start = timing_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        if (root.find_topmost_frame(predicate))
+            ++matches;
+    }
+    const double predicate_hit_time = elapsed_microseconds(start) / iterations;
+
+    std::cout << "Benchmark with " << frame_count << " frames (" << matches << " hits):"
+              << std::endl;
+    std::cout << "  update_ui (us): " << update_time << std::endl;
+    std::cout << "  render_ui (us): " << render_time << std::endl;
+    std::cout << "  hit test, packed data (us): " << packed_hit_time << std::endl;
+    std::cout << "  hit test, predicate only (us): " << predicate_hit_time << std::endl;
+
+    for (auto& obj : frame_list)
+        obj->destroy();
+}
+
+void run_vertex_benchmark(gui::renderer& renderer, std::size_t vertex_count) {
+    // Whole quads, with texture coordinates in [0,1] so they can use the packed layout
+    vertex_count -= vertex_count % 4u;
+
+    std::vector<gui::vertex> vertex_list(vertex_count);
+    for (std::size_t i = 0; i < vertex_count; ++i) {
+        auto& v = vertex_list[i];
+        v.pos   = gui::vector2f(static_cast<float>(i % 1000u), static_cast<float>(i / 1000u));
+        v.uvs   = gui::vector2f(static_cast<float>(i % 2u), static_cast<float>(i / 2u % 2u));
+        v.col   = gui::color(1.0f, 0.5f, 0.25f, 1.0f);
+    }
+
+    const std::size_t iterations     = 100u;
+    const double      total_vertices = static_cast<double>(vertex_count * iterations);
+
+    auto vertices_per_second = [&](double microseconds) {
+        return total_vertices / (microseconds * 1e-6);
+    };
+
+    const gui::matrix4f transform = gui::matrix4f::transformation(
+        gui::vector2f(10.0f, 20.0f), gui::vector2f(1.0f, 1.0f), 0.1f);
+    const gui::color tint(0.9f, 0.9f, 0.9f, 0.9f);
+
+    // Transform and tint: scalar loops, as used before the SIMD kernels, or the kernels
+    std::vector<gui::vertex> work_list = vertex_list;
+    auto                     start     = timing_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        for (auto& v : work_list)
+            v.pos = v.pos * transform;
+    }
+    const double scalar_transform_time = elapsed_microseconds(start);
+
+    work_list = vertex_list;
+    start     = timing_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i)
+        gui::transform_vertices(work_list.data(), work_list.size(), transform);
+    const double simd_transform_time = elapsed_microseconds(start);
+
+    work_list = vertex_list;
+    start     = timing_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        for (auto& v : work_list)
+            v.col *= tint;
+    }
+    const double scalar_tint_time = elapsed_microseconds(start);
+
+    work_list = vertex_list;
+    start     = timing_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i)
+        gui::tint_vertices(work_list.data(), work_list.size(), tint);
+    const double simd_tint_time = elapsed_microseconds(start);
+
+    std::cout << "Benchmark with " << vertex_count << " vertices (vertices/s):" << std::endl;
+    std::cout << "  transform, scalar: " << vertices_per_second(scalar_transform_time)
+              << std::endl;
+    std::cout << "  transform, SIMD: " << vertices_per_second(simd_transform_time) << std::endl;
+    std::cout << "  tint, scalar: " << vertices_per_second(scalar_tint_time) << std::endl;
+    std::cout << "  tint, SIMD: " << vertices_per_second(simd_tint_time) << std::endl;
+
+    if (!renderer.is_vertex_cache_supported())
+        return;
+
+    // Upload to a vertex cache, with the full or the packed vertex layout
+    const bool was_packed = renderer.is_packed_vertex_enabled();
+    for (bool packed : {false, true}) {
+        if (packed && !renderer.is_packed_vertex_supported())
+            continue;
+
+        renderer.set_packed_vertex_enabled(packed);
+        auto cache = renderer.create_vertex_cache(gui::vertex_cache::type::quads);
+
+        start = timing_clock::now();
+        for (std::size_t i = 0; i < iterations; ++i)
+            cache->update(vertex_list.data(), vertex_list.size());
+        const double upload_time = elapsed_microseconds(start);
+
+        std::cout << "  upload, " << (packed ? "packed" : "full") << " layout: "
+                  << vertices_per_second(upload_time) << std::endl;
+    }
+
+    renderer.set_packed_vertex_enabled(was_packed);
+}
+
 int main(int /*argc*/, char* /*argv*/[]) {
     auto* old_cout_buffer = std::cout.rdbuf();
 
@@ -228,21 +398,25 @@ int main(int /*argc*/, char* /*argv*/[]) {
         // Read test configuration
         // -------------------------------------------------
 
-        std::size_t window_width  = 800u;
-        std::size_t window_height = 600u;
-        bool        full_screen   = false;
-        float       scale_factor  = 1.0f;
-        bool        print_to_log  = false;
+        std::size_t window_width           = 800u;
+        std::size_t window_height          = 600u;
+        bool        full_screen            = false;
+        float       scale_factor           = 1.0f;
+        bool        print_to_log           = false;
+        std::size_t benchmark_frame_count  = 0u;
+        std::size_t benchmark_vertex_count = 0u;
 
         // Read some configuration data
         if (utils::file_exists("config.lua")) {
             sol::state lua;
             lua.do_file("config.lua");
-            window_width  = lua["window_width"].get_or(std::size_t{800u});
-            window_height = lua["window_height"].get_or(std::size_t{600u});
-            full_screen   = lua["fullscreen"].get_or(false);
-            scale_factor  = lua["scale_factor"].get_or(1.0);
-            print_to_log  = lua["print_to_log"].get_or(false);
+            window_width           = lua["window_width"].get_or(std::size_t{800u});
+            window_height          = lua["window_height"].get_or(std::size_t{600u});
+            full_screen            = lua["fullscreen"].get_or(false);
+            scale_factor           = lua["scale_factor"].get_or(1.0);
+            print_to_log           = lua["print_to_log"].get_or(false);
+            benchmark_frame_count  = lua["benchmark_frame_count"].get_or(std::size_t{0u});
+            benchmark_vertex_count = lua["benchmark_vertex_count"].get_or(std::size_t{0u});
         }
 
 #if defined(LXGUI_COMPILER_EMSCRIPTEN)
@@ -535,6 +709,14 @@ int main(int /*argc*/, char* /*argv*/[]) {
         // Tell the Frame is has been fully loaded, and call "OnLoad"
         fps_frame->notify_loaded();
 
+        // Optionally, measure the cost of many frames (e.g., benchmark_frame_count = 10000)
+        if (benchmark_frame_count > 0u)
+            run_frame_benchmark(*manager, benchmark_frame_count);
+
+        // Optionally, measure vertex kernels and uploads (e.g., benchmark_vertex_count = 100000)
+        if (benchmark_vertex_count > 0u)
+            run_vertex_benchmark(manager->get_renderer(), benchmark_vertex_count);
+
         // -------------------------------------------------
         // Reacting to inputs in your game
         // -------------------------------------------------
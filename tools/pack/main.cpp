@@ -0,0 +1,28 @@
+#include <lxgui/utils_exception.hpp>
+#include <lxgui/utils_file_system.hpp>
+
+#include <iostream>
+
+using namespace lxgui;
+
+int main(int argc, char* argv[]) {
+    if (argc != 3) {
+        std::cerr << "usage: lxgui-pack <directory> <archive>" << std::endl;
+        std::cerr << "Packs all the files in <directory> (e.g., 'interface') into <archive>, "
+                  << "to be mounted with utils::mount_archive()." << std::endl;
+        return 1;
+    }
+
+    try {
+        const std::size_t file_count = utils::pack_archive(argv[1], argv[2]);
+        std::cout << "Packed " << file_count << " files into " << argv[2] << "." << std::endl;
+    } catch (const utils::exception& e) {
+        std::cerr << e.get_description() << std::endl;
+        return 1;
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}